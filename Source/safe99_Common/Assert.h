@@ -4,7 +4,13 @@
 #ifndef SAFE99_ASSERT_H
 #define SAFE99_ASSERT_H
 
-#include <intrin.h>
+#include "Platform.h"
+
+#if defined(UW_PLATFORM_WIN)
+    #include <intrin.h>
+#else
+    #define __debugbreak() __builtin_trap()
+#endif // UW_PLATFORM_WIN
 
 #define CRASH(msg)   (__debugbreak())
 
@@ -14,7 +14,9 @@
 #define SAFE99_FILE_NAME_LEN 64
 
 // dll export
-#ifdef SAFE99_DLL
+#if !defined(UW_PLATFORM_WIN)
+    #define SAFE99_GLOBAL_FUNC __attribute__((visibility("default")))
+#elif defined(SAFE99_DLL)
     #define SAFE99_GLOBAL_FUNC __declspec(dllexport)
 #else
     #define SAFE99_GLOBAL_FUNC __declspec(dllimport)
@@ -26,8 +28,20 @@ typedef void(__stdcall* CreateDllInstanceFunc)(void** ppOutInstance);
 
 // Alignment
 #define DEFAULT_ALIGN   16
-#define ALIGN8          _declspec(align(8))
-#define ALIGN16         _declspec(align(16))
-#define ALIGN32         _declspec(align(32))
+
+#if defined(UW_PLATFORM_WIN)
+    #define ALIGN8          _declspec(align(8))
+    #define ALIGN16         _declspec(align(16))
+    #define ALIGN32         _declspec(align(32))
+
+    #define ALIGNED_MALLOC(size, align) _aligned_malloc((size), (align))
+#else
+    #define ALIGN8          __attribute__((aligned(8)))
+    #define ALIGN16         __attribute__((aligned(16)))
+    #define ALIGN32         __attribute__((aligned(32)))
+
+    // aligned_alloc은 size가 align의 배수여야 함
+    #define ALIGNED_MALLOC(size, align) aligned_alloc((align), (((size) + (align) - 1) / (align)) * (align))
+#endif // UW_PLATFORM_WIN
 
 #endif // SAFE99_COMMON_H
\ No newline at end of file
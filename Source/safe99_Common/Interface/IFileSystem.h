@@ -9,6 +9,9 @@ typedef struct TEXTURE
     uint32_t    Width;
     uint32_t    Height;
     char*       pBitmap;
+
+    // 0 또는 1이면 밉맵 없음, 아니면 pBitmap에 0번 레벨부터 연속으로 저장 (safe99_Common/Util/MipMap.h)
+    uint32_t    NumMipLevels;
 } TEXTURE;
 
 typedef SAFE99_INTERFACE IFileSystem IFileSystem;
@@ -4,6 +4,218 @@
 #ifndef SAFE99_I_RENDERER_H
 #define SAFE99_I_RENDERER_H
 
+#include "IFileSystem.h"
+
+// Z는 깊이 버퍼가 있을 때만 사용 (작을수록 가까움)
+typedef struct COLOR_VERTEX
+{
+    float       X;
+    float       Y;
+    float       Z;
+    uint32_t    Argb;
+} COLOR_VERTEX;
+
+// Rhw = 1 / w (클립 공간 w의 역수), U와 V는 [0, 1]이 텍스처 전체
+typedef struct TEXTURE_VERTEX
+{
+    float       X;
+    float       Y;
+    float       Z;
+    float       Rhw;
+    float       U;
+    float       V;
+} TEXTURE_VERTEX;
+
+// 투영 행렬을 곱한 클립 공간 정점, 보이는 영역은 -W <= X <= W, -W <= Y <= W (Y는 위쪽), 0 <= Z <= W
+// U, V는 원근 보정해서 보간하고 Argb는 COLOR_VERTEX처럼 화면 공간에서 선형 보간
+typedef struct CLIP_VERTEX
+{
+    float       X;
+    float       Y;
+    float       Z;
+    float       W;
+    float       U;
+    float       V;
+    uint32_t    Argb;
+} CLIP_VERTEX;
+
+// 비트맵은 알파가 곱해진(premultiplied) A8R8G8B8
+typedef enum BLEND_MODE
+{
+    BLEND_MODE_OPAQUE,      // dest = src
+    BLEND_MODE_ALPHA,       // dest = src + dest * (1 - srcA)
+    BLEND_MODE_ADDITIVE,    // dest = src + dest
+    BLEND_MODE_MULTIPLY,    // dest = dest * (src + 1 - srcA), 투명한 부분은 dest 유지
+} BLEND_MODE;
+
+// pTexture의 (SrcX, SrcY)부터 Width x Height 영역을 (X, Y)에 그림, 텍스처 밖 영역은 그리지 않음
+typedef struct SPRITE
+{
+    const TEXTURE*  pTexture;
+    int             SrcX;
+    int             SrcY;
+    uint_t          Width;
+    uint_t          Height;
+    int             X;
+    int             Y;
+    BLEND_MODE      BlendMode;
+} SPRITE;
+
+typedef enum TEXTURE_FILTER
+{
+    TEXTURE_FILTER_POINT,
+    TEXTURE_FILTER_BILINEAR,
+    TEXTURE_FILTER_TRILINEAR,   // 인접한 두 밉 레벨을 바이리니어 샘플링해서 보간
+} TEXTURE_FILTER;
+
+typedef enum TEXTURE_ADDRESS
+{
+    TEXTURE_ADDRESS_WRAP,
+    TEXTURE_ADDRESS_CLAMP,
+} TEXTURE_ADDRESS;
+
+// 비트맵 좌표 (u, v)를 화면 좌표 (M00 * u + M01 * v + M02, M10 * u + M11 * v + M12)로 옮김
+// 비트맵 픽셀 (i, j)는 [i, i + 1) x [j, j + 1), 중심이 변환한 사각형 안에 드는 화면 픽셀만 그림
+typedef struct AFFINE_TRANSFORM
+{
+    float   M00;
+    float   M01;
+    float   M02;
+    float   M10;
+    float   M11;
+    float   M12;
+} AFFINE_TRANSFORM;
+
+typedef enum DEPTH_FORMAT
+{
+    DEPTH_FORMAT_NONE,
+    DEPTH_FORMAT_D32_FLOAT,
+    DEPTH_FORMAT_D24_UNORM,
+} DEPTH_FORMAT;
+
+// R5G6B5, P8 백 버퍼는 Clear, 선, 불투명 비트맵 복사만 지원하며 출력할 때만 A8R8G8B8로 펼침
+// 색상 인자는 A8R8G8B8에서 변환하고 P8은 하위 8비트를 팔레트 인덱스로 씀, 비트맵은 백 버퍼와 같은 형식
+typedef enum BACK_BUFFER_FORMAT
+{
+    BACK_BUFFER_FORMAT_A8R8G8B8,
+    BACK_BUFFER_FORMAT_R5G6B5,
+    BACK_BUFFER_FORMAT_P8,
+} BACK_BUFFER_FORMAT;
+
+// 백 버퍼의 메모리 배치
+typedef enum SURFACE_LAYOUT
+{
+    SURFACE_LAYOUT_LINEAR,  // 행 우선
+    SURFACE_LAYOUT_TILED,   // 16x16 타일을 세로 띠 단위로 연속 저장, 출력할 때 행 우선으로 펼침
+} SURFACE_LAYOUT;
+
+// 동적 해상도에서 내부 서피스를 백 버퍼 크기로 늘리는 필터
+typedef enum UPSCALE_FILTER
+{
+    UPSCALE_FILTER_NEAREST,     // 너비가 정수 배면 픽셀을 그대로 반복
+    UPSCALE_FILTER_BILINEAR,
+} UPSCALE_FILTER;
+
+#define MAX_POST_EFFECTS 8
+#define MAX_BLUR_RADIUS 16
+
+// 출력할 때 프레임에 적용하는 효과, 색은 0 ~ 255 정수로 계산
+typedef enum POST_EFFECT_TYPE
+{
+    POST_EFFECT_BOX_BLUR,
+    POST_EFFECT_GAUSSIAN_BLUR,              // 표준 편차는 Radius / 2
+    POST_EFFECT_COLOR_LUT,                  // 3D LUT 색 보정, 채널 사이는 삼선형 보간하고 알파는 유지
+    POST_EFFECT_BRIGHTNESS_CONTRAST,        // c' = (c - 128) * Contrast + 128 + Brightness * 255, 알파는 유지
+} POST_EFFECT_TYPE;
+
+// Type이 쓰는 필드만 채움
+typedef struct POST_EFFECT
+{
+    POST_EFFECT_TYPE    Type;
+
+    uint_t              Radius;             // 블러, 1 ~ MAX_BLUR_RADIUS, 가장자리 밖은 가장자리 픽셀로 봄
+
+    const uint32_t*     pLut;               // LutSize^3개의 A8R8G8B8, 인덱스는 r + g * LutSize + b * LutSize * LutSize
+    uint_t              LutSize;            // 2 ~ 64
+
+    float               Brightness;         // -1 ~ 1
+    float               Contrast;           // 0 ~ 127
+} POST_EFFECT;
+
+// 채우기/복사/블렌드 커널에 쓰는 명령어 집합
+typedef enum SIMD_LEVEL
+{
+    SIMD_LEVEL_SSE41,
+    SIMD_LEVEL_AVX2,
+    SIMD_LEVEL_AVX512,      // AVX-512 F + BW
+} SIMD_LEVEL;
+
+// SetMaxFps로 제한한 프레임 간격 통계 (초 단위), SetMaxFps나 ResetFramePacingStats 이후부터 셈
+typedef struct FRAME_PACING_STATS
+{
+    uint_t  NumFrames;
+    float   AverageFrameTime;       // EndRender 사이 간격의 평균
+    float   Jitter;                 // EndRender 사이 간격의 표준 편차
+    float   AverageOvershoot;       // 목표 시각을 넘겨서 깨어난 시간
+    float   MaxOvershoot;
+    float   SleepOvershoot;         // OS 대기가 요청보다 늦게 깨어난 시간의 이동 평균
+    float   SpinMargin;             // 목표 시각 전에 자지 않고 스핀하는 구간
+} FRAME_PACING_STATS;
+
+// 백 버퍼 대신 그릴 수 있는 A8R8G8B8 서피스, IRenderer::SetRenderTarget으로 바인딩
+// GetTexture는 서피스 메모리를 그대로 가리키므로 복사 없이 DrawBitmap의 비트맵, 스프라이트, 텍스처 삼각형의 텍스처로 쓸 수 있음
+typedef SAFE99_INTERFACE IRenderTarget IRenderTarget;
+SAFE99_INTERFACE IRenderTarget
+{
+    size_t      (__stdcall *AddRef)(IRenderTarget* pThis);
+    size_t      (__stdcall *Release)(IRenderTarget* pThis);
+    size_t      (__stdcall *GetRefCount)(const IRenderTarget* pThis);
+
+    // 너비는 만들 때 요청한 값을 16의 배수로 올린 값
+    uint_t      (__stdcall *GetWidth)(const IRenderTarget* pThis);
+    uint_t      (__stdcall *GetHeight)(const IRenderTarget* pThis);
+
+    // 밉맵 없음, 렌더 타겟이 해제될 때까지 유효
+    const TEXTURE* (__stdcall *GetTexture)(const IRenderTarget* pThis);
+};
+
+// 그리기 명령을 선형 버퍼에 기록해 두었다가 IRenderer::ExecuteCommandList로 여러 번 실행
+// 정점, 인덱스, 선분, 스프라이트 배열은 복사하고 비트맵, 텍스처, 렌더 타겟은 포인터만 저장하므로 실행할 때까지 유효해야 함
+// 기록 함수는 메모리 할당에 실패하면 false를 반환하며 그 명령만 빠짐
+typedef SAFE99_INTERFACE ICommandList ICommandList;
+SAFE99_INTERFACE ICommandList
+{
+    size_t      (__stdcall *AddRef)(ICommandList* pThis);
+    size_t      (__stdcall *Release)(ICommandList* pThis);
+    size_t      (__stdcall *GetRefCount)(const ICommandList* pThis);
+
+    // 기록한 명령을 모두 지움 (버퍼는 재사용)
+    void        (__stdcall *Reset)(ICommandList* pThis);
+    uint_t      (__stdcall *GetNumCommands)(const ICommandList* pThis);
+    size_t      (__stdcall *GetSize)(const ICommandList* pThis);
+
+    bool        (__stdcall *Clear)(ICommandList* pThis, const uint32_t argb);
+    bool        (__stdcall *ClearDepth)(ICommandList* pThis, const float depth);
+    bool        (__stdcall *DrawHorizontalLine)(ICommandList* pThis, const int x, const int y, const uint_t width, const uint32_t argb);
+    bool        (__stdcall *DrawVerticalLine)(ICommandList* pThis, const int x, const int y, const uint_t height, const uint32_t argb);
+    bool        (__stdcall *DrawLine)(ICommandList* pThis, const int x0, const int y0, const int x1, const int y1, const uint32_t argb);
+    bool        (__stdcall *DrawLines)(ICommandList* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                       const uint_t numLines, const uint32_t argb);
+    bool        (__stdcall *DrawBitmap)(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap);
+    bool        (__stdcall *DrawBitmapBlended)(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                               const BLEND_MODE blendMode);
+    bool        (__stdcall *DrawBitmapTransformed)(ICommandList* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                                   const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+    bool        (__stdcall *DrawSprites)(ICommandList* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture);
+    bool        (__stdcall *DrawTriangles)(ICommandList* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+    bool        (__stdcall *DrawTexturedTriangles)(ICommandList* pThis, const TEXTURE* pTexture,
+                                                   const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+    bool        (__stdcall *DrawClipSpaceTriangles)(ICommandList* pThis, const TEXTURE* pTexture,
+                                                    const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+    bool        (__stdcall *SetTextureSampler)(ICommandList* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address);
+    bool        (__stdcall *SetRenderTarget)(ICommandList* pThis, IRenderTarget* pTarget);
+};
+
 typedef SAFE99_INTERFACE IRenderer IRenderer;
 SAFE99_INTERFACE IRenderer
 {
@@ -13,23 +225,151 @@ SAFE99_INTERFACE IRenderer
 
     bool        (__stdcall *Init)(IRenderer* pThis, void* hWnd);
 
+    // 윈도우 없이 메모리 서피스에 렌더링 (EndRender에서 화면 출력하지 않음)
+    bool        (__stdcall *InitHeadless)(IRenderer* pThis, const uint_t width, const uint_t height);
+
     void        (__stdcall *OnMoveWindow)(IRenderer* pThis);
     void        (__stdcall *OnResizeWindow)(IRenderer* pThis);
 
     uint_t      (__stdcall *GetWidth)(const IRenderer* pThis);
     uint_t      (__stdcall *GetHeight)(const IRenderer* pThis);
 
+    // 마지막으로 출력한 프레임 (복사 없음), 백 버퍼 수 - 1번 더 출력할 때까지 유효 (백 버퍼가 하나면 다음 EndRender까지)
+    const uint32_t* (__stdcall *GetFrontBuffer)(const IRenderer* pThis, uint_t* pOutPitch);
+
     void        (__stdcall *BeginRender)(IRenderer* pThis);
     void        (__stdcall *EndRender)(IRenderer* pThis);
 
     void        (__stdcall *Clear)(IRenderer* pThis, const uint32_t argb);
+    void        (__stdcall *ClearDepth)(IRenderer* pThis, const float depth);
     void        (__stdcall *DrawHorizontalLine)(IRenderer* pThis, const int x, const int y, const uint_t width, const uint32_t argb);
     void        (__stdcall *DrawVerticalLine)(IRenderer* pThis, const int x, const int y, const uint_t height, const uint32_t argb);
+
+    // 좌표는 int 전체 범위를 받으며 화면에서 먼 끝점은 선분을 따라 옮긴 후 그림 (화면 안에서 최대 1픽셀 어긋날 수 있음)
     void        (__stdcall *DrawLine)(IRenderer* pThis, const int x0, const int y0, const int x1, const int y1, const uint_t argb);
+
+    // i번째 선분은 (pX0s[i], pY0s[i]) ~ (pX1s[i], pY1s[i]), 같은 색의 선분을 DrawLine보다 빠르게 그림
+    void        (__stdcall *DrawLines)(IRenderer* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                       const uint_t numLines, const uint32_t argb);
     void        (__stdcall *DrawBitmap)(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap);
+    void        (__stdcall *DrawBitmapBlended)(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                               const BLEND_MODE blendMode);
+
+    // 확대/축소, 회전한 비트맵을 그림, 너비와 높이는 32768 미만
+    // 화면 픽셀 중심을 역변환해서 비트맵 밖이면 건너뜀, 정수 평행 이동만 하면 DrawBitmapBlended와 같은 결과
+    // 역변환할 수 없는 행렬이면 그리지 않음
+    void        (__stdcall *DrawBitmapTransformed)(IRenderer* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                                   const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+
+    // bSortByTexture면 같은 텍스처끼리 모아서 그림, 다른 텍스처 사이의 그리기 순서는 유지되지 않음
+    // 타일 모드에서 텍스처는 EndRender까지 유효해야 함
+    void        (__stdcall *DrawSprites)(IRenderer* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture);
+
+    // 정점 색상을 보간한 채워진 삼각형 (pIndices가 NULL이면 정점 3개씩 삼각형 하나)
+    void        (__stdcall *DrawTriangle)(IRenderer* pThis, const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2);
+    void        (__stdcall *DrawTriangles)(IRenderer* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+
+    // 원근 보정한 텍스처 삼각형 (A8R8G8B8), 타일 모드에서 pTexture->pBitmap은 EndRender까지 유효해야 함
+    void        (__stdcall *DrawTexturedTriangles)(IRenderer* pThis, const TEXTURE* pTexture,
+                                                   const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+
+    // 클립 공간 삼각형, pTexture가 NULL이면 정점 색상으로 그림
+    // 가드 밴드 안의 삼각형은 자르지 않고 화면 시저로 처리하며 near/far 평면이나 가드 밴드에 걸친 삼각형만 잘라냄
+    void        (__stdcall *DrawClipSpaceTriangles)(IRenderer* pThis, const TEXTURE* pTexture,
+                                                    const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+
+    // 만든 명령 목록은 이 DLL의 어떤 렌더러에서도 실행할 수 있음, 메모리 할당에 실패하면 false
+    bool        (__stdcall *CreateCommandList)(IRenderer* pThis, ICommandList** ppOutCommandList);
 
+    // 기록한 순서대로 그림, 각 그리기 함수를 직접 호출한 것과 결과가 같음
+    void        (__stdcall *ExecuteCommandList)(IRenderer* pThis, const ICommandList* pCommandList);
+
+    // depthFormat이 DEPTH_FORMAT_NONE이 아니면 렌더 타겟 전용 깊이 버퍼도 만듦, 처음 내용은 0
+    // 만든 렌더 타겟은 이 DLL의 어떤 렌더러에서도 바인딩할 수 있음, 메모리 할당에 실패하면 false
+    bool        (__stdcall *CreateRenderTarget)(IRenderer* pThis, const uint_t width, const uint_t height, const DEPTH_FORMAT depthFormat,
+                                                IRenderTarget** ppOutTarget);
+
+    // 이후 그리기 함수(Clear, ClearDepth 포함)는 pTarget에 바로 그림, NULL이면 백 버퍼로 돌아감 (기본값 NULL)
+    // 렌더 타겟에는 타일 모드, 빠른 Clear 없이 그리며 설정 함수와 GetWidth, GetHeight는 항상 백 버퍼 기준
+    // 바인딩한 렌더 타겟은 바인딩이 풀릴 때까지 유효해야 하고 바인딩된 동안 자기 자신을 원본으로 쓰면 결과가 정의되지 않음
+    // 렌더 타겟 바인딩은 프레임이 끝나도 유지되며 명령 목록에 기록한 바인딩도 실행 후 그대로 남음
+    void        (__stdcall *SetRenderTarget)(IRenderer* pThis, IRenderTarget* pTarget);
+
+    // 0이면 제한 없음, EndRender에서 남은 시간 대부분은 자고 마지막 구간만 스핀
     void        (__stdcall *SetMaxFps)(IRenderer* pThis, const uint32_t fps);
     uint32_t    (__stdcall *GetFps)(const IRenderer* pThis);
+
+    // 0이면 즉시 그리기(기본값), 1 이상이면 타일별로 모았다가 EndRender에서 numThreads개 스레드로 래스터화
+    // 타일 모드에서 DrawBitmap, DrawBitmapBlended, DrawBitmapTransformed의 pBitmap은 EndRender까지 유효해야 함, Init 이후에 호출
+    bool        (__stdcall *SetNumRasterThreads)(IRenderer* pThis, const uint_t numThreads);
+
+    // DEPTH_FORMAT_NONE이 아니면 삼각형에 깊이 테스트(LESS)와 쓰기를 적용, 1.0으로 초기화됨
+    bool        (__stdcall *SetDepthFormat)(IRenderer* pThis, const DEPTH_FORMAT format);
+
+    // 기본값은 TEXTURE_FILTER_POINT, TEXTURE_ADDRESS_WRAP
+    // 밉맵이 있는 텍스처는 블록 한 행마다 LOD를 구함, POINT와 BILINEAR는 가장 가까운 레벨 하나만 샘플링
+    void        (__stdcall *SetTextureSampler)(IRenderer* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address);
+
+    // Init에서 CPU가 지원하는 가장 높은 단계를 고름, 지원하지 않는 단계면 false
+    // 프로세스 전체에 적용되므로 렌더링 중이 아닐 때 호출
+    bool        (__stdcall *SetSimdLevel)(IRenderer* pThis, const SIMD_LEVEL level);
+    SIMD_LEVEL  (__stdcall *GetSimdLevel)(const IRenderer* pThis);
+
+    // true면 즉시 그리기 모드의 Clear를 64x64 타일별로 미뤄 처음 쓸 때나 EndRender에서 채움 (기본값 false)
+    // 불투명 DrawBitmap으로 완전히 덮이는 타일은 채우지 않음, 타일 모드는 항상 이렇게 동작
+    bool        (__stdcall *SetFastClear)(IRenderer* pThis, const bool bEnable);
+
+    // 1이면 EndRender에서 바로 출력 (기본값), 2 ~ 3이면 출력 스레드가 출력하는 동안 다음 프레임을 그림
+    // 출력 중인 버퍼에는 그리지 않도록 렌더러가 기다림, 프레임 사이(EndRender 후 다음 그리기 전)에 호출
+    bool        (__stdcall *SetNumBackBuffers)(IRenderer* pThis, const uint_t numBuffers);
+
+    // 펜스는 프레임을 출력하도록 제출할 때마다 1씩 증가 (바뀐 것이 없는 프레임은 출력하지 않으므로 증가하지 않음)
+    uint64_t    (__stdcall *GetPresentFence)(const IRenderer* pThis);            // 마지막으로 제출한 프레임
+    uint64_t    (__stdcall *GetCompletedPresentFence)(const IRenderer* pThis);   // 출력이 끝난 마지막 프레임, 렌더 스레드를 기다리지 않음
+    void        (__stdcall *WaitForPresentFence)(IRenderer* pThis, const uint64_t fence);
+
+    // true면 그리기 함수는 명령 목록에 기록만 하고 EndRender에서 렌더 스레드로 넘김 (기본값 false)
+    // 렌더 스레드가 이전 프레임을 그리는 동안 다음 프레임을 기록하며 EndRender는 그 이전 프레임이 끝날 때까지만 기다림
+    // 비트맵, 텍스처는 다음 EndRender가 반환될 때까지 유효해야 함, 프레임 사이에 호출
+    // 설정 함수와 GetFrontBuffer, GetCompletedPresentFence를 뺀 펜스 함수는 렌더 스레드가 제출한 프레임을 모두 그릴 때까지 기다린 후 동작
+    bool        (__stdcall *SetRenderThread)(IRenderer* pThis, const bool bEnable);
+
+    // 기본값은 BACK_BUFFER_FORMAT_A8R8G8B8, 바꾸면 모든 백 버퍼를 다시 만들고 0으로 채움, 프레임 사이에 호출
+    // R5G6B5, P8에서는 삼각형, 스프라이트, 변환한 비트맵을 그리지 않고 DrawBitmapBlended의 blendMode를 무시함
+    // 타일 모드, 빠른 Clear, SURFACE_LAYOUT_TILED, 동적 해상도, 후처리를 켠 상태에서는 R5G6B5, P8로 바꿀 수 없음 (false)
+    // GetFrontBuffer는 펼친 A8R8G8B8 프레임을 반환하며 다음 EndRender까지 유효
+    bool        (__stdcall *SetBackBufferFormat)(IRenderer* pThis, const BACK_BUFFER_FORMAT format);
+
+    // P8 팔레트의 firstIndex부터 numEntries개를 바꿈 (기본값은 회색조), 다음 출력부터 화면 전체에 적용
+    void        (__stdcall *SetPalette)(IRenderer* pThis, const uint32_t* pArgbs, const uint_t firstIndex, const uint_t numEntries);
+
+    // 기본값은 SURFACE_LAYOUT_LINEAR, 세로선, 가파른 선, 삼각형이 많으면 SURFACE_LAYOUT_TILED가 캐시/TLB 적중률이 높음
+    // 바꾸면 모든 백 버퍼와 깊이 버퍼를 다시 만들고 0으로 채움, 프레임 사이에 호출, R5G6B5, P8, 동적 해상도, 후처리와 같이 쓸 수 없음 (false)
+    // SURFACE_LAYOUT_TILED에서 GetFrontBuffer는 펼친 프레임을 반환하며 다음 EndRender까지 유효
+    bool        (__stdcall *SetSurfaceLayout)(IRenderer* pThis, const SURFACE_LAYOUT layout);
+
+    // 0 < minScale <= maxScale <= 1, 내부 해상도 배율을 프레임 시간(프레임 제한 대기 제외)이 targetFrameTime(초)에 맞도록 이 사이에서 바꿈
+    // 렌더 타겟이 바인딩되지 않은 그리기 함수는 배율에 맞춘 내부 서피스에 그리고 출력할 때 filter로 백 버퍼 크기로 늘림
+    // 클립 공간 삼각형은 그대로 맞춰지며 화면 좌표는 GetRenderWidth, GetRenderHeight 기준, 내부 서피스에는 빠른 Clear 없이 그림
+    // minScale == maxScale == 1이면 끔 (기본값), R5G6B5, P8, SURFACE_LAYOUT_TILED와 같이 쓸 수 없음 (false), 프레임 사이에 호출
+    bool        (__stdcall *SetDynamicResolution)(IRenderer* pThis, const float minScale, const float maxScale, const float targetFrameTime,
+                                                  const UPSCALE_FILTER filter);
+
+    // 다음 프레임을 그릴 내부 서피스 크기, 동적 해상도를 끄면 GetWidth, GetHeight와 같음
+    // 렌더 스레드를 기다리지 않음, 렌더 스레드 모드에서는 EndRender에서 그 이전 프레임 시간으로 정하므로 한 프레임 늦게 따라감
+    uint_t      (__stdcall *GetRenderWidth)(const IRenderer* pThis);
+    uint_t      (__stdcall *GetRenderHeight)(const IRenderer* pThis);
+
+    // 출력할 때 pEffects를 차례로 적용 (최대 MAX_POST_EFFECTS개), numEffects가 0이면 끔 (기본값), 효과와 LUT는 복사함
+    // 백 버퍼는 그대로 두고 적용한 결과를 출력하며 GetFrontBuffer도 적용한 프레임을 반환 (다음 EndRender까지 유효)
+    // 프레임을 행 띠로 나눠 numThreads개 스레드로 처리, 출력 스레드가 있으면 출력 스레드에서 처리
+    // bFuse면 픽셀 단위 효과를 이웃한 블러나 다른 픽셀 단위 효과와 묶어 프레임을 덜 읽고 씀 (결과는 같음)
+    // R5G6B5, P8, SURFACE_LAYOUT_TILED와 같이 쓸 수 없음 (false), 프레임 사이에 호출
+    bool        (__stdcall *SetPostEffects)(IRenderer* pThis, const POST_EFFECT* pEffects, const uint_t numEffects, const uint_t numThreads,
+                                            const bool bFuse);
+
+    void        (__stdcall *GetFramePacingStats)(const IRenderer* pThis, FRAME_PACING_STATS* pOutStats);
+    void        (__stdcall *ResetFramePacingStats)(IRenderer* pThis);
 };
 
 #endif // SAFE99_I_RENDERER_H
\ No newline at end of file
@@ -24,4 +24,14 @@
     #define PLATFORM_X64
 #endif // PLATFORM_WIN_X64
 
+#if defined(__linux__)
+    #define PLATFORM_LINUX
+#endif // __linux__
+
+// 윈도우 외 플랫폼에서는 호출 규약 키워드를 무시
+#if !defined(UW_PLATFORM_WIN)
+    #define __stdcall
+    #define __vectorcall
+#endif // !UW_PLATFORM_WIN
+
 #endif // SAFE99_PLATFORM_H
\ No newline at end of file
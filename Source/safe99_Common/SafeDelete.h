@@ -4,8 +4,14 @@
 #ifndef SAFE99_SAFE_DELETE_H
 #define SAFE99_SAFE_DELETE_H
 
+#include "Platform.h"
+
 #include <stdlib.h>
-#include <Windows.h>
+
+#if defined(UW_PLATFORM_WIN)
+    #include <malloc.h>
+    #include <Windows.h>
+#endif // UW_PLATFORM_WIN
 
 #ifdef __cplusplus
     #define SAFE_RELEASE(p)         { if ((p)) { (p)->Release(); (p) = NULL; } }
@@ -14,7 +20,13 @@
 #endif // __cplusplus
 
 #define SAFE_FREE(p)                { if ((p)) free((p)); (p) = NULL; }
-#define SAFE_VIRTUAL_FREE(p)        { VirtualFree((p), 0, MEM_RELEASE); (p) = NULL; }
-#define SAFE_FREE_LIBRARY(handle)   { if ((handle)) { FreeLibrary(handle); (handle) = NULL; } }
+
+#if defined(UW_PLATFORM_WIN)
+    #define SAFE_ALIGNED_FREE(p)        { if ((p)) _aligned_free((p)); (p) = NULL; }
+    #define SAFE_VIRTUAL_FREE(p)        { VirtualFree((p), 0, MEM_RELEASE); (p) = NULL; }
+    #define SAFE_FREE_LIBRARY(handle)   { if ((handle)) { FreeLibrary(handle); (handle) = NULL; } }
+#else
+    #define SAFE_ALIGNED_FREE(p)        { if ((p)) free((p)); (p) = NULL; }
+#endif // UW_PLATFORM_WIN
 
 #endif // SAFE99_SAFE_DELETE_H
\ No newline at end of file
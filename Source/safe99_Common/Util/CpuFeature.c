@@ -0,0 +1,87 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+
+#include "../Common.h"
+#include "CpuFeature.h"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#else
+    #include <cpuid.h>
+#endif // _MSC_VER
+
+#define CPUID_1_ECX_SSE41       (1u << 19)
+#define CPUID_1_ECX_OSXSAVE     (1u << 27)
+#define CPUID_1_ECX_AVX         (1u << 28)
+#define CPUID_7_EBX_AVX2        (1u << 5)
+#define CPUID_7_EBX_AVX512F     (1u << 16)
+#define CPUID_7_EBX_AVX512BW    (1u << 30)
+
+// OS가 컨텍스트 스위칭 때 저장하는 레지스터 상태
+#define XCR0_YMM                0x06    // XMM, YMM 상위
+#define XCR0_ZMM                0xe0    // opmask, ZMM 상위, ZMM16~31
+
+static void cpuid(const uint32_t leaf, const uint32_t subLeaf, uint32_t pOutRegisters[4])
+{
+#if defined(_MSC_VER)
+    __cpuidex((int*)pOutRegisters, (int)leaf, (int)subLeaf);
+#else
+    __cpuid_count(leaf, subLeaf, pOutRegisters[0], pOutRegisters[1], pOutRegisters[2], pOutRegisters[3]);
+#endif // _MSC_VER
+}
+
+static uint64_t xgetbv(void)
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax;
+    uint32_t edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif // _MSC_VER
+}
+
+uint32_t GetCpuFeatures(void)
+{
+    uint32_t registers[4];
+    cpuid(0, 0, registers);
+    const uint32_t maxLeaf = registers[0];
+
+    cpuid(1, 0, registers);
+    const uint32_t ecx1 = registers[2];
+
+    uint32_t features = 0;
+    if (ecx1 & CPUID_1_ECX_SSE41)
+    {
+        features |= CPU_FEATURE_SSE41;
+    }
+
+    if (maxLeaf < 7 || (ecx1 & (CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX)) != (CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX))
+    {
+        return features;
+    }
+
+    const uint64_t xcr0 = xgetbv();
+    if ((xcr0 & XCR0_YMM) != XCR0_YMM)
+    {
+        return features;
+    }
+
+    cpuid(7, 0, registers);
+    const uint32_t ebx7 = registers[1];
+    if (ebx7 & CPUID_7_EBX_AVX2)
+    {
+        features |= CPU_FEATURE_AVX2;
+    }
+
+    if ((ebx7 & (CPUID_7_EBX_AVX512F | CPUID_7_EBX_AVX512BW)) == (CPUID_7_EBX_AVX512F | CPUID_7_EBX_AVX512BW)
+        && (xcr0 & XCR0_ZMM) == XCR0_ZMM)
+    {
+        features |= CPU_FEATURE_AVX512;
+    }
+
+    return features;
+}
\ No newline at end of file
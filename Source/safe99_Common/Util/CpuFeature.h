@@ -0,0 +1,27 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// CPUID와 XGETBV로 CPU와 OS가 모두 지원하는 SIMD 확장을 확인
+
+#ifndef SAFE99_CPU_FEATURE_H
+#define SAFE99_CPU_FEATURE_H
+
+typedef enum CPU_FEATURE
+{
+    CPU_FEATURE_SSE41 =     0x01,
+    CPU_FEATURE_AVX2 =      0x02,
+    CPU_FEATURE_AVX512 =    0x04,   // AVX-512 F + BW
+} CPU_FEATURE;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// CPU_FEATURE 비트 조합
+uint32_t GetCpuFeatures(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SAFE99_CPU_FEATURE_H
\ No newline at end of file
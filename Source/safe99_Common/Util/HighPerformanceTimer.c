@@ -1,19 +1,43 @@
 ﻿// 작성자: bumpsgoodman
 // 작성일: 2024-08-27
 
+// clock_gettime (POSIX)
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200112L
+#endif // _WIN32
+
 #include "Precompiled.h"
 
 #include "../Common.h"
 #include "HighPerformanceTimer.h"
 
-#include <Windows.h>
+#if defined(UW_PLATFORM_WIN)
+    #include <Windows.h>
+#else
+    #include <time.h>
+#endif // UW_PLATFORM_WIN
+
+static void QueryCounter(uint64_t* pOutCounter)
+{
+#if defined(UW_PLATFORM_WIN)
+    QueryPerformanceCounter((LARGE_INTEGER*)pOutCounter);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    *pOutCounter = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif // UW_PLATFORM_WIN
+}
 
 bool HighPerformanceTimerInit(HIGH_PERFORMANCE_TIMER* pTimer)
 {
     ASSERT(pTimer != NULL, "pTimer is NULL");
     
+#if defined(UW_PLATFORM_WIN)
     QueryPerformanceFrequency((LARGE_INTEGER*)&pTimer->Frequency);
-    QueryPerformanceCounter((LARGE_INTEGER*)&pTimer->PrevCounter);
+#else
+    pTimer->Frequency = 1000000000ull;
+#endif // UW_PLATFORM_WIN
+    QueryCounter(&pTimer->PrevCounter);
     pTimer->InverseFrequency = 1.0f / (float)pTimer->Frequency;
     pTimer->DeltaTime = 0.0f;
 
@@ -25,7 +49,7 @@ void HighPerformanceTimerUpdate(HIGH_PERFORMANCE_TIMER* pTimer, const float tick
     ASSERT(pTimer != NULL, "pTimer is NULL");
     
     uint64_t curCounter;
-    QueryPerformanceCounter((LARGE_INTEGER*)&curCounter);
+    QueryCounter(&curCounter);
 
     pTimer->DeltaTime = (float)(curCounter - pTimer->PrevCounter) * pTimer->InverseFrequency;
     if (pTimer->DeltaTime >= tick)
@@ -0,0 +1,125 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+
+#include <immintrin.h>
+
+#include "../Common.h"
+#include "MipMap.h"
+
+static uint_t getMipSize(const uint_t size, const uint_t level)
+{
+    const uint_t mipSize = size >> level;
+    return (mipSize > 0) ? mipSize : 1;
+}
+
+static uint32_t averageTexels(const uint32_t t00, const uint32_t t10, const uint32_t t01, const uint32_t t11)
+{
+    uint32_t result = 0;
+    for (uint_t shift = 0; shift < 32; shift += 8)
+    {
+        const uint32_t sum = ((t00 >> shift) & 0xff) + ((t10 >> shift) & 0xff)
+            + ((t01 >> shift) & 0xff) + ((t11 >> shift) & 0xff);
+        result |= ((sum + 2) >> 2) << shift;
+    }
+
+    return result;
+}
+
+uint_t GetNumMipLevels(const uint_t width, const uint_t height)
+{
+    uint_t size = (width > height) ? width : height;
+    uint_t numLevels = 1;
+    while (size > 1)
+    {
+        size >>= 1;
+        ++numLevels;
+    }
+
+    return numLevels;
+}
+
+size_t GetMipLevelOffset(const uint_t width, const uint_t height, const uint_t level)
+{
+    size_t offset = 0;
+    for (uint_t i = 0; i < level; ++i)
+    {
+        offset += (size_t)getMipSize(width, i) * getMipSize(height, i);
+    }
+
+    return offset;
+}
+
+size_t GetMipChainSize(const uint_t width, const uint_t height, const uint_t numLevels)
+{
+    return GetMipLevelOffset(width, height, numLevels);
+}
+
+void GenerateMipLevel(const uint32_t* pSrc, const uint_t srcWidth, const uint_t srcHeight, uint32_t* pDest)
+{
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(srcWidth > 0 && srcHeight > 0, "Invalid size");
+
+    const uint_t destWidth = getMipSize(srcWidth, 1);
+    const uint_t destHeight = getMipSize(srcHeight, 1);
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+
+    for (uint_t y = 0; y < destHeight; ++y)
+    {
+        const uint32_t* pRow0 = pSrc + (size_t)(2 * y) * srcWidth;
+        const uint32_t* pRow1 = (2 * y + 1 < srcHeight) ? pRow0 + srcWidth : pRow0;
+        uint32_t* pDestRow = pDest + (size_t)y * destWidth;
+
+        // 원본 8텍셀(2행)로 4텍셀을 만듦
+        uint_t x = 0;
+        for (; 2 * x + 8 <= srcWidth && x + 4 <= destWidth; x += 4)
+        {
+            const __m128 a0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(pRow0 + 2 * x)));
+            const __m128 a1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(pRow0 + 2 * x + 4)));
+            const __m128 b0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(pRow1 + 2 * x)));
+            const __m128 b1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(pRow1 + 2 * x + 4)));
+
+            const __m128i evenA = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)));
+            const __m128i oddA = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)));
+            const __m128i evenB = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+            const __m128i oddB = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+            const __m128i sumLo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(evenA, zero), _mm_unpacklo_epi8(oddA, zero)),
+                                                _mm_add_epi16(_mm_unpacklo_epi8(evenB, zero), _mm_unpacklo_epi8(oddB, zero)));
+            const __m128i sumHi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(evenA, zero), _mm_unpackhi_epi8(oddA, zero)),
+                                                _mm_add_epi16(_mm_unpackhi_epi8(evenB, zero), _mm_unpackhi_epi8(oddB, zero)));
+
+            const __m128i averageLo = _mm_srli_epi16(_mm_add_epi16(sumLo, round), 2);
+            const __m128i averageHi = _mm_srli_epi16(_mm_add_epi16(sumHi, round), 2);
+            _mm_storeu_si128((__m128i*)(pDestRow + x), _mm_packus_epi16(averageLo, averageHi));
+        }
+
+        for (; x < destWidth; ++x)
+        {
+            const uint_t x0 = 2 * x;
+            const uint_t x1 = (x0 + 1 < srcWidth) ? x0 + 1 : x0;
+            pDestRow[x] = averageTexels(pRow0[x0], pRow0[x1], pRow1[x0], pRow1[x1]);
+        }
+    }
+}
+
+void GenerateMipChain(uint32_t* pTexels, const uint_t width, const uint_t height, const uint_t numLevels)
+{
+    ASSERT(pTexels != NULL, "pTexels is NULL");
+    ASSERT(numLevels <= GetNumMipLevels(width, height), "Invalid numLevels");
+
+    uint32_t* pSrc = pTexels;
+    for (uint_t level = 1; level < numLevels; ++level)
+    {
+        const uint_t srcWidth = getMipSize(width, level - 1);
+        const uint_t srcHeight = getMipSize(height, level - 1);
+        uint32_t* pDest = pSrc + (size_t)srcWidth * srcHeight;
+
+        GenerateMipLevel(pSrc, srcWidth, srcHeight, pDest);
+        pSrc = pDest;
+    }
+}
\ No newline at end of file
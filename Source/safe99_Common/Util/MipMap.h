@@ -0,0 +1,31 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// A8R8G8B8 밉맵 체인, 모든 레벨은 0번 레벨부터 하나의 버퍼에 연속으로 저장 (DDS와 같은 순서)
+// k번 레벨의 크기는 max(1, width >> k) x max(1, height >> k)
+
+#ifndef SAFE99_MIP_MAP_H
+#define SAFE99_MIP_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// 1x1 레벨까지 포함한 전체 체인의 레벨 수
+uint_t GetNumMipLevels(const uint_t width, const uint_t height);
+
+// 텍셀 단위
+size_t GetMipLevelOffset(const uint_t width, const uint_t height, const uint_t level);
+size_t GetMipChainSize(const uint_t width, const uint_t height, const uint_t numLevels);
+
+// 2x2 박스 필터로 절반 크기 레벨을 만듦, 홀수 크기의 마지막 행/열은 버리고 크기가 1인 축은 같은 텍셀을 두 번 씀
+void GenerateMipLevel(const uint32_t* pSrc, const uint_t srcWidth, const uint_t srcHeight, uint32_t* pDest);
+
+// 0번 레벨로부터 1 ~ numLevels - 1번 레벨을 채움
+void GenerateMipChain(uint32_t* pTexels, const uint_t width, const uint_t height, const uint_t numLevels);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SAFE99_MIP_MAP_H
\ No newline at end of file
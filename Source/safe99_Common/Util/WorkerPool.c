@@ -0,0 +1,243 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+
+#include "../Common.h"
+#include "WorkerPool.h"
+
+#if defined(UW_PLATFORM_WIN)
+    #include <Windows.h>
+    #include <process.h>
+
+    typedef HANDLE THREAD_HANDLE;
+    typedef HANDLE SEMAPHORE_HANDLE;
+
+    #define THREAD_RETURN unsigned int __stdcall
+#else
+    #include <pthread.h>
+    #include <semaphore.h>
+
+    typedef pthread_t THREAD_HANDLE;
+    typedef sem_t SEMAPHORE_HANDLE;
+
+    #define THREAD_RETURN void*
+#endif // UW_PLATFORM_WIN
+
+static long fetchAndIncrement(volatile long* pValue)
+{
+#if defined(UW_PLATFORM_WIN)
+    return InterlockedIncrement(pValue) - 1;
+#else
+    return __atomic_fetch_add(pValue, 1, __ATOMIC_ACQ_REL);
+#endif // UW_PLATFORM_WIN
+}
+
+static void postSemaphore(void* pSemaphore, const uint_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    ReleaseSemaphore(*(SEMAPHORE_HANDLE*)pSemaphore, (LONG)count, NULL);
+#else
+    for (uint_t i = 0; i < count; ++i)
+    {
+        sem_post((SEMAPHORE_HANDLE*)pSemaphore);
+    }
+#endif // UW_PLATFORM_WIN
+}
+
+static void waitSemaphore(void* pSemaphore)
+{
+#if defined(UW_PLATFORM_WIN)
+    WaitForSingleObject(*(SEMAPHORE_HANDLE*)pSemaphore, INFINITE);
+#else
+    while (sem_wait((SEMAPHORE_HANDLE*)pSemaphore) != 0)
+    {
+    }
+#endif // UW_PLATFORM_WIN
+}
+
+static bool createSemaphore(void** ppOutSemaphore)
+{
+    SEMAPHORE_HANDLE* pSemaphore = (SEMAPHORE_HANDLE*)malloc(sizeof(SEMAPHORE_HANDLE));
+    if (pSemaphore == NULL)
+    {
+        return false;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    *pSemaphore = CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+    if (*pSemaphore == NULL)
+#else
+    if (sem_init(pSemaphore, 0, 0) != 0)
+#endif // UW_PLATFORM_WIN
+    {
+        free(pSemaphore);
+        return false;
+    }
+
+    *ppOutSemaphore = pSemaphore;
+    return true;
+}
+
+static void destroySemaphore(void** ppSemaphore)
+{
+    if (*ppSemaphore == NULL)
+    {
+        return;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    CloseHandle(*(SEMAPHORE_HANDLE*)*ppSemaphore);
+#else
+    sem_destroy((SEMAPHORE_HANDLE*)*ppSemaphore);
+#endif // UW_PLATFORM_WIN
+
+    SAFE_FREE(*ppSemaphore);
+}
+
+static void runJobs(WORKER_POOL* pPool)
+{
+    while (true)
+    {
+        const long jobIndex = fetchAndIncrement(&pPool->NextJobIndex);
+        if (jobIndex >= (long)pPool->NumJobs)
+        {
+            break;
+        }
+
+        pPool->pfnJob(pPool->pContext, (uint_t)jobIndex);
+    }
+}
+
+static THREAD_RETURN workerThreadMain(void* pArg)
+{
+    WORKER_POOL* pPool = (WORKER_POOL*)pArg;
+
+    while (true)
+    {
+        waitSemaphore(pPool->pStartSemaphore);
+        if (pPool->bExit)
+        {
+            break;
+        }
+
+        runJobs(pPool);
+        postSemaphore(pPool->pDoneSemaphore, 1);
+    }
+
+    return 0;
+}
+
+bool WorkerPoolInit(WORKER_POOL* pPool, const uint_t numThreads)
+{
+    ASSERT(pPool != NULL, "pPool is NULL");
+    ASSERT(numThreads > 0, "numThreads is 0");
+
+    memset(pPool, 0, sizeof(WORKER_POOL));
+    pPool->NumThreads = numThreads;
+
+    if (numThreads == 1)
+    {
+        return true;
+    }
+
+    THREAD_HANDLE* pThreads = (THREAD_HANDLE*)malloc(sizeof(THREAD_HANDLE) * (numThreads - 1));
+    if (pThreads == NULL
+        || !createSemaphore(&pPool->pStartSemaphore)
+        || !createSemaphore(&pPool->pDoneSemaphore))
+    {
+        SAFE_FREE(pThreads);
+        destroySemaphore(&pPool->pStartSemaphore);
+        destroySemaphore(&pPool->pDoneSemaphore);
+        return false;
+    }
+    pPool->pThreads = pThreads;
+
+    for (uint_t i = 0; i < numThreads - 1; ++i)
+    {
+#if defined(UW_PLATFORM_WIN)
+        pThreads[i] = (HANDLE)_beginthreadex(NULL, 0, workerThreadMain, pPool, 0, NULL);
+        if (pThreads[i] == NULL)
+#else
+        if (pthread_create(&pThreads[i], NULL, workerThreadMain, pPool) != 0)
+#endif // UW_PLATFORM_WIN
+        {
+            // 생성된 스레드까지만 정리
+            pPool->NumThreads = i + 1;
+            WorkerPoolRelease(pPool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void WorkerPoolRelease(WORKER_POOL* pPool)
+{
+    ASSERT(pPool != NULL, "pPool is NULL");
+
+    if (pPool->pThreads != NULL)
+    {
+        THREAD_HANDLE* pThreads = (THREAD_HANDLE*)pPool->pThreads;
+
+        pPool->bExit = true;
+        postSemaphore(pPool->pStartSemaphore, pPool->NumThreads - 1);
+
+        for (uint_t i = 0; i < pPool->NumThreads - 1; ++i)
+        {
+#if defined(UW_PLATFORM_WIN)
+            WaitForSingleObject(pThreads[i], INFINITE);
+            CloseHandle(pThreads[i]);
+#else
+            pthread_join(pThreads[i], NULL);
+#endif // UW_PLATFORM_WIN
+        }
+
+        SAFE_FREE(pPool->pThreads);
+    }
+
+    destroySemaphore(&pPool->pStartSemaphore);
+    destroySemaphore(&pPool->pDoneSemaphore);
+
+    pPool->NumThreads = 0;
+}
+
+void WorkerPoolDispatch(WORKER_POOL* pPool, WorkerJobFunc pfnJob, void* pContext, const uint_t numJobs)
+{
+    ASSERT(pPool != NULL, "pPool is NULL");
+    ASSERT(pfnJob != NULL, "pfnJob is NULL");
+
+    pPool->pfnJob = pfnJob;
+    pPool->pContext = pContext;
+    pPool->NumJobs = numJobs;
+    pPool->NextJobIndex = 0;
+
+    if (numJobs == 0)
+    {
+        return;
+    }
+
+    // 호출 스레드가 작업 하나를 맡으므로 나머지만 깨움
+    const uint_t numWorkers = ((pPool->NumThreads < numJobs) ? pPool->NumThreads : numJobs) - 1;
+
+    // 세마포어의 release/acquire가 위 작업 정보의 가시성을 보장
+    postSemaphore(pPool->pStartSemaphore, numWorkers);
+
+    runJobs(pPool);
+
+    for (uint_t i = 0; i < numWorkers; ++i)
+    {
+        waitSemaphore(pPool->pDoneSemaphore);
+    }
+}
+
+uint_t WorkerPoolGetNumThreads(const WORKER_POOL* pPool)
+{
+    ASSERT(pPool != NULL, "pPool is NULL");
+    return pPool->NumThreads;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 호출 스레드도 함께 일하는 fork-join 워커 풀
+
+#ifndef SAFE99_WORKER_POOL_H
+#define SAFE99_WORKER_POOL_H
+
+typedef void(__stdcall* WorkerJobFunc)(void* pContext, const uint_t jobIndex);
+
+typedef struct WORKER_POOL
+{
+    uint_t          NumThreads;     // 호출 스레드 포함
+    void*           pThreads;
+    void*           pStartSemaphore;
+    void*           pDoneSemaphore;
+
+    WorkerJobFunc   pfnJob;
+    void*           pContext;
+    uint_t          NumJobs;
+    volatile long   NextJobIndex;
+    volatile bool   bExit;
+} WORKER_POOL;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+bool WorkerPoolInit(WORKER_POOL* pPool, const uint_t numThreads);
+void WorkerPoolRelease(WORKER_POOL* pPool);
+
+// 모든 작업이 끝날 때까지 반환하지 않음
+void WorkerPoolDispatch(WORKER_POOL* pPool, WorkerJobFunc pfnJob, void* pContext, const uint_t numJobs);
+
+uint_t WorkerPoolGetNumThreads(const WORKER_POOL* pPool);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SAFE99_WORKER_POOL_H
\ No newline at end of file
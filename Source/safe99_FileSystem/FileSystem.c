@@ -4,6 +4,9 @@
 #include "Precompiled.h"
 #include "safe99_Common/Common.h"
 #include "safe99_Common/Interface/IFileSystem.h"
+#include "safe99_Common/Util/MipMap.h"
+
+#define DDSD_MIPMAPCOUNT 0x20000
 
 typedef struct FileSystem
 {
@@ -79,6 +82,16 @@ bool __stdcall LoadDDS_A8R8G8B8(IFileSystem* pThis, const wchar_t* pFilename, TE
 
     bool bResult = false;
 
+    // 오류 시 정리를 위해 goto 전에 선언
+    char* pBitmap = NULL;
+    uint32_t magic;
+    char ddsHeader[124];
+    uint32_t width;
+    uint32_t height;
+    uint_t numMipLevels;
+    uint_t numFileMipLevels;
+    size_t fileSize;
+
     FILE* pFile = _wfopen(pFilename, L"rb");
     if (pFile == NULL)
     {
@@ -86,44 +99,74 @@ bool __stdcall LoadDDS_A8R8G8B8(IFileSystem* pThis, const wchar_t* pFilename, TE
         goto lb_return;
     }
 
-    uint32_t magic;
-    fread(&magic, sizeof(uint32_t), 1, pFile);
-
-    const char* pMagic = (const char*)&magic;
-    if (pMagic[0] != 'D'
-        || pMagic[1] != 'D'
-        || pMagic[2] != 'S'
-        || pMagic[3] != ' ')
+    if (fread(&magic, sizeof(uint32_t), 1, pFile) != 1
+        || ((const char*)&magic)[0] != 'D'
+        || ((const char*)&magic)[1] != 'D'
+        || ((const char*)&magic)[2] != 'S'
+        || ((const char*)&magic)[3] != ' ')
     {
         ASSERT(false, "mismatch header");
         goto lb_return;
     }
 
-    char ddsHeader[124];
-    fread(ddsHeader, sizeof(char), 124, pFile);
+    if (fread(ddsHeader, sizeof(char), 124, pFile) != 124)
+    {
+        ASSERT(false, "Failed to read header");
+        goto lb_return;
+    }
 
-    const uint32_t height = *(uint32_t*)&ddsHeader[8];
-    const uint32_t width = *(uint32_t*)&ddsHeader[12];
+    height = *(uint32_t*)&ddsHeader[8];
+    width = *(uint32_t*)&ddsHeader[12];
 
-    char* pBitmap = (char*)malloc(width * height * sizeof(uint32_t));
+    // 파일에 밉맵이 있으면 그대로 읽고 나머지는 마지막으로 읽은 레벨로부터 만듦
+    numMipLevels = GetNumMipLevels(width, height);
+    numFileMipLevels = 1;
+    if ((*(uint32_t*)&ddsHeader[4] & DDSD_MIPMAPCOUNT) && *(uint32_t*)&ddsHeader[24] > 1)
+    {
+        numFileMipLevels = *(uint32_t*)&ddsHeader[24];
+        if (numFileMipLevels > numMipLevels)
+        {
+            numFileMipLevels = numMipLevels;
+        }
+    }
+
+    pBitmap = (char*)malloc(GetMipChainSize(width, height, numMipLevels) * sizeof(uint32_t));
     if (pBitmap == NULL)
     {
         ASSERT(false, "Failed to malloc bitmap");
         goto lb_return;
     }
 
-    fread(pBitmap, 1, width * height * sizeof(uint32_t), pFile);
+    fileSize = GetMipChainSize(width, height, numFileMipLevels) * sizeof(uint32_t);
+    if (fread(pBitmap, 1, fileSize, pFile) != fileSize)
+    {
+        ASSERT(false, "Failed to read bitmap");
+        goto lb_return;
+    }
 
-    fclose(pFile);
+    {
+        const uint_t lastLevel = numFileMipLevels - 1;
+        const uint_t lastWidth = (width >> lastLevel > 0) ? width >> lastLevel : 1;
+        const uint_t lastHeight = (height >> lastLevel > 0) ? height >> lastLevel : 1;
+        GenerateMipChain((uint32_t*)pBitmap + GetMipLevelOffset(width, height, lastLevel), lastWidth, lastHeight,
+                         numMipLevels - lastLevel);
+    }
 
     pOutTexture->Width = width;
     pOutTexture->Height = height;
     pOutTexture->pBitmap = pBitmap;
+    pOutTexture->NumMipLevels = numMipLevels;
 
-    fclose(pFile);
+    pBitmap = NULL;
     bResult = true;
 
 lb_return:
+    SAFE_FREE(pBitmap);
+    if (pFile != NULL)
+    {
+        fclose(pFile);
+    }
+
     return bResult;
 }
 
@@ -7,7 +7,10 @@
 #include "safe99_MathMisc.inl"
 
 #include <immintrin.h>
-#include <intrin.h>
+
+#if defined(UW_PLATFORM_WIN)
+    #include <intrin.h>
+#endif // UW_PLATFORM_WIN
 
 typedef ALIGN16 union COLORF
 {
@@ -33,8 +36,13 @@ typedef ALIGN16 union VECTOR2_INT
     };
 } VECTOR2_INT;
 
+#if defined(_MSC_VER)
 static const VECTOR2_INT s_vector2_int_zero = { 0, 0, 0, 0 };
 static const VECTOR2_INT s_vector2_int_one = { 0, 0, 0, 0 };
+#else
+static const VECTOR2_INT s_vector2_int_zero = { { 0, 0 } };
+static const VECTOR2_INT s_vector2_int_one = { { 0, 0 } };
+#endif // _MSC_VER
 
 inline VECTOR2_INT __vectorcall Vector2IntSet(const int x, const int y)
 {
@@ -68,7 +76,13 @@ inline VECTOR2_INT __vectorcall Vector2IntMul(const VECTOR2_INT v0, const VECTOR
 
 inline VECTOR2_INT __vectorcall Vector2IntDiv(const VECTOR2_INT v0, const VECTOR2_INT v1)
 {
+#if defined(_MSC_VER)
     const VECTOR2_INT result = { _mm_div_epi32(v0.SSE, v1.SSE) };
+#else
+    // _mm_div_epi32는 SVML(MSVC) 전용
+    VECTOR2_INT result;
+    result.SSE = _mm_set_epi32(0, 0, v0.Y / v1.Y, v0.X / v1.X);
+#endif // _MSC_VER
     return result;
 }
 
@@ -2,10 +2,27 @@
 // 작성일: 2024-09-13
 
 #include "Precompiled.h"
+
+#include <immintrin.h>
+
 #include "safe99_Common/Common.h"
 #include "safe99_Math/safe99_Math.inl"
 #include "Clipping.h"
 
+bool __stdcall IntersectClipRect(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1, CLIP_RECT* pOutRect)
+{
+    ASSERT(pRect0 != NULL, "pRect0 is NULL");
+    ASSERT(pRect1 != NULL, "pRect1 is NULL");
+    ASSERT(pOutRect != NULL, "pOutRect is NULL");
+
+    pOutRect->MinX = MAX(pRect0->MinX, pRect1->MinX);
+    pOutRect->MinY = MAX(pRect0->MinY, pRect1->MinY);
+    pOutRect->MaxX = MIN(pRect0->MaxX, pRect1->MaxX);
+    pOutRect->MaxY = MIN(pRect0->MaxY, pRect1->MaxY);
+
+    return pOutRect->MinX <= pOutRect->MaxX && pOutRect->MinY <= pOutRect->MaxY;
+}
+
 int __stdcall GetRegion(const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
                         const int x, const int y)
 {
@@ -32,83 +49,369 @@ int __stdcall GetRegion(const int topLeftX, const int topLeftY, const int bottom
     return region;
 }
 
-bool __stdcall ClipLine(const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
-                        int* pInOutX0, int* pInOutY0, int* pInOutX1, int* pInOutY1)
+static __m128i __vectorcall getRegions4(const __m128i x, const __m128i y,
+                                        const __m128i minX, const __m128i minY, const __m128i maxX, const __m128i maxY)
+{
+    const __m128i left = _mm_and_si128(_mm_cmplt_epi32(x, minX), _mm_set1_epi32(REGION_LEFT));
+    const __m128i right = _mm_and_si128(_mm_cmpgt_epi32(x, maxX), _mm_set1_epi32(REGION_RIGHT));
+    const __m128i top = _mm_and_si128(_mm_cmplt_epi32(y, minY), _mm_set1_epi32(REGION_TOP));
+    const __m128i bottom = _mm_and_si128(_mm_cmpgt_epi32(y, maxY), _mm_set1_epi32(REGION_BOTTOM));
+
+    return _mm_or_si128(_mm_or_si128(left, right), _mm_or_si128(top, bottom));
+}
+
+uint_t __stdcall CullLines(const CLIP_RECT* pRect, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                           const uint_t numLines, uint32_t* pOutIndices)
+{
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT(pX0s != NULL && pY0s != NULL && pX1s != NULL && pY1s != NULL, "Line array is NULL");
+    ASSERT(pOutIndices != NULL, "pOutIndices is NULL");
+
+    const __m128i minX = _mm_set1_epi32(pRect->MinX);
+    const __m128i minY = _mm_set1_epi32(pRect->MinY);
+    const __m128i maxX = _mm_set1_epi32(pRect->MaxX);
+    const __m128i maxY = _mm_set1_epi32(pRect->MaxY);
+    const __m128i zero = _mm_setzero_si128();
+
+    uint_t numVisibleLines = 0;
+    uint_t i = 0;
+    for (; i + 4 <= numLines; i += 4)
+    {
+        const __m128i region0 = getRegions4(_mm_loadu_si128((const __m128i*)(pX0s + i)), _mm_loadu_si128((const __m128i*)(pY0s + i)),
+                                            minX, minY, maxX, maxY);
+        const __m128i region1 = getRegions4(_mm_loadu_si128((const __m128i*)(pX1s + i)), _mm_loadu_si128((const __m128i*)(pY1s + i)),
+                                            minX, minY, maxX, maxY);
+
+        // 비트가 켜진 선분: 두 끝점이 모두 안 / 두 끝점이 같은 방향으로 밖
+        const uint_t insideMask = (uint_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_or_si128(region0, region1), zero)));
+        const uint_t outsideMask = ~(uint_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(region0, region1), zero))) & 0xf;
+        if (outsideMask == 0xf)
+        {
+            continue;
+        }
+
+        for (uint_t lane = 0; lane < 4; ++lane)
+        {
+            if ((outsideMask >> lane) & 1)
+            {
+                continue;
+            }
+
+            pOutIndices[numVisibleLines++] = (uint32_t)(i + lane) | (((insideMask >> lane) & 1) ? 0 : LINE_NEEDS_CLIP);
+        }
+    }
+
+    for (; i < numLines; ++i)
+    {
+        const int region0 = GetRegion(pRect->MinX, pRect->MinY, pRect->MaxX, pRect->MaxY, pX0s[i], pY0s[i]);
+        const int region1 = GetRegion(pRect->MinX, pRect->MinY, pRect->MaxX, pRect->MaxY, pX1s[i], pY1s[i]);
+        if ((region0 & region1) != 0)
+        {
+            continue;
+        }
+
+        pOutIndices[numVisibleLines++] = (uint32_t)i | (((region0 | region1) == 0) ? 0 : LINE_NEEDS_CLIP);
+    }
+
+    return numVisibleLines;
+}
+
+// 선분 위에서 a에 대응하는 b를 반올림해서 반환, a는 a0와 a1 사이이고 a0 != a1
+// 좌표 차이가 2^32 미만이므로 곱은 부호 없는 64비트에 들어감
+static int64_t interpolateLineCoord(const int64_t a0, const int64_t b0, const int64_t a1, const int64_t b1, const int64_t a)
 {
-    ASSERT(pInOutX0 != NULL, "pInOutX0 is NULL");
-    ASSERT(pInOutY0 != NULL, "pInOutY0 is NULL");
-    ASSERT(pInOutX1 != NULL, "pInOutX1 is NULL");
-    ASSERT(pInOutY1 != NULL, "pInOutY1 is NULL");
+    const uint64_t deltaA = (uint64_t)((a1 >= a0) ? a1 - a0 : a0 - a1);
+    const uint64_t deltaB = (uint64_t)((b1 >= b0) ? b1 - b0 : b0 - b1);
+    const uint64_t offset = (uint64_t)((a >= a0) ? a - a0 : a0 - a);
+    const int64_t count = (int64_t)((deltaB * offset + deltaA / 2) / deltaA);
 
-    int region0 = GetRegion(topLeftX, topLeftY, bottomRightX, bottomRightY, *pInOutX0, *pInOutY0);
-    int region1 = GetRegion(topLeftX, topLeftY, bottomRightX, bottomRightY, *pInOutX1, *pInOutY1);
+    return (b1 >= b0) ? b0 + count : b0 - count;
+}
 
-    const int minX = topLeftX;
-    const int minY = topLeftY;
-    const int maxX = bottomRightX;
-    const int maxY = bottomRightY;
+bool __stdcall ClampLineToCoordLimit(int* pInOutX0, int* pInOutY0, int* pInOutX1, int* pInOutY1)
+{
+    ASSERT(pInOutX0 != NULL && pInOutY0 != NULL && pInOutX1 != NULL && pInOutY1 != NULL, "Line coordinate is NULL");
 
-    const float slope = (float)(*pInOutY1 - *pInOutY0) / (*pInOutX1 - *pInOutX0);
-    const float inverseSlope = (float)(*pInOutX1 - *pInOutX0) / (*pInOutY1 - *pInOutY0);
+    int64_t x[2] = { *pInOutX0, *pInOutX1 };
+    int64_t y[2] = { *pInOutY0, *pInOutY1 };
 
-    // 1. 두 점의 영역이 모두 중앙(화면 안)에 있는 경우 => 클리핑할 필요 없음
-    // 2. 두 점의 영역이 모두 화면 밖에 있는 경우 (화면 안을 가로지르지 않는 경우) => 클리핑할 필요 없음(그릴 필요 없음)
-    // 3. 두 점의 영역 중 하나라도 화면 안을 가로지르는 경우 => 클리핑 후 재검사
-    while (true)
+    // Cohen-Sutherland, 옮긴 끝점은 항상 두 끝점 사이에 있으므로 int 범위를 벗어나지 않음
+    for (;;)
     {
+        const int region0 = GetRegion(-LINE_COORD_LIMIT, -LINE_COORD_LIMIT, LINE_COORD_LIMIT, LINE_COORD_LIMIT, (int)x[0], (int)y[0]);
+        const int region1 = GetRegion(-LINE_COORD_LIMIT, -LINE_COORD_LIMIT, LINE_COORD_LIMIT, LINE_COORD_LIMIT, (int)x[1], (int)y[1]);
         if ((region0 | region1) == 0)
         {
-            return true;
+            break;
         }
-        else if ((region0 & region1) > 0)
+
+        if ((region0 & region1) != 0)
         {
             return false;
         }
+
+        const uint_t i = (region0 != 0) ? 0 : 1;
+        const uint_t other = 1 - i;
+        const int region = (region0 != 0) ? region0 : region1;
+        if (region & (REGION_LEFT | REGION_RIGHT))
+        {
+            const int64_t edge = (region & REGION_LEFT) ? -LINE_COORD_LIMIT : LINE_COORD_LIMIT;
+            y[i] = interpolateLineCoord(x[i], y[i], x[other], y[other], edge);
+            x[i] = edge;
+        }
         else
         {
-            int* pRegion;
-            int* pX;
-            int* pY;
-            if (region0 > 0)
-            {
-                pRegion = &region0;
-                pX = pInOutX0;
-                pY = pInOutY0;
-            }
-            else
-            {
-                pRegion = &region1;
-                pX = pInOutX1;
-                pY = pInOutY1;
-            }
+            const int64_t edge = (region & REGION_TOP) ? -LINE_COORD_LIMIT : LINE_COORD_LIMIT;
+            x[i] = interpolateLineCoord(y[i], x[i], y[other], x[other], edge);
+            y[i] = edge;
+        }
+    }
 
-            if ((*pRegion & REGION_LEFT) == REGION_LEFT)
-            {
-                *pY = ROUND_INT(slope * (minX - *pX) + *pY);
-                *pX = minX;
-            }
-            else if ((*pRegion & REGION_RIGHT) == REGION_RIGHT)
-            {
-                *pY = ROUND_INT(slope * (maxX - *pX) + *pY);
-                *pX = maxX;
-            }
-            else if ((*pRegion & REGION_TOP) == REGION_TOP)
-            {
-                *pX = ROUND_INT(inverseSlope * (minY - *pY) + *pX);
-                *pY = minY;
-            }
-            else if ((*pRegion & REGION_BOTTOM) == REGION_BOTTOM)
+    *pInOutX0 = (int)x[0];
+    *pInOutY0 = (int)y[0];
+    *pInOutX1 = (int)x[1];
+    *pInOutY1 = (int)y[1];
+
+    return true;
+}
+
+void __stdcall InitLineSteps(LINE_STEPS* pOutLine, const int x0, const int y0, const int x1, const int y1)
+{
+    ASSERT(pOutLine != NULL, "pOutLine is NULL");
+    ASSERT(ABS(x0) <= LINE_COORD_LIMIT && ABS(y0) <= LINE_COORD_LIMIT
+           && ABS(x1) <= LINE_COORD_LIMIT && ABS(y1) <= LINE_COORD_LIMIT, "Line coordinate out of range");
+
+    const int width = x1 - x0;
+    const int height = y1 - y0;
+    const bool bGradual = (ABS(width) >= ABS(height));
+
+    pOutLine->bGradual = bGradual;
+    pOutLine->MajorStart = bGradual ? x0 : y0;
+    pOutLine->MinorStart = bGradual ? y0 : x0;
+    pOutLine->MajorDir = ((bGradual ? width : height) >= 0) ? 1 : -1;
+    pOutLine->MinorDir = ((bGradual ? height : width) >= 0) ? 1 : -1;
+    pOutLine->NumSteps = ABS(bGradual ? width : height);
+    pOutLine->MinorDelta = ABS(bGradual ? height : width);
+}
+
+int __stdcall GetLineMinorCount(const LINE_STEPS* pLine, const int step)
+{
+    ASSERT(pLine != NULL, "pLine is NULL");
+    ASSERT(pLine->NumSteps > 0, "Empty line");
+
+    const int64_t numSteps = pLine->NumSteps;
+    return (int)((2 * (int64_t)step * pLine->MinorDelta + numSteps) / (2 * numSteps));
+}
+
+void __stdcall GetLineStepPoint(const LINE_STEPS* pLine, const int step, int* pOutX, int* pOutY)
+{
+    ASSERT(pLine != NULL, "pLine is NULL");
+    ASSERT(pOutX != NULL, "pOutX is NULL");
+    ASSERT(pOutY != NULL, "pOutY is NULL");
+
+    const int major = pLine->MajorStart + pLine->MajorDir * step;
+    const int minor = pLine->MinorStart + pLine->MinorDir * GetLineMinorCount(pLine, step);
+    *pOutX = pLine->bGradual ? major : minor;
+    *pOutY = pLine->bGradual ? minor : major;
+}
+
+// 양수끼리만
+static int64_t divideRoundUp(const int64_t numerator, const int64_t denominator)
+{
+    return (numerator + denominator - 1) / denominator;
+}
+
+bool __stdcall ClipLine(const CLIP_RECT* pRect, const LINE_STEPS* pLine, int* pOutFirstStep, int* pOutLastStep)
+{
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT(pLine != NULL, "pLine is NULL");
+    ASSERT(pOutFirstStep != NULL, "pOutFirstStep is NULL");
+    ASSERT(pOutLastStep != NULL, "pOutLastStep is NULL");
+
+    const int64_t numSteps = pLine->NumSteps;
+    const int64_t minorDelta = pLine->MinorDelta;
+    if (numSteps == 0)
+    {
+        return false;
+    }
+
+    const int majorMin = pLine->bGradual ? pRect->MinX : pRect->MinY;
+    const int majorMax = pLine->bGradual ? pRect->MaxX : pRect->MaxY;
+    const int minorMin = pLine->bGradual ? pRect->MinY : pRect->MinX;
+    const int minorMax = pLine->bGradual ? pRect->MaxY : pRect->MaxX;
+
+    // 네 경계가 허용하는 step 범위를 차례로 좁힘 (Liang-Barsky의 t 대신 정수 step)
+    int64_t firstStep = 0;
+    int64_t lastStep = numSteps - 1;
+
+    // 주축 좌표는 step에 비례
+    const int64_t majorStart = pLine->MajorStart;
+    firstStep = MAX(firstStep, (pLine->MajorDir > 0) ? majorMin - majorStart : majorStart - majorMax);
+    lastStep = MIN(lastStep, (pLine->MajorDir > 0) ? majorMax - majorStart : majorStart - majorMin);
+    if (firstStep > lastStep)
+    {
+        return false;
+    }
+
+    // 부축이 움직인 횟수 k(i)는 step에 대해 증가하므로 minCount <= k(i) <= maxCount도 연속된 step 범위
+    const int64_t minorStart = pLine->MinorStart;
+    const int64_t minCount = (pLine->MinorDir > 0) ? minorMin - minorStart : minorStart - minorMax;
+    const int64_t maxCount = (pLine->MinorDir > 0) ? minorMax - minorStart : minorStart - minorMin;
+    if (maxCount < 0 || minCount > minorDelta)
+    {
+        return false;
+    }
+
+    // k(i) >= minCount <=> 2 * i * minorDelta >= 2 * numSteps * minCount - numSteps
+    if (minCount > 0)
+    {
+        firstStep = MAX(firstStep, divideRoundUp(2 * numSteps * minCount - numSteps, 2 * minorDelta));
+    }
+
+    // k(i) <= maxCount <=> 2 * i * minorDelta < 2 * numSteps * (maxCount + 1) - numSteps
+    if (maxCount < minorDelta)
+    {
+        lastStep = MIN(lastStep, divideRoundUp(2 * numSteps * (maxCount + 1) - numSteps, 2 * minorDelta) - 1);
+    }
+
+    if (firstStep > lastStep)
+    {
+        return false;
+    }
+
+    *pOutFirstStep = (int)firstStep;
+    *pOutLastStep = (int)lastStep;
+
+    return true;
+}
+
+uint_t __stdcall GetClipCode(const CLIP_POLYGON_VERTEX* pVertex, const float guardBandX, const float guardBandY)
+{
+    ASSERT(pVertex != NULL, "pVertex is NULL");
+
+    const float x = pVertex->X;
+    const float y = pVertex->Y;
+    const float z = pVertex->Z;
+    const float w = pVertex->W;
+
+    uint_t code = 0;
+    code |= (z < 0.0f) ? CLIP_PLANE_NEAR : 0;
+    code |= (z > w) ? CLIP_PLANE_FAR : 0;
+    code |= (x < -w) ? CLIP_PLANE_LEFT : 0;
+    code |= (x > w) ? CLIP_PLANE_RIGHT : 0;
+    code |= (y < -w) ? CLIP_PLANE_BOTTOM : 0;
+    code |= (y > w) ? CLIP_PLANE_TOP : 0;
+    code |= (x < -guardBandX * w) ? CLIP_PLANE_GUARD_LEFT : 0;
+    code |= (x > guardBandX * w) ? CLIP_PLANE_GUARD_RIGHT : 0;
+    code |= (y < -guardBandY * w) ? CLIP_PLANE_GUARD_BOTTOM : 0;
+    code |= (y > guardBandY * w) ? CLIP_PLANE_GUARD_TOP : 0;
+
+    return code;
+}
+
+// 평면 안쪽이면 0 이상
+static float getPlaneDistance(const CLIP_POLYGON_VERTEX* pVertex, const CLIP_PLANE plane, const float guardBandX, const float guardBandY)
+{
+    switch (plane)
+    {
+    case CLIP_PLANE_NEAR:
+        return pVertex->Z;
+    case CLIP_PLANE_FAR:
+        return pVertex->W - pVertex->Z;
+    case CLIP_PLANE_LEFT:
+        return pVertex->X + pVertex->W;
+    case CLIP_PLANE_RIGHT:
+        return pVertex->W - pVertex->X;
+    case CLIP_PLANE_BOTTOM:
+        return pVertex->Y + pVertex->W;
+    case CLIP_PLANE_TOP:
+        return pVertex->W - pVertex->Y;
+    case CLIP_PLANE_GUARD_LEFT:
+        return pVertex->X + guardBandX * pVertex->W;
+    case CLIP_PLANE_GUARD_RIGHT:
+        return guardBandX * pVertex->W - pVertex->X;
+    case CLIP_PLANE_GUARD_BOTTOM:
+        return pVertex->Y + guardBandY * pVertex->W;
+    case CLIP_PLANE_GUARD_TOP:
+        return guardBandY * pVertex->W - pVertex->Y;
+    default:
+        ASSERT(false, "Invalid clip plane");
+        return 0.0f;
+    }
+}
+
+static void lerpClipVertex(const CLIP_POLYGON_VERTEX* pV0, const CLIP_POLYGON_VERTEX* pV1, const float t, CLIP_POLYGON_VERTEX* pOutVertex)
+{
+    pOutVertex->X = pV0->X + (pV1->X - pV0->X) * t;
+    pOutVertex->Y = pV0->Y + (pV1->Y - pV0->Y) * t;
+    pOutVertex->Z = pV0->Z + (pV1->Z - pV0->Z) * t;
+    pOutVertex->W = pV0->W + (pV1->W - pV0->W) * t;
+    for (size_t i = 0; i < NUM_CLIP_ATTRIBUTES; ++i)
+    {
+        pOutVertex->Attributes[i] = pV0->Attributes[i] + (pV1->Attributes[i] - pV0->Attributes[i]) * t;
+    }
+}
+
+uint_t __stdcall ClipPolygon(CLIP_POLYGON_VERTEX* pInOutVertices, const uint_t numVertices, const uint_t planes,
+                             const float guardBandX, const float guardBandY)
+{
+    ASSERT(pInOutVertices != NULL, "pInOutVertices is NULL");
+    ASSERT(numVertices <= MAX_CLIP_POLYGON_VERTICES, "Too many vertices");
+
+    CLIP_POLYGON_VERTEX tempVertices[MAX_CLIP_POLYGON_VERTICES];
+    CLIP_POLYGON_VERTEX* pSrc = pInOutVertices;
+    CLIP_POLYGON_VERTEX* pDest = tempVertices;
+    uint_t numSrcVertices = numVertices;
+
+    for (uint_t plane = 1; plane <= planes && numSrcVertices >= 3; plane <<= 1)
+    {
+        if ((planes & plane) == 0)
+        {
+            continue;
+        }
+
+        uint_t numDestVertices = 0;
+        const CLIP_POLYGON_VERTEX* pPrev = &pSrc[numSrcVertices - 1];
+        float prevDistance = getPlaneDistance(pPrev, (CLIP_PLANE)plane, guardBandX, guardBandY);
+        for (uint_t i = 0; i < numSrcVertices; ++i)
+        {
+            const CLIP_POLYGON_VERTEX* pCur = &pSrc[i];
+            const float curDistance = getPlaneDistance(pCur, (CLIP_PLANE)plane, guardBandX, guardBandY);
+
+            // 엣지가 평면을 가로지르면 교점을 추가, 교점은 항상 안쪽 정점에서 바깥쪽으로 보간해서 같은 엣지는 같은 점이 됨
+            if ((prevDistance >= 0.0f) != (curDistance >= 0.0f))
             {
-                *pX = ROUND_INT(inverseSlope * (maxY - *pY) + *pX);
-                *pY = maxY;
+                ASSERT(numDestVertices < MAX_CLIP_POLYGON_VERTICES, "Clip polygon overflow");
+                if (prevDistance >= 0.0f)
+                {
+                    lerpClipVertex(pPrev, pCur, prevDistance / (prevDistance - curDistance), &pDest[numDestVertices++]);
+                }
+                else
+                {
+                    lerpClipVertex(pCur, pPrev, curDistance / (curDistance - prevDistance), &pDest[numDestVertices++]);
+                }
             }
-            else
+
+            if (curDistance >= 0.0f)
             {
-                ASSERT(false, "Invalid region");
-                return false;
+                ASSERT(numDestVertices < MAX_CLIP_POLYGON_VERTICES, "Clip polygon overflow");
+                pDest[numDestVertices++] = *pCur;
             }
 
-            *pRegion = GetRegion(topLeftX, topLeftY, bottomRightX, bottomRightY, *pInOutX0, *pInOutY0);
+            pPrev = pCur;
+            prevDistance = curDistance;
         }
+
+        CLIP_POLYGON_VERTEX* pTemp = pSrc;
+        pSrc = pDest;
+        pDest = pTemp;
+        numSrcVertices = numDestVertices;
     }
+
+    if (pSrc != pInOutVertices)
+    {
+        memcpy(pInOutVertices, pSrc, sizeof(CLIP_POLYGON_VERTEX) * numSrcVertices);
+    }
+
+    return numSrcVertices;
 }
\ No newline at end of file
@@ -4,6 +4,15 @@
 #ifndef SAFE99_CLIPPING_H
 #define SAFE99_CLIPPING_H
 
+// 경계 포함
+typedef struct CLIP_RECT
+{
+    int     MinX;
+    int     MinY;
+    int     MaxX;
+    int     MaxY;
+} CLIP_RECT;
+
 typedef enum REGION
 {
     REGION_MIDDLE = 0x00,   // 0b0000
@@ -16,8 +25,86 @@ typedef enum REGION
 int     __stdcall   GetRegion(const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
                               const int x, const int y);
 
-// 영역 안에 있다면 true, 아니라면 false
-bool    __stdcall   ClipLine(const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
-                             int* pInOutX0, int* pInOutY0, int* pInOutX1, int* pInOutY1);
+// 선분을 Bresenham 주축 step으로 나타낸 것, 0 <= i < NumSteps (마지막 점 제외)
+// i번째 점의 주축 좌표 = MajorStart + MajorDir * i
+// i번째 점의 부축 좌표 = MinorStart + MinorDir * floor((2 * i * MinorDelta + NumSteps) / (2 * NumSteps))
+// 좌표는 ±LINE_COORD_LIMIT 이내여야 64비트 정수 연산이 넘치지 않음, 밖이면 ClampLineToCoordLimit으로 먼저 자름
+#define LINE_COORD_LIMIT (1 << 29)
+
+typedef struct LINE_STEPS
+{
+    bool    bGradual;       // true면 x가 주축
+    int     MajorStart;
+    int     MinorStart;
+    int     MajorDir;
+    int     MinorDir;
+    int     NumSteps;
+    int     MinorDelta;
+} LINE_STEPS;
+
+// 끝점이 ±LINE_COORD_LIMIT 밖이면 선분을 따라 그 경계까지 옮김, 선분이 경계 상자와 만나지 않으면 false
+// 옮긴 끝점은 반올림하므로 원래 선분과 최대 1픽셀 어긋날 수 있음
+bool    __stdcall   ClampLineToCoordLimit(int* pInOutX0, int* pInOutY0, int* pInOutX1, int* pInOutY1);
+
+void    __stdcall   InitLineSteps(LINE_STEPS* pOutLine, const int x0, const int y0, const int x1, const int y1);
+
+// i번째 step까지 부축이 움직인 횟수
+int     __stdcall   GetLineMinorCount(const LINE_STEPS* pLine, const int step);
+void    __stdcall   GetLineStepPoint(const LINE_STEPS* pLine, const int step, int* pOutX, int* pOutY);
+
+// 영역 안에 찍히는 점의 step 범위 [*pOutFirstStep, *pOutLastStep], 하나도 없으면 false
+// 끝점을 옮기지 않고 원래 선분의 step 범위만 좁히므로 잘린 선분도 원래 선분과 같은 픽셀을 찍음
+bool    __stdcall   ClipLine(const CLIP_RECT* pRect, const LINE_STEPS* pLine, int* pOutFirstStep, int* pOutLastStep);
+
+// CullLines가 기록한 인덱스 중 ClipLine으로 잘라야 하는 선분
+#define LINE_NEEDS_CLIP 0x80000000u
+
+// 선분 4개씩 양 끝점의 영역을 한 번에 계산해서 영역 밖에 있는 선분을 제외하고 남은 개수를 반환
+// 남은 선분의 인덱스를 순서대로 pOutIndices에 기록하며 영역에 걸친 선분은 LINE_NEEDS_CLIP 비트가 켜짐
+uint_t  __stdcall   CullLines(const CLIP_RECT* pRect, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                              const uint_t numLines, uint32_t* pOutIndices);
+
+// 클립 공간 평면, 정점이 평면 바깥이면 비트가 켜짐 (g는 가드 밴드 크기)
+// 화면 평면은 완전히 밖에 있는 삼각형을 버리는 데만 쓰고 자를 때는 near/far와 가드 밴드 평면만 씀
+typedef enum CLIP_PLANE
+{
+    CLIP_PLANE_NEAR =           0x001,  // z >= 0
+    CLIP_PLANE_FAR =            0x002,  // z <= w
+    CLIP_PLANE_LEFT =           0x004,  // x >= -w
+    CLIP_PLANE_RIGHT =          0x008,  // x <= w
+    CLIP_PLANE_BOTTOM =         0x010,  // y >= -w
+    CLIP_PLANE_TOP =            0x020,  // y <= w
+    CLIP_PLANE_GUARD_LEFT =     0x040,  // x >= -g * w
+    CLIP_PLANE_GUARD_RIGHT =    0x080,  // x <= g * w
+    CLIP_PLANE_GUARD_BOTTOM =   0x100,  // y >= -g * w
+    CLIP_PLANE_GUARD_TOP =      0x200,  // y <= g * w
+} CLIP_PLANE;
+
+#define CLIP_PLANES_GUARD_BAND  (CLIP_PLANE_GUARD_LEFT | CLIP_PLANE_GUARD_RIGHT | CLIP_PLANE_GUARD_BOTTOM | CLIP_PLANE_GUARD_TOP)
+#define CLIP_PLANES_TO_CLIP     (CLIP_PLANE_NEAR | CLIP_PLANE_FAR | CLIP_PLANES_GUARD_BAND)
+
+// 평면마다 정점이 최대 하나씩 늘어남
+#define NUM_CLIP_ATTRIBUTES         6
+#define MAX_CLIP_POLYGON_VERTICES   (3 + 6)
+
+// 속성은 클립 공간에서 선형으로 보간
+typedef struct CLIP_POLYGON_VERTEX
+{
+    float   X;
+    float   Y;
+    float   Z;
+    float   W;
+    float   Attributes[NUM_CLIP_ATTRIBUTES];
+} CLIP_POLYGON_VERTEX;
+
+uint_t  __stdcall   GetClipCode(const CLIP_POLYGON_VERTEX* pVertex, const float guardBandX, const float guardBandY);
+
+// planes의 평면들로 다각형을 Sutherland-Hodgman 방식으로 자르고 남은 정점 수를 반환 (3 미만이면 보이지 않음)
+// pInOutVertices는 MAX_CLIP_POLYGON_VERTICES개를 담을 수 있어야 함
+uint_t  __stdcall   ClipPolygon(CLIP_POLYGON_VERTEX* pInOutVertices, const uint_t numVertices, const uint_t planes,
+                                const float guardBandX, const float guardBandY);
+
+// 교집합이 비어있지 않다면 true, 아니라면 false
+bool    __stdcall   IntersectClipRect(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1, CLIP_RECT* pOutRect);
 
 #endif // SAFE99_CLIPPING_H
\ No newline at end of file
@@ -0,0 +1,502 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "CommandList.h"
+
+#define DEFAULT_COMMAND_LIST_CAPACITY (16 * 1024)
+
+static size_t   __stdcall   AddRef(ICommandList* pThis);
+static size_t   __stdcall   Release(ICommandList* pThis);
+static size_t   __stdcall   GetRefCount(const ICommandList* pThis);
+
+static void     __stdcall   Reset(ICommandList* pThis);
+static uint_t   __stdcall   GetNumCommands(const ICommandList* pThis);
+static size_t   __stdcall   GetSize(const ICommandList* pThis);
+
+static bool     __stdcall   Clear(ICommandList* pThis, const uint32_t argb);
+static bool     __stdcall   ClearDepth(ICommandList* pThis, const float depth);
+static bool     __stdcall   DrawHorizontalLine(ICommandList* pThis, const int x, const int y, const uint_t width, const uint32_t argb);
+static bool     __stdcall   DrawVerticalLine(ICommandList* pThis, const int x, const int y, const uint_t height, const uint32_t argb);
+static bool     __stdcall   DrawLine(ICommandList* pThis, const int x0, const int y0, const int x1, const int y1, const uint32_t argb);
+static bool     __stdcall   DrawLines(ICommandList* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                      const uint_t numLines, const uint32_t argb);
+static bool     __stdcall   DrawBitmap(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap);
+static bool     __stdcall   DrawBitmapBlended(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                              const BLEND_MODE blendMode);
+static bool     __stdcall   DrawBitmapTransformed(ICommandList* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                                  const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+static bool     __stdcall   DrawSprites(ICommandList* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture);
+static bool     __stdcall   DrawTriangles(ICommandList* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static bool     __stdcall   DrawTexturedTriangles(ICommandList* pThis, const TEXTURE* pTexture,
+                                                  const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static bool     __stdcall   DrawClipSpaceTriangles(ICommandList* pThis, const TEXTURE* pTexture,
+                                                   const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static bool     __stdcall   SetTextureSampler(ICommandList* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address);
+static bool     __stdcall   SetRenderTarget(ICommandList* pThis, IRenderTarget* pTarget);
+
+static void*                allocCommand(CommandList* pList, const LIST_COMMAND_TYPE type, const size_t size);
+static bool                 recordTriangles(CommandList* pList, const LIST_COMMAND_TYPE type, const TEXTURE* pTexture,
+                                            const void* pVertices, const size_t vertexSize, const uint16_t* pIndices, const uint_t numTriangles);
+
+static const ICommandList s_vtbl =
+{
+    AddRef,
+    Release,
+    GetRefCount,
+
+    Reset,
+    GetNumCommands,
+    GetSize,
+
+    Clear,
+    ClearDepth,
+    DrawHorizontalLine,
+    DrawVerticalLine,
+    DrawLine,
+    DrawLines,
+    DrawBitmap,
+    DrawBitmapBlended,
+    DrawBitmapTransformed,
+    DrawSprites,
+    DrawTriangles,
+    DrawTexturedTriangles,
+    DrawClipSpaceTriangles,
+    SetTextureSampler,
+    SetRenderTarget
+};
+
+ICommandList* __stdcall CreateCommandListInstance(void)
+{
+    CommandList* pList = (CommandList*)malloc(sizeof(CommandList));
+    if (pList == NULL)
+    {
+        return NULL;
+    }
+
+    memset(pList, 0, sizeof(CommandList));
+    pList->Vtbl = s_vtbl;
+    pList->RefCount = 1;
+
+    return &pList->Vtbl;
+}
+
+bool __stdcall AppendCommandList(ICommandList* pDest, const ICommandList* pSrc)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    CommandList* pDestList = (CommandList*)pDest;
+    const CommandList* pSrcList = (const CommandList*)pSrc;
+    if (pSrcList->Size == 0)
+    {
+        return true;
+    }
+
+    // 명령 하나로 자리를 잡은 뒤 헤더까지 그대로 덮어씀
+    const uint_t numCommands = pDestList->NumCommands;
+    char* pCommands = (char*)allocCommand(pDestList, LIST_COMMAND_CLEAR, pSrcList->Size);
+    if (pCommands == NULL)
+    {
+        return false;
+    }
+
+    memcpy(pCommands, pSrcList->pCommands, pSrcList->Size);
+    pDestList->NumCommands = numCommands + pSrcList->NumCommands;
+    return true;
+}
+
+size_t __stdcall AddRef(ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    CommandList* pList = (CommandList*)pThis;
+    return ++pList->RefCount;
+}
+
+size_t __stdcall Release(ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    CommandList* pList = (CommandList*)pThis;
+    if (--pList->RefCount == 0)
+    {
+        SAFE_ALIGNED_FREE(pList->pCommands);
+        SAFE_FREE(pList);
+        return 0;
+    }
+
+    return pList->RefCount;
+}
+
+size_t __stdcall GetRefCount(const ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const CommandList* pList = (const CommandList*)pThis;
+    return pList->RefCount;
+}
+
+void __stdcall Reset(ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    CommandList* pList = (CommandList*)pThis;
+    pList->Size = 0;
+    pList->NumCommands = 0;
+}
+
+uint_t __stdcall GetNumCommands(const ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const CommandList* pList = (const CommandList*)pThis;
+    return pList->NumCommands;
+}
+
+size_t __stdcall GetSize(const ICommandList* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const CommandList* pList = (const CommandList*)pThis;
+    return pList->Size;
+}
+
+bool __stdcall Clear(ICommandList* pThis, const uint32_t argb)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    LIST_CLEAR_COMMAND* pCommand = (LIST_CLEAR_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_CLEAR, sizeof(LIST_CLEAR_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Argb = argb;
+    return true;
+}
+
+bool __stdcall ClearDepth(ICommandList* pThis, const float depth)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    LIST_CLEAR_DEPTH_COMMAND* pCommand = (LIST_CLEAR_DEPTH_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_CLEAR_DEPTH, sizeof(LIST_CLEAR_DEPTH_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Depth = depth;
+    return true;
+}
+
+bool __stdcall DrawHorizontalLine(ICommandList* pThis, const int x, const int y, const uint_t width, const uint32_t argb)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(width > 0, "width is 0");
+
+    LIST_SPAN_LINE_COMMAND* pCommand = (LIST_SPAN_LINE_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_HORIZONTAL_LINE, sizeof(LIST_SPAN_LINE_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->X = x;
+    pCommand->Y = y;
+    pCommand->Length = width;
+    pCommand->Argb = argb;
+    return true;
+}
+
+bool __stdcall DrawVerticalLine(ICommandList* pThis, const int x, const int y, const uint_t height, const uint32_t argb)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(height > 0, "height is 0");
+
+    LIST_SPAN_LINE_COMMAND* pCommand = (LIST_SPAN_LINE_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_VERTICAL_LINE, sizeof(LIST_SPAN_LINE_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->X = x;
+    pCommand->Y = y;
+    pCommand->Length = height;
+    pCommand->Argb = argb;
+    return true;
+}
+
+bool __stdcall DrawLine(ICommandList* pThis, const int x0, const int y0, const int x1, const int y1, const uint32_t argb)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    LIST_LINE_COMMAND* pCommand = (LIST_LINE_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_LINE, sizeof(LIST_LINE_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->X0 = x0;
+    pCommand->Y0 = y0;
+    pCommand->X1 = x1;
+    pCommand->Y1 = y1;
+    pCommand->Argb = argb;
+    return true;
+}
+
+bool __stdcall DrawLines(ICommandList* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                         const uint_t numLines, const uint32_t argb)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(numLines == 0 || (pX0s != NULL && pY0s != NULL && pX1s != NULL && pY1s != NULL), "coordinates are NULL");
+
+    if (numLines == 0)
+    {
+        return true;
+    }
+
+    const size_t headerSize = ALIGN_COMMAND_SIZE(sizeof(LIST_LINES_COMMAND));
+    const size_t arraySize = ALIGN_COMMAND_SIZE(sizeof(int) * numLines);
+    LIST_LINES_COMMAND* pCommand = (LIST_LINES_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_LINES, headerSize + 4 * arraySize);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->NumLines = numLines;
+    pCommand->Argb = argb;
+
+    char* pArrays = (char*)pCommand + headerSize;
+    memcpy(pArrays, pX0s, sizeof(int) * numLines);
+    memcpy(pArrays + arraySize, pY0s, sizeof(int) * numLines);
+    memcpy(pArrays + 2 * arraySize, pX1s, sizeof(int) * numLines);
+    memcpy(pArrays + 3 * arraySize, pY1s, sizeof(int) * numLines);
+    return true;
+}
+
+bool __stdcall DrawBitmap(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap)
+{
+    return DrawBitmapBlended(pThis, x, y, width, height, pBitmap, BLEND_MODE_OPAQUE);
+}
+
+bool __stdcall DrawBitmapBlended(ICommandList* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                 const BLEND_MODE blendMode)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    LIST_BITMAP_COMMAND* pCommand = (LIST_BITMAP_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_BITMAP, sizeof(LIST_BITMAP_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->pBitmap = pBitmap;
+    pCommand->X = x;
+    pCommand->Y = y;
+    pCommand->Width = width;
+    pCommand->Height = height;
+    pCommand->BlendMode = blendMode;
+    return true;
+}
+
+bool __stdcall DrawBitmapTransformed(ICommandList* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                     const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+    ASSERT(pTransform != NULL, "pTransform is NULL");
+
+    LIST_BITMAP_TRANSFORMED_COMMAND* pCommand = (LIST_BITMAP_TRANSFORMED_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_BITMAP_TRANSFORMED,
+                                                                                               sizeof(LIST_BITMAP_TRANSFORMED_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->pBitmap = pBitmap;
+    pCommand->Width = width;
+    pCommand->Height = height;
+    pCommand->Transform = *pTransform;
+    pCommand->Filter = filter;
+    pCommand->BlendMode = blendMode;
+    return true;
+}
+
+bool __stdcall DrawSprites(ICommandList* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pSprites != NULL || numSprites == 0, "pSprites is NULL");
+
+    if (numSprites == 0)
+    {
+        return true;
+    }
+
+    const size_t headerSize = ALIGN_COMMAND_SIZE(sizeof(LIST_SPRITES_COMMAND));
+    LIST_SPRITES_COMMAND* pCommand = (LIST_SPRITES_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_DRAW_SPRITES,
+                                                               headerSize + sizeof(SPRITE) * numSprites);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->NumSprites = numSprites;
+    pCommand->bSortByTexture = bSortByTexture;
+    memcpy((char*)pCommand + headerSize, pSprites, sizeof(SPRITE) * numSprites);
+    return true;
+}
+
+bool __stdcall DrawTriangles(ICommandList* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    return recordTriangles((CommandList*)pThis, LIST_COMMAND_DRAW_TRIANGLES, NULL,
+                           pVertices, sizeof(COLOR_VERTEX), pIndices, numTriangles);
+}
+
+bool __stdcall DrawTexturedTriangles(ICommandList* pThis, const TEXTURE* pTexture,
+                                     const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pTexture != NULL, "pTexture is NULL");
+
+    return recordTriangles((CommandList*)pThis, LIST_COMMAND_DRAW_TEXTURED_TRIANGLES, pTexture,
+                           pVertices, sizeof(TEXTURE_VERTEX), pIndices, numTriangles);
+}
+
+bool __stdcall DrawClipSpaceTriangles(ICommandList* pThis, const TEXTURE* pTexture,
+                                      const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    return recordTriangles((CommandList*)pThis, LIST_COMMAND_DRAW_CLIP_SPACE_TRIANGLES, pTexture,
+                           pVertices, sizeof(CLIP_VERTEX), pIndices, numTriangles);
+}
+
+bool __stdcall SetTextureSampler(ICommandList* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    LIST_TEXTURE_SAMPLER_COMMAND* pCommand = (LIST_TEXTURE_SAMPLER_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_SET_TEXTURE_SAMPLER,
+                                                                               sizeof(LIST_TEXTURE_SAMPLER_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Filter = filter;
+    pCommand->Address = address;
+    return true;
+}
+
+bool __stdcall SetRenderTarget(ICommandList* pThis, IRenderTarget* pTarget)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    LIST_RENDER_TARGET_COMMAND* pCommand = (LIST_RENDER_TARGET_COMMAND*)allocCommand((CommandList*)pThis, LIST_COMMAND_SET_RENDER_TARGET,
+                                                                           sizeof(LIST_RENDER_TARGET_COMMAND));
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->pTarget = pTarget;
+    return true;
+}
+
+// 헤더를 채운 명령 자리를 반환, 실패하면 NULL
+static void* allocCommand(CommandList* pList, const LIST_COMMAND_TYPE type, const size_t size)
+{
+    ASSERT(pList != NULL, "pList is NULL");
+
+    const size_t commandSize = ALIGN_COMMAND_SIZE(size);
+    if (commandSize > UINT32_MAX)
+    {
+        return NULL;
+    }
+
+    if (pList->Size + commandSize > pList->Capacity)
+    {
+        size_t newCapacity = (pList->Capacity > 0) ? pList->Capacity : DEFAULT_COMMAND_LIST_CAPACITY;
+        while (newCapacity < pList->Size + commandSize)
+        {
+            newCapacity *= 2;
+        }
+
+        // 명령 뒤의 배열을 SIMD로 읽을 수 있도록 정렬된 버퍼를 씀
+        char* pNewCommands = (char*)ALIGNED_MALLOC(newCapacity, COMMAND_ALIGN);
+        if (pNewCommands == NULL)
+        {
+            return NULL;
+        }
+
+        if (pList->pCommands != NULL)
+        {
+            memcpy(pNewCommands, pList->pCommands, pList->Size);
+            SAFE_ALIGNED_FREE(pList->pCommands);
+        }
+
+        pList->pCommands = pNewCommands;
+        pList->Capacity = newCapacity;
+    }
+
+    LIST_COMMAND_HEADER* pHeader = (LIST_COMMAND_HEADER*)(pList->pCommands + pList->Size);
+    memset(pHeader, 0, commandSize);
+    pHeader->Type = (uint32_t)type;
+    pHeader->Size = (uint32_t)commandSize;
+
+    pList->Size += commandSize;
+    ++pList->NumCommands;
+
+    return pHeader;
+}
+
+// 인덱스가 있으면 참조하는 정점 범위만 복사
+static bool recordTriangles(CommandList* pList, const LIST_COMMAND_TYPE type, const TEXTURE* pTexture,
+                            const void* pVertices, const size_t vertexSize, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pVertices != NULL || numTriangles == 0, "pVertices is NULL");
+
+    if (numTriangles == 0)
+    {
+        return true;
+    }
+
+    uint_t numVertices = 3 * numTriangles;
+    if (pIndices != NULL)
+    {
+        uint_t maxIndex = 0;
+        for (uint_t i = 0; i < 3 * numTriangles; ++i)
+        {
+            maxIndex = (pIndices[i] > maxIndex) ? pIndices[i] : maxIndex;
+        }
+
+        numVertices = maxIndex + 1;
+    }
+
+    const size_t headerSize = ALIGN_COMMAND_SIZE(sizeof(LIST_TRIANGLES_COMMAND));
+    const size_t verticesSize = ALIGN_COMMAND_SIZE(vertexSize * numVertices);
+    const size_t indicesSize = (pIndices != NULL) ? sizeof(uint16_t) * 3 * numTriangles : 0;
+    LIST_TRIANGLES_COMMAND* pCommand = (LIST_TRIANGLES_COMMAND*)allocCommand(pList, type, headerSize + verticesSize + indicesSize);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->pTexture = pTexture;
+    pCommand->NumTriangles = numTriangles;
+    pCommand->NumVertices = numVertices;
+    pCommand->bIndexed = (pIndices != NULL);
+
+    char* pPayload = (char*)pCommand + headerSize;
+    memcpy(pPayload, pVertices, vertexSize * numVertices);
+    if (pIndices != NULL)
+    {
+        memcpy(pPayload + verticesSize, pIndices, indicesSize);
+    }
+
+    return true;
+}
\ No newline at end of file
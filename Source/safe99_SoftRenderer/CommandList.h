@@ -0,0 +1,153 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// ICommandList 구현, 명령은 헤더 + 인자 + 복사한 배열 순서로 한 버퍼에 이어서 기록
+// 실행은 렌더러가 버퍼를 앞에서부터 읽으며 내부 함수를 직접 호출
+
+#ifndef SAFE99_COMMAND_LIST_H
+#define SAFE99_COMMAND_LIST_H
+
+// 명령 크기 단위, 뒤따르는 배열의 정렬을 맞춤
+#define COMMAND_ALIGN 16
+
+typedef enum LIST_COMMAND_TYPE
+{
+    LIST_COMMAND_CLEAR,
+    LIST_COMMAND_CLEAR_DEPTH,
+    LIST_COMMAND_DRAW_HORIZONTAL_LINE,
+    LIST_COMMAND_DRAW_VERTICAL_LINE,
+    LIST_COMMAND_DRAW_LINE,
+    LIST_COMMAND_DRAW_LINES,
+    LIST_COMMAND_DRAW_BITMAP,
+    LIST_COMMAND_DRAW_BITMAP_TRANSFORMED,
+    LIST_COMMAND_DRAW_SPRITES,
+    LIST_COMMAND_DRAW_TRIANGLES,
+    LIST_COMMAND_DRAW_TEXTURED_TRIANGLES,
+    LIST_COMMAND_DRAW_CLIP_SPACE_TRIANGLES,
+    LIST_COMMAND_SET_TEXTURE_SAMPLER,
+    LIST_COMMAND_SET_RENDER_TARGET,
+} LIST_COMMAND_TYPE;
+
+// Size는 헤더를 포함한 명령 전체 크기 (COMMAND_ALIGN의 배수)
+typedef struct LIST_COMMAND_HEADER
+{
+    uint32_t    Type;
+    uint32_t    Size;
+} LIST_COMMAND_HEADER;
+
+typedef struct LIST_CLEAR_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    uint32_t        Argb;
+} LIST_CLEAR_COMMAND;
+
+typedef struct LIST_CLEAR_DEPTH_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    float           Depth;
+} LIST_CLEAR_DEPTH_COMMAND;
+
+// 가로선, 세로선 공용
+typedef struct LIST_SPAN_LINE_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    int             X;
+    int             Y;
+    uint_t          Length;
+    uint32_t        Argb;
+} LIST_SPAN_LINE_COMMAND;
+
+typedef struct LIST_LINE_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    int             X0;
+    int             Y0;
+    int             X1;
+    int             Y1;
+    uint32_t        Argb;
+} LIST_LINE_COMMAND;
+
+// 뒤에 X0, Y0, X1, Y1 배열이 차례로 옴
+typedef struct LIST_LINES_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    uint_t          NumLines;
+    uint32_t        Argb;
+} LIST_LINES_COMMAND;
+
+typedef struct LIST_BITMAP_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    const void*     pBitmap;
+    int             X;
+    int             Y;
+    uint_t          Width;
+    uint_t          Height;
+    BLEND_MODE      BlendMode;
+} LIST_BITMAP_COMMAND;
+
+typedef struct LIST_BITMAP_TRANSFORMED_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    const void*     pBitmap;
+    uint_t          Width;
+    uint_t          Height;
+    AFFINE_TRANSFORM    Transform;
+    TEXTURE_FILTER  Filter;
+    BLEND_MODE      BlendMode;
+} LIST_BITMAP_TRANSFORMED_COMMAND;
+
+// 뒤에 SPRITE 배열이 옴
+typedef struct LIST_SPRITES_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    uint_t          NumSprites;
+    bool            bSortByTexture;
+} LIST_SPRITES_COMMAND;
+
+// 뒤에 정점 배열, 인덱스 배열(bIndexed일 때)이 옴
+// 텍스처가 없는 명령은 pTexture가 NULL
+typedef struct LIST_TRIANGLES_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    const TEXTURE*  pTexture;
+    uint_t          NumTriangles;
+    uint_t          NumVertices;
+    bool            bIndexed;
+} LIST_TRIANGLES_COMMAND;
+
+typedef struct LIST_TEXTURE_SAMPLER_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    TEXTURE_FILTER  Filter;
+    TEXTURE_ADDRESS Address;
+} LIST_TEXTURE_SAMPLER_COMMAND;
+
+// pTarget이 NULL이면 백 버퍼
+typedef struct LIST_RENDER_TARGET_COMMAND
+{
+    LIST_COMMAND_HEADER  Header;
+    IRenderTarget*  pTarget;
+} LIST_RENDER_TARGET_COMMAND;
+
+typedef struct CommandList
+{
+    ICommandList    Vtbl;
+    size_t          RefCount;
+
+    char*           pCommands;
+    size_t          Size;
+    size_t          Capacity;
+    uint_t          NumCommands;
+} CommandList;
+
+// 실패하면 NULL
+ICommandList*   __stdcall   CreateCommandListInstance(void);
+
+// pSrc의 명령을 pDest 끝에 복사, 메모리 할당에 실패하면 false
+bool            __stdcall   AppendCommandList(ICommandList* pDest, const ICommandList* pSrc);
+
+// 명령 구조체와 뒤따르는 각 배열은 이 크기로 올림해서 이어 붙임
+#define ALIGN_COMMAND_SIZE(size) (((size_t)(size) + COMMAND_ALIGN - 1) & ~(size_t)(COMMAND_ALIGN - 1))
+
+#endif // SAFE99_COMMAND_LIST_H
\ No newline at end of file
@@ -0,0 +1,87 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Raster.h"
+#include "Depth.h"
+
+#define DEPTH_BUFFER_ALIGN 64
+
+bool __stdcall DepthBufferInit(DEPTH_BUFFER* pDepthBuffer, const DEPTH_FORMAT format, const uint_t pitch, const uint_t height)
+{
+    ASSERT(pDepthBuffer != NULL, "pDepthBuffer is NULL");
+    ASSERT(format != DEPTH_FORMAT_NONE, "Invalid depth format");
+
+    memset(pDepthBuffer, 0, sizeof(DEPTH_BUFFER));
+
+    const uint_t numBlocksX = (pitch + HIZ_BLOCK_SIZE - 1) / HIZ_BLOCK_SIZE;
+    const uint_t numBlocksY = (height + HIZ_BLOCK_SIZE - 1) / HIZ_BLOCK_SIZE;
+
+    pDepthBuffer->pDepths = ALIGNED_MALLOC(4 * pitch * height, DEPTH_BUFFER_ALIGN);
+    pDepthBuffer->pHiZBlocks = (HIZ_BLOCK*)malloc(sizeof(HIZ_BLOCK) * numBlocksX * numBlocksY);
+    if (pDepthBuffer->pDepths == NULL || pDepthBuffer->pHiZBlocks == NULL)
+    {
+        DepthBufferRelease(pDepthBuffer);
+        return false;
+    }
+
+    pDepthBuffer->Format = format;
+    pDepthBuffer->NumBlocksX = numBlocksX;
+    pDepthBuffer->NumBlocksY = numBlocksY;
+
+    const CLIP_RECT rect = { 0, 0, (int)pitch - 1, (int)height - 1 };
+    ClearDepthRect(pDepthBuffer, pitch, &rect, 1.0f);
+
+    return true;
+}
+
+void __stdcall DepthBufferRelease(DEPTH_BUFFER* pDepthBuffer)
+{
+    ASSERT(pDepthBuffer != NULL, "pDepthBuffer is NULL");
+
+    SAFE_ALIGNED_FREE(pDepthBuffer->pDepths);
+    SAFE_FREE(pDepthBuffer->pHiZBlocks);
+    pDepthBuffer->Format = DEPTH_FORMAT_NONE;
+    pDepthBuffer->NumBlocksX = 0;
+    pDepthBuffer->NumBlocksY = 0;
+}
+
+void __stdcall ClearDepthRect(DEPTH_BUFFER* pDepthBuffer, const uint_t pitch, const CLIP_RECT* pRect, const float depth)
+{
+    ASSERT(pDepthBuffer != NULL, "pDepthBuffer is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT((pRect->MinX % HIZ_BLOCK_SIZE) == 0 && (pRect->MinY % HIZ_BLOCK_SIZE) == 0, "pRect is not aligned");
+
+    FillRect((uint32_t*)pDepthBuffer->pDepths, pitch, pRect, EncodeDepth(pDepthBuffer->Format, depth));
+
+    const int maxBlockX = pRect->MaxX / HIZ_BLOCK_SIZE;
+    const int maxBlockY = pRect->MaxY / HIZ_BLOCK_SIZE;
+    for (int blockY = pRect->MinY / HIZ_BLOCK_SIZE; blockY <= maxBlockY; ++blockY)
+    {
+        HIZ_BLOCK* pBlock = pDepthBuffer->pHiZBlocks + blockY * pDepthBuffer->NumBlocksX + pRect->MinX / HIZ_BLOCK_SIZE;
+        for (int blockX = pRect->MinX / HIZ_BLOCK_SIZE; blockX <= maxBlockX; ++blockX)
+        {
+            pBlock->MinDepth = depth;
+            pBlock->MaxDepth = depth;
+            ++pBlock;
+        }
+    }
+}
+
+uint32_t __stdcall EncodeDepth(const DEPTH_FORMAT format, const float depth)
+{
+    if (format == DEPTH_FORMAT_D24_UNORM)
+    {
+        // 래스터라이저의 _mm_cvtps_epi32와 같은 반올림을 사용
+        const __m128 clamped = _mm_min_ss(_mm_max_ss(_mm_set_ss(depth), _mm_setzero_ps()), _mm_set_ss(1.0f));
+        return (uint32_t)_mm_cvtss_si32(_mm_mul_ss(clamped, _mm_set_ss((float)D24_MAX_VALUE)));
+    }
+
+    uint32_t bits;
+    memcpy(&bits, &depth, sizeof(bits));
+    return bits;
+}
\ No newline at end of file
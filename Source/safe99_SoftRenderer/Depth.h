@@ -0,0 +1,41 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 깊이 버퍼와 HIZ_BLOCK_SIZE x HIZ_BLOCK_SIZE 블록 단위 최소/최대 깊이(Hi-Z)
+// 깊이 테스트는 LESS, 통과하면 깊이를 씀
+
+#ifndef SAFE99_DEPTH_H
+#define SAFE99_DEPTH_H
+
+#define HIZ_BLOCK_SIZE  8
+#define D24_MAX_VALUE   0xffffff
+
+// 블록 안에서 화면에 보이는 픽셀 깊이의 보수적인 범위
+typedef struct HIZ_BLOCK
+{
+    float   MinDepth;
+    float   MaxDepth;
+} HIZ_BLOCK;
+
+typedef struct DEPTH_BUFFER
+{
+    DEPTH_FORMAT    Format;
+
+    // D32_FLOAT는 float, D24_UNORM은 하위 24비트를 쓰는 uint32_t, 피치는 색상 버퍼와 같음
+    void*           pDepths;
+
+    HIZ_BLOCK*      pHiZBlocks;
+    uint_t          NumBlocksX;
+    uint_t          NumBlocksY;
+} DEPTH_BUFFER;
+
+bool        __stdcall   DepthBufferInit(DEPTH_BUFFER* pDepthBuffer, const DEPTH_FORMAT format, const uint_t pitch, const uint_t height);
+void        __stdcall   DepthBufferRelease(DEPTH_BUFFER* pDepthBuffer);
+
+// pRect는 HIZ_BLOCK_SIZE 경계에 맞춰져 있거나 버퍼 끝까지여야 함
+void        __stdcall   ClearDepthRect(DEPTH_BUFFER* pDepthBuffer, const uint_t pitch, const CLIP_RECT* pRect, const float depth);
+
+// 깊이 버퍼에 저장되는 비트 패턴, D24_UNORM은 [0, 1]로 자른 후 가장 가까운 값으로 반올림
+uint32_t    __stdcall   EncodeDepth(const DEPTH_FORMAT format, const float depth);
+
+#endif // SAFE99_DEPTH_H
\ No newline at end of file
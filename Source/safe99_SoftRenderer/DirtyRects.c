@@ -0,0 +1,92 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "DirtyRects.h"
+
+static int64_t getArea(const CLIP_RECT* pRect)
+{
+    return (int64_t)(pRect->MaxX - pRect->MinX + 1) * (pRect->MaxY - pRect->MinY + 1);
+}
+
+static void getUnionRect(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1, CLIP_RECT* pOutRect)
+{
+    pOutRect->MinX = MIN(pRect0->MinX, pRect1->MinX);
+    pOutRect->MinY = MIN(pRect0->MinY, pRect1->MinY);
+    pOutRect->MaxX = MAX(pRect0->MaxX, pRect1->MaxX);
+    pOutRect->MaxY = MAX(pRect0->MaxY, pRect1->MaxY);
+}
+
+// 맞닿은 경우도 포함
+static bool isTouching(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1)
+{
+    return pRect0->MinX <= pRect1->MaxX + 1 && pRect1->MinX <= pRect0->MaxX + 1
+        && pRect0->MinY <= pRect1->MaxY + 1 && pRect1->MinY <= pRect0->MaxY + 1;
+}
+
+static void removeRect(DIRTY_RECTS* pDirtyRects, const uint_t index)
+{
+    pDirtyRects->Rects[index] = pDirtyRects->Rects[--pDirtyRects->NumRects];
+}
+
+void __stdcall DirtyRectsReset(DIRTY_RECTS* pDirtyRects)
+{
+    ASSERT(pDirtyRects != NULL, "pDirtyRects is NULL");
+
+    pDirtyRects->NumRects = 0;
+}
+
+void __stdcall DirtyRectsAdd(DIRTY_RECTS* pDirtyRects, const CLIP_RECT* pRect)
+{
+    ASSERT(pDirtyRects != NULL, "pDirtyRects is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT(pRect->MinX <= pRect->MaxX && pRect->MinY <= pRect->MaxY, "Invalid rect");
+
+    CLIP_RECT rect = *pRect;
+
+    bool bMerged;
+    do
+    {
+        // 합친 사각형이 다른 사각형과 다시 겹칠 수 있으므로 합칠 것이 없을 때까지 반복
+        bMerged = false;
+        for (uint_t i = 0; i < pDirtyRects->NumRects; ++i)
+        {
+            if (isTouching(&pDirtyRects->Rects[i], &rect))
+            {
+                getUnionRect(&pDirtyRects->Rects[i], &rect, &rect);
+                removeRect(pDirtyRects, i);
+                bMerged = true;
+                break;
+            }
+        }
+
+        if (bMerged || pDirtyRects->NumRects < MAX_DIRTY_RECTS)
+        {
+            continue;
+        }
+
+        uint_t bestIndex = 0;
+        int64_t bestGrowth = INT64_MAX;
+        for (uint_t i = 0; i < pDirtyRects->NumRects; ++i)
+        {
+            CLIP_RECT unionRect;
+            getUnionRect(&pDirtyRects->Rects[i], &rect, &unionRect);
+
+            const int64_t growth = getArea(&unionRect) - getArea(&pDirtyRects->Rects[i]) - getArea(&rect);
+            if (growth < bestGrowth)
+            {
+                bestGrowth = growth;
+                bestIndex = i;
+            }
+        }
+
+        getUnionRect(&pDirtyRects->Rects[bestIndex], &rect, &rect);
+        removeRect(pDirtyRects, bestIndex);
+        bMerged = true;
+    } while (bMerged);
+
+    pDirtyRects->Rects[pDirtyRects->NumRects++] = rect;
+}
\ No newline at end of file
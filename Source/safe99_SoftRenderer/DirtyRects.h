@@ -0,0 +1,23 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 프레임 동안 바뀐 영역을 최대 MAX_DIRTY_RECTS개의 사각형으로 모음
+// 겹치거나 맞닿은 사각형은 합치고, 개수가 넘치면 넓이가 가장 적게 늘어나는 쌍을 합침
+
+#ifndef SAFE99_DIRTY_RECTS_H
+#define SAFE99_DIRTY_RECTS_H
+
+#define MAX_DIRTY_RECTS 8
+
+typedef struct DIRTY_RECTS
+{
+    CLIP_RECT   Rects[MAX_DIRTY_RECTS];
+    uint_t      NumRects;
+} DIRTY_RECTS;
+
+void    __stdcall   DirtyRectsReset(DIRTY_RECTS* pDirtyRects);
+
+// pRect는 화면 안으로 클리핑된 상태여야 함
+void    __stdcall   DirtyRectsAdd(DIRTY_RECTS* pDirtyRects, const CLIP_RECT* pRect);
+
+#endif // SAFE99_DIRTY_RECTS_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "DynamicResolution.h"
+
+#include <math.h>
+
+// 배율을 이 단위로 맞춰서 서피스 크기가 매 프레임 조금씩 바뀌지 않도록 함
+#define SCALE_STEP (1.0f / 64.0f)
+
+#define FRAME_TIME_SMOOTHING 0.25f
+
+// 목표보다 조금 낮은 시간에 맞춰 측정 오차로 다시 넘지 않도록 함
+#define TARGET_HEADROOM 0.9f
+
+// 평균이 목표의 이 비율 아래로 GROW_DELAY_FRAMES 프레임 이어지면 늘림
+#define GROW_THRESHOLD 0.75f
+#define GROW_DELAY_FRAMES 8
+
+// 한 번에 바꾸는 배율의 한계, 비용 추정이 틀려도 크게 벗어나지 않음
+#define MAX_GROW_RATIO 1.1f
+#define MIN_SHRINK_RATIO 0.7f
+
+void __stdcall DynamicResolutionInit(DYNAMIC_RESOLUTION* pResolution, const float minScale, const float maxScale, const float targetFrameTime)
+{
+    ASSERT(pResolution != NULL, "pResolution is NULL");
+    ASSERT(minScale > 0.0f && minScale <= maxScale, "Invalid scale range");
+    ASSERT(targetFrameTime > 0.0f, "targetFrameTime is 0");
+
+    pResolution->MinScale = minScale;
+    pResolution->MaxScale = maxScale;
+    pResolution->TargetFrameTime = targetFrameTime;
+    pResolution->Scale = maxScale;
+    pResolution->FrameTimeAverage = 0.0f;
+    pResolution->NumFramesUnderBudget = 0;
+}
+
+bool __stdcall DynamicResolutionUpdate(DYNAMIC_RESOLUTION* pResolution, const float frameTime)
+{
+    ASSERT(pResolution != NULL, "pResolution is NULL");
+
+    float average = pResolution->FrameTimeAverage;
+    average = (average == 0.0f) ? frameTime : average + (frameTime - average) * FRAME_TIME_SMOOTHING;
+    pResolution->FrameTimeAverage = average;
+
+    if (average <= 0.0f)
+    {
+        return false;
+    }
+
+    const float target = pResolution->TargetFrameTime;
+    const float scale = pResolution->Scale;
+
+    // 비용은 픽셀 수에 비례하므로 시간 비의 제곱근만큼 배율을 바꿈
+    const float fitScale = scale * sqrtf(target * TARGET_HEADROOM / average);
+
+    float newScale = scale;
+    if (average > target)
+    {
+        newScale = MAX(fitScale, scale * MIN_SHRINK_RATIO);
+        pResolution->NumFramesUnderBudget = 0;
+    }
+    else if (average < target * GROW_THRESHOLD)
+    {
+        if (++pResolution->NumFramesUnderBudget < GROW_DELAY_FRAMES)
+        {
+            return false;
+        }
+
+        newScale = MIN(fitScale, scale * MAX_GROW_RATIO);
+        pResolution->NumFramesUnderBudget = 0;
+    }
+    else
+    {
+        pResolution->NumFramesUnderBudget = 0;
+        return false;
+    }
+
+    newScale = floorf(newScale / SCALE_STEP) * SCALE_STEP;
+    newScale = MIN(MAX(newScale, pResolution->MinScale), pResolution->MaxScale);
+    if (newScale == scale)
+    {
+        return false;
+    }
+
+    // 다음 프레임부터 바뀐 픽셀 수로 잰 시간과 섞이도록 평균을 미리 고침
+    pResolution->FrameTimeAverage = average * (newScale * newScale) / (scale * scale);
+    pResolution->Scale = newScale;
+
+    return true;
+}
\ No newline at end of file
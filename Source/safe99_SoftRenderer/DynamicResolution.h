@@ -0,0 +1,29 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 측정한 프레임 시간으로 다음 프레임의 해상도 배율을 정함
+// 그리기 비용이 픽셀 수(배율의 제곱)에 비례한다고 보고 목표 시간에 맞는 배율을 구함
+// 목표를 넘으면 바로 줄이고 여유가 몇 프레임 이어질 때만 조금씩 늘려서 배율이 오가지 않도록 함
+
+#ifndef SAFE99_DYNAMIC_RESOLUTION_H
+#define SAFE99_DYNAMIC_RESOLUTION_H
+
+typedef struct DYNAMIC_RESOLUTION
+{
+    float   MinScale;
+    float   MaxScale;
+    float   TargetFrameTime;        // 초
+    float   Scale;
+
+    // 프레임 시간의 이동 평균, 배율을 바꾸면 픽셀 수 비율로 고쳐 둠, 0이면 아직 측정하지 않음
+    float   FrameTimeAverage;
+    uint_t  NumFramesUnderBudget;
+} DYNAMIC_RESOLUTION;
+
+// maxScale에서 시작
+void    __stdcall   DynamicResolutionInit(DYNAMIC_RESOLUTION* pResolution, const float minScale, const float maxScale, const float targetFrameTime);
+
+// 이번 프레임 시간(초)을 반영해 다음 프레임 배율을 정함, 배율이 바뀌면 true
+bool    __stdcall   DynamicResolutionUpdate(DYNAMIC_RESOLUTION* pResolution, const float frameTime);
+
+#endif // SAFE99_DYNAMIC_RESOLUTION_H
\ No newline at end of file
@@ -8,8 +8,12 @@
 
 #include "safe99_Common/Platform.h"
 
-#include <Windows.h>
+#if defined(UW_PLATFORM_WIN)
+    #include <Windows.h>
+#endif // UW_PLATFORM_WIN
+
 #include <stdlib.h>
+#include <string.h>
 
 // safe99 library
 #if defined(PLATFORM_X64)
@@ -0,0 +1,144 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Raster.h"
+#include "TiledSurface.h"
+#include "FastClear.h"
+
+static void getTileRect(const FAST_CLEAR* pFastClear, const uint_t tileX, const uint_t tileY, CLIP_RECT* pOutRect)
+{
+    pOutRect->MinX = (int)(tileX * FAST_CLEAR_TILE_SIZE);
+    pOutRect->MinY = (int)(tileY * FAST_CLEAR_TILE_SIZE);
+    pOutRect->MaxX = MIN(pOutRect->MinX + FAST_CLEAR_TILE_SIZE - 1, (int)pFastClear->Pitch - 1);
+    pOutRect->MaxY = MIN(pOutRect->MinY + FAST_CLEAR_TILE_SIZE - 1, (int)pFastClear->Height - 1);
+}
+
+// pRect를 버퍼 안으로 자름, 겹치지 않으면 false
+static bool clipToBuffer(const FAST_CLEAR* pFastClear, const CLIP_RECT* pRect, CLIP_RECT* pOutRect)
+{
+    const CLIP_RECT bufferRect = { 0, 0, (int)pFastClear->Pitch - 1, (int)pFastClear->Height - 1 };
+    if (pRect == NULL)
+    {
+        *pOutRect = bufferRect;
+        return true;
+    }
+
+    return IntersectClipRect(pRect, &bufferRect, pOutRect);
+}
+
+bool __stdcall FastClearInit(FAST_CLEAR* pFastClear, const uint_t pitch, const uint_t height, const uint_t tiledHeight)
+{
+    ASSERT(pFastClear != NULL, "pFastClear is NULL");
+
+    memset(pFastClear, 0, sizeof(FAST_CLEAR));
+
+    const uint_t numTilesX = (pitch + FAST_CLEAR_TILE_SIZE - 1) / FAST_CLEAR_TILE_SIZE;
+    const uint_t numTilesY = (height + FAST_CLEAR_TILE_SIZE - 1) / FAST_CLEAR_TILE_SIZE;
+    pFastClear->pPendingTiles = (uint8_t*)malloc(numTilesX * numTilesY);
+    if (pFastClear->pPendingTiles == NULL)
+    {
+        return false;
+    }
+
+    memset(pFastClear->pPendingTiles, 0, numTilesX * numTilesY);
+    pFastClear->NumTilesX = numTilesX;
+    pFastClear->NumTilesY = numTilesY;
+    pFastClear->Pitch = pitch;
+    pFastClear->Height = height;
+    pFastClear->TiledHeight = tiledHeight;
+
+    return true;
+}
+
+void __stdcall FastClearRelease(FAST_CLEAR* pFastClear)
+{
+    ASSERT(pFastClear != NULL, "pFastClear is NULL");
+
+    SAFE_FREE(pFastClear->pPendingTiles);
+    pFastClear->NumPendingTiles = 0;
+    pFastClear->NumTilesX = 0;
+    pFastClear->NumTilesY = 0;
+}
+
+void __stdcall FastClearSet(FAST_CLEAR* pFastClear, const uint32_t argb)
+{
+    ASSERT(pFastClear != NULL, "pFastClear is NULL");
+
+    const uint_t numTiles = pFastClear->NumTilesX * pFastClear->NumTilesY;
+    memset(pFastClear->pPendingTiles, 1, numTiles);
+    pFastClear->NumPendingTiles = numTiles;
+    pFastClear->Argb = argb;
+}
+
+void __stdcall FastClearResolve(FAST_CLEAR* pFastClear, uint32_t* pBuffer, const CLIP_RECT* pRect)
+{
+    ASSERT(pFastClear != NULL, "pFastClear is NULL");
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+
+    CLIP_RECT rect;
+    if (pFastClear->NumPendingTiles == 0 || !clipToBuffer(pFastClear, pRect, &rect))
+    {
+        return;
+    }
+
+    for (uint_t tileY = (uint_t)rect.MinY / FAST_CLEAR_TILE_SIZE; tileY <= (uint_t)rect.MaxY / FAST_CLEAR_TILE_SIZE; ++tileY)
+    {
+        uint8_t* pPendingRow = pFastClear->pPendingTiles + tileY * pFastClear->NumTilesX;
+        for (uint_t tileX = (uint_t)rect.MinX / FAST_CLEAR_TILE_SIZE; tileX <= (uint_t)rect.MaxX / FAST_CLEAR_TILE_SIZE; ++tileX)
+        {
+            if (pPendingRow[tileX] == 0)
+            {
+                continue;
+            }
+
+            CLIP_RECT tileRect;
+            getTileRect(pFastClear, tileX, tileY, &tileRect);
+            FillSurfaceRect(pBuffer, pFastClear->Pitch, pFastClear->TiledHeight, &tileRect, pFastClear->Argb);
+
+            pPendingRow[tileX] = 0;
+            --pFastClear->NumPendingTiles;
+        }
+    }
+}
+
+void __stdcall FastClearDiscard(FAST_CLEAR* pFastClear, uint32_t* pBuffer, const CLIP_RECT* pRect)
+{
+    ASSERT(pFastClear != NULL, "pFastClear is NULL");
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    CLIP_RECT rect;
+    if (pFastClear->NumPendingTiles == 0 || !clipToBuffer(pFastClear, pRect, &rect))
+    {
+        return;
+    }
+
+    for (uint_t tileY = (uint_t)rect.MinY / FAST_CLEAR_TILE_SIZE; tileY <= (uint_t)rect.MaxY / FAST_CLEAR_TILE_SIZE; ++tileY)
+    {
+        uint8_t* pPendingRow = pFastClear->pPendingTiles + tileY * pFastClear->NumTilesX;
+        for (uint_t tileX = (uint_t)rect.MinX / FAST_CLEAR_TILE_SIZE; tileX <= (uint_t)rect.MaxX / FAST_CLEAR_TILE_SIZE; ++tileX)
+        {
+            if (pPendingRow[tileX] == 0)
+            {
+                continue;
+            }
+
+            CLIP_RECT tileRect;
+            getTileRect(pFastClear, tileX, tileY, &tileRect);
+            if (tileRect.MinX < rect.MinX || tileRect.MinY < rect.MinY
+                || tileRect.MaxX > rect.MaxX || tileRect.MaxY > rect.MaxY)
+            {
+                FillSurfaceRect(pBuffer, pFastClear->Pitch, pFastClear->TiledHeight, &tileRect, pFastClear->Argb);
+            }
+
+            pPendingRow[tileX] = 0;
+            --pFastClear->NumPendingTiles;
+        }
+    }
+}
\ No newline at end of file
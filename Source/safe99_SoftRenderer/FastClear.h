@@ -0,0 +1,44 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 즉시 그리기 모드의 지연 Clear
+// Clear는 타일마다 색만 기록하고 실제 채우기는 그 타일에 처음 쓸 때나 출력 직전에 함
+// 불투명하게 타일 전체를 덮는 그리기는 채우기 자체를 건너뜀
+
+#ifndef SAFE99_FAST_CLEAR_H
+#define SAFE99_FAST_CLEAR_H
+
+#define FAST_CLEAR_TILE_SIZE 64
+
+typedef struct FAST_CLEAR
+{
+    // 0이 아니면 아직 채우지 않은 타일
+    uint8_t*    pPendingTiles;
+    uint_t      NumPendingTiles;
+    uint_t      NumTilesX;
+    uint_t      NumTilesY;
+
+    // 패딩 열까지 채움
+    uint_t      Pitch;
+    uint_t      Height;
+
+    // 0이면 선형 배치
+    uint_t      TiledHeight;
+
+    uint32_t    Argb;
+} FAST_CLEAR;
+
+// tiledHeight가 0이 아니면 버퍼가 타일 배치 (TiledSurface.h)
+bool    __stdcall   FastClearInit(FAST_CLEAR* pFastClear, const uint_t pitch, const uint_t height, const uint_t tiledHeight);
+void    __stdcall   FastClearRelease(FAST_CLEAR* pFastClear);
+
+// 이전에 기록된 Clear는 버려짐
+void    __stdcall   FastClearSet(FAST_CLEAR* pFastClear, const uint32_t argb);
+
+// pRect(포함)와 겹치는 타일을 채움, pRect가 NULL이면 전체
+void    __stdcall   FastClearResolve(FAST_CLEAR* pFastClear, uint32_t* pBuffer, const CLIP_RECT* pRect);
+
+// pRect(포함)를 불투명하게 덮어쓰기 직전에 호출, 완전히 덮이는 타일은 채우지 않고 일부만 덮이는 타일은 채움
+void    __stdcall   FastClearDiscard(FAST_CLEAR* pFastClear, uint32_t* pBuffer, const CLIP_RECT* pRect);
+
+#endif // SAFE99_FAST_CLEAR_H
\ No newline at end of file
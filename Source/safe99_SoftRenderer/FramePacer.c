@@ -0,0 +1,231 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+// 엄격한 C 모드에서도 clock_nanosleep, TIMER_ABSTIME이 선언되도록 시스템 헤더보다 먼저 정의
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200112L
+#endif // _WIN32
+
+#include "Precompiled.h"
+
+#include <immintrin.h>
+#include <math.h>
+
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "FramePacer.h"
+
+#if defined(UW_PLATFORM_WIN)
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif // CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#else
+    #include <errno.h>
+    #include <time.h>
+#endif // UW_PLATFORM_WIN
+
+#define NS_PER_SECOND 1000000000ull
+
+#define INITIAL_SPIN_MARGIN_NS 1000000ull
+#define MIN_SPIN_MARGIN_NS 50000ull
+
+static uint64_t getTimeNs(void)
+{
+#if defined(UW_PLATFORM_WIN)
+    static LARGE_INTEGER s_frequency;
+    if (s_frequency.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&s_frequency);
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    // 곱셈이 넘치지 않도록 초와 나머지를 나눠서 변환
+    const uint64_t frequency = (uint64_t)s_frequency.QuadPart;
+    const uint64_t seconds = (uint64_t)counter.QuadPart / frequency;
+    const uint64_t remainder = (uint64_t)counter.QuadPart % frequency;
+    return seconds * NS_PER_SECOND + remainder * NS_PER_SECOND / frequency;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_SECOND + (uint64_t)ts.tv_nsec;
+#endif // UW_PLATFORM_WIN
+}
+
+static void sleepUntil(FRAME_PACER* pPacer, const uint64_t deadline)
+{
+#if defined(UW_PLATFORM_WIN)
+    const uint64_t now = getTimeNs();
+    if (now >= deadline)
+    {
+        return;
+    }
+
+    if (pPacer->hTimer != NULL)
+    {
+        // 음수는 100ns 단위 상대 시간
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -(LONGLONG)((deadline - now) / 100);
+        if (SetWaitableTimer((HANDLE)pPacer->hTimer, &dueTime, 0, NULL, NULL, FALSE))
+        {
+            WaitForSingleObject((HANDLE)pPacer->hTimer, INFINITE);
+            return;
+        }
+    }
+
+    Sleep((DWORD)((deadline - now) / 1000000));
+#else
+    (void)pPacer;
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)(deadline / NS_PER_SECOND);
+    ts.tv_nsec = (long)(deadline % NS_PER_SECOND);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+#endif // UW_PLATFORM_WIN
+}
+
+// 최근 대기 지연의 두 배를 스핀 구간으로 씀, 한 프레임보다 길면 매번 스핀하는 것과 같음
+static void updateSpinMargin(FRAME_PACER* pPacer, const uint64_t sleepOvershoot)
+{
+    pPacer->SleepOvershootAverage += ((double)sleepOvershoot - pPacer->SleepOvershootAverage) * 0.125;
+
+    const uint64_t margin = (uint64_t)(pPacer->SleepOvershootAverage * 2.0);
+    pPacer->SpinMargin = MIN(MAX(margin, MIN_SPIN_MARGIN_NS), pPacer->FrameInterval);
+}
+
+bool __stdcall FramePacerInit(FRAME_PACER* pPacer)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+
+    memset(pPacer, 0, sizeof(FRAME_PACER));
+
+#if defined(UW_PLATFORM_WIN)
+    // 고해상도 타이머를 지원하지 않는 윈도우에서는 Sleep으로 대신함
+    pPacer->hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif // UW_PLATFORM_WIN
+
+    pPacer->SpinMargin = INITIAL_SPIN_MARGIN_NS;
+    pPacer->SleepOvershootAverage = (double)INITIAL_SPIN_MARGIN_NS * 0.5;
+
+    return true;
+}
+
+void __stdcall FramePacerRelease(FRAME_PACER* pPacer)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+
+#if defined(UW_PLATFORM_WIN)
+    if (pPacer->hTimer != NULL)
+    {
+        CloseHandle((HANDLE)pPacer->hTimer);
+        pPacer->hTimer = NULL;
+    }
+#endif // UW_PLATFORM_WIN
+}
+
+void __stdcall FramePacerSetInterval(FRAME_PACER* pPacer, const uint64_t intervalNs)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+
+    pPacer->FrameInterval = intervalNs;
+    pPacer->NextDeadline = 0;
+    if (intervalNs > 0)
+    {
+        pPacer->SpinMargin = MIN(pPacer->SpinMargin, intervalNs);
+    }
+
+    FramePacerResetStats(pPacer);
+}
+
+float __stdcall FramePacerWait(FRAME_PACER* pPacer)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+
+    uint64_t now = getTimeNs();
+    if (pPacer->FrameInterval > 0)
+    {
+        uint64_t deadline = pPacer->NextDeadline;
+        if (deadline == 0)
+        {
+            deadline = (pPacer->PrevFrameEnd != 0) ? pPacer->PrevFrameEnd + pPacer->FrameInterval : now;
+        }
+
+        if (deadline + pPacer->FrameInterval < now)
+        {
+            deadline = now;
+        }
+
+        if (now + pPacer->SpinMargin < deadline)
+        {
+            const uint64_t wakeTime = deadline - pPacer->SpinMargin;
+            sleepUntil(pPacer, wakeTime);
+
+            now = getTimeNs();
+            updateSpinMargin(pPacer, (now > wakeTime) ? now - wakeTime : 0);
+        }
+
+        while (now < deadline)
+        {
+            _mm_pause();
+            now = getTimeNs();
+        }
+
+        const uint64_t overshoot = now - deadline;
+        pPacer->OvershootSum += (double)overshoot;
+        pPacer->MaxOvershoot = MAX(pPacer->MaxOvershoot, overshoot);
+        ++pPacer->NumWaits;
+
+        pPacer->NextDeadline = deadline + pPacer->FrameInterval;
+    }
+
+    const uint64_t prevFrameEnd = pPacer->PrevFrameEnd;
+    pPacer->PrevFrameEnd = now;
+    if (prevFrameEnd == 0)
+    {
+        return 0.0f;
+    }
+
+    // Welford 방식으로 평균과 분산을 누적
+    const double frameTime = (double)(now - prevFrameEnd);
+    ++pPacer->NumFrames;
+
+    const double delta = frameTime - pPacer->FrameTimeMean;
+    pPacer->FrameTimeMean += delta / (double)pPacer->NumFrames;
+    pPacer->FrameTimeM2 += delta * (frameTime - pPacer->FrameTimeMean);
+
+    return (float)(frameTime / (double)NS_PER_SECOND);
+}
+
+void __stdcall FramePacerGetStats(const FRAME_PACER* pPacer, FRAME_PACING_STATS* pOutStats)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+    ASSERT(pOutStats != NULL, "pOutStats is NULL");
+
+    const double secondsPerNs = 1.0 / (double)NS_PER_SECOND;
+
+    pOutStats->NumFrames = pPacer->NumFrames;
+    pOutStats->AverageFrameTime = (float)(pPacer->FrameTimeMean * secondsPerNs);
+    pOutStats->Jitter = (pPacer->NumFrames > 1)
+        ? (float)(sqrt(pPacer->FrameTimeM2 / (double)(pPacer->NumFrames - 1)) * secondsPerNs) : 0.0f;
+    pOutStats->AverageOvershoot = (pPacer->NumWaits > 0)
+        ? (float)(pPacer->OvershootSum / (double)pPacer->NumWaits * secondsPerNs) : 0.0f;
+    pOutStats->MaxOvershoot = (float)((double)pPacer->MaxOvershoot * secondsPerNs);
+    pOutStats->SleepOvershoot = (float)(pPacer->SleepOvershootAverage * secondsPerNs);
+    pOutStats->SpinMargin = (float)((double)pPacer->SpinMargin * secondsPerNs);
+}
+
+void __stdcall FramePacerResetStats(FRAME_PACER* pPacer)
+{
+    ASSERT(pPacer != NULL, "pPacer is NULL");
+
+    pPacer->NumFrames = 0;
+    pPacer->FrameTimeMean = 0.0;
+    pPacer->FrameTimeM2 = 0.0;
+    pPacer->NumWaits = 0;
+    pPacer->OvershootSum = 0.0;
+    pPacer->MaxOvershoot = 0;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 남은 프레임 시간의 대부분은 OS 타이머로 자고 마지막 구간만 스핀해서 목표 시각을 맞춤
+// 스핀 구간 길이는 측정한 OS 대기 지연에 맞춰 조절
+
+#ifndef SAFE99_FRAME_PACER_H
+#define SAFE99_FRAME_PACER_H
+
+typedef struct FRAME_PACER
+{
+    void*       hTimer;             // Windows 고해상도 대기 타이머, 없으면 Sleep
+
+    // 나노초 단위
+    uint64_t    FrameInterval;      // 0이면 기다리지 않음
+    uint64_t    NextDeadline;
+    uint64_t    PrevFrameEnd;
+    uint64_t    SpinMargin;
+    double      SleepOvershootAverage;
+
+    // 통계
+    uint_t      NumFrames;
+    double      FrameTimeMean;
+    double      FrameTimeM2;        // 편차 제곱의 합
+    uint_t      NumWaits;
+    double      OvershootSum;
+    uint64_t    MaxOvershoot;
+} FRAME_PACER;
+
+bool    __stdcall   FramePacerInit(FRAME_PACER* pPacer);
+void    __stdcall   FramePacerRelease(FRAME_PACER* pPacer);
+
+// 0이면 제한 없음, 통계도 초기화
+void    __stdcall   FramePacerSetInterval(FRAME_PACER* pPacer, const uint64_t intervalNs);
+
+// 다음 목표 시각까지 기다린 뒤 직전 호출로부터 지난 시간(초)을 반환, 첫 호출은 0
+// 한 프레임 이상 늦으면 따라잡으려 하지 않고 지금부터 다시 셈
+float   __stdcall   FramePacerWait(FRAME_PACER* pPacer);
+
+void    __stdcall   FramePacerGetStats(const FRAME_PACER* pPacer, FRAME_PACING_STATS* pOutStats);
+void    __stdcall   FramePacerResetStats(FRAME_PACER* pPacer);
+
+#endif // SAFE99_FRAME_PACER_H
\ No newline at end of file
@@ -0,0 +1,373 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Raster.h"
+#include "PackedSurface.h"
+
+// 채우는 값을 32비트로 반복하고 가운데는 32비트 커널로 채움
+static void fillPackedSpan(void* pDest, const uint_t bytesPerPixel, const size_t count, const uint32_t color, const bool bStream)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    if (bytesPerPixel == 4)
+    {
+        bStream ? StreamFillSpan((uint32_t*)pDest, count, color) : FillSpan((uint32_t*)pDest, count, color);
+        return;
+    }
+
+    uint8_t* pBytes = (uint8_t*)pDest;
+    size_t numBytes = count * bytesPerPixel;
+    const uint32_t pattern = (bytesPerPixel == 2) ? (color & 0xffff) * 0x00010001u : (color & 0xff) * 0x01010101u;
+
+    // 픽셀 경계를 지키며 4바이트 정렬까지 앞부분을 채움 (16비트 버퍼는 항상 2바이트 정렬)
+    while (((uintptr_t)pBytes & 3) != 0 && numBytes > 0)
+    {
+        memcpy(pBytes, &pattern, bytesPerPixel);
+        pBytes += bytesPerPixel;
+        numBytes -= bytesPerPixel;
+    }
+
+    const size_t numWords = numBytes / 4;
+    if (numWords > 0)
+    {
+        bStream ? StreamFillSpan((uint32_t*)pBytes, numWords, pattern) : FillSpan((uint32_t*)pBytes, numWords, pattern);
+        pBytes += numWords * 4;
+        numBytes -= numWords * 4;
+    }
+
+    memcpy(pBytes, &pattern, numBytes);
+}
+
+static void storePixel(uint8_t* pPixel, const uint_t bytesPerPixel, const uint32_t color)
+{
+    if (bytesPerPixel == 2)
+    {
+        *(uint16_t*)pPixel = (uint16_t)color;
+    }
+    else if (bytesPerPixel == 1)
+    {
+        *pPixel = (uint8_t)color;
+    }
+    else
+    {
+        *(uint32_t*)pPixel = color;
+    }
+}
+
+uint_t __stdcall GetBytesPerPixel(const BACK_BUFFER_FORMAT format)
+{
+    switch (format)
+    {
+    case BACK_BUFFER_FORMAT_R5G6B5:
+        return 2;
+    case BACK_BUFFER_FORMAT_P8:
+        return 1;
+    case BACK_BUFFER_FORMAT_A8R8G8B8:
+    default:
+        return 4;
+    }
+}
+
+uint32_t __stdcall PackColor(const BACK_BUFFER_FORMAT format, const uint32_t argb)
+{
+    switch (format)
+    {
+    case BACK_BUFFER_FORMAT_R5G6B5:
+        return ((argb >> 8) & 0xf800) | ((argb >> 5) & 0x07e0) | ((argb >> 3) & 0x001f);
+    case BACK_BUFFER_FORMAT_P8:
+        return argb & 0xff;
+    case BACK_BUFFER_FORMAT_A8R8G8B8:
+    default:
+        return argb;
+    }
+}
+
+void __stdcall FillPackedSpan(void* pDest, const uint_t bytesPerPixel, const size_t count, const uint32_t color)
+{
+    fillPackedSpan(pDest, bytesPerPixel, count, color, false);
+}
+
+void __stdcall StreamFillPackedSpan(void* pDest, const uint_t bytesPerPixel, const size_t count, const uint32_t color)
+{
+    fillPackedSpan(pDest, bytesPerPixel, count, color, true);
+}
+
+void __stdcall RasterizePackedHorizontalLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                             const int x, const int y, const uint_t width, const uint32_t color)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    if (y < pScissor->MinY || y > pScissor->MaxY)
+    {
+        return;
+    }
+
+    const int startX = MAX(x, pScissor->MinX);
+    const int endX = (int)MIN((int64_t)x + width - 1, (int64_t)pScissor->MaxX);
+    if (startX > endX)
+    {
+        return;
+    }
+
+    uint8_t* pRow = (uint8_t*)pBuffer + ((size_t)y * pitch + startX) * bytesPerPixel;
+    FillPackedSpan(pRow, bytesPerPixel, (size_t)(endX - startX + 1), color);
+}
+
+void __stdcall RasterizePackedVerticalLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                           const int x, const int y, const uint_t height, const uint32_t color)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    if (x < pScissor->MinX || x > pScissor->MaxX)
+    {
+        return;
+    }
+
+    const int startY = MAX(y, pScissor->MinY);
+    const int endY = (int)MIN((int64_t)y + height - 1, (int64_t)pScissor->MaxY);
+
+    const size_t stride = (size_t)pitch * bytesPerPixel;
+    uint8_t* pPixel = (uint8_t*)pBuffer + ((size_t)startY * pitch + x) * bytesPerPixel;
+    for (int i = startY; i <= endY; ++i)
+    {
+        storePixel(pPixel, bytesPerPixel, color);
+        pPixel += stride;
+    }
+}
+
+// Raster.c의 rasterizeLineSteps, rasterizeLineRuns와 같은 방식으로 바이트 단위 보폭을 씀
+static void rasterizePackedLineSteps(uint8_t* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const LINE_STEPS* pLine,
+                                     const int firstStep, const int lastStep, const uint32_t color)
+{
+    const int64_t numSteps = pLine->NumSteps;
+    const int64_t minorDelta = pLine->MinorDelta;
+    const int minorCount = GetLineMinorCount(pLine, firstStep);
+    int64_t discriminant = 2 * (firstStep + 1) * minorDelta - numSteps - 2 * minorCount * numSteps;
+    const int64_t NEXT_DISCRIMINANT0 = 2 * minorDelta;
+    const int64_t NEXT_DISCRIMINANT1 = 2 * (minorDelta - numSteps);
+
+    const ptrdiff_t rowStride = (ptrdiff_t)pitch * bytesPerPixel;
+    const ptrdiff_t majorStride = pLine->bGradual ? pLine->MajorDir * (ptrdiff_t)bytesPerPixel : pLine->MajorDir * rowStride;
+    const ptrdiff_t minorStride = pLine->bGradual ? pLine->MinorDir * rowStride : pLine->MinorDir * (ptrdiff_t)bytesPerPixel;
+
+    int x;
+    int y;
+    GetLineStepPoint(pLine, firstStep, &x, &y);
+    uint8_t* pPixel = pBuffer + ((size_t)y * pitch + x) * bytesPerPixel;
+
+    for (int i = firstStep; i <= lastStep; ++i)
+    {
+        storePixel(pPixel, bytesPerPixel, color);
+
+        if (discriminant < 0)
+        {
+            discriminant += NEXT_DISCRIMINANT0;
+        }
+        else
+        {
+            discriminant += NEXT_DISCRIMINANT1;
+            pPixel += minorStride;
+        }
+
+        pPixel += majorStride;
+    }
+}
+
+static void rasterizePackedLineRuns(uint8_t* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const LINE_STEPS* pLine,
+                                    const int firstStep, const int lastStep, const uint32_t color)
+{
+    ASSERT(pLine->bGradual, "Line is not gradual");
+
+    const int64_t numSteps = pLine->NumSteps;
+    const int64_t minorDelta = pLine->MinorDelta;
+    const int64_t denominator = 2 * minorDelta;
+
+    int64_t runEndQuotient = numSteps;
+    int64_t runEndRemainder = 0;
+    int64_t quotientStep = 0;
+    int64_t remainderStep = 0;
+    if (minorDelta > 0)
+    {
+        const int64_t numerator = 2 * numSteps * (GetLineMinorCount(pLine, firstStep) + 1) - numSteps;
+        runEndQuotient = numerator / denominator;
+        runEndRemainder = numerator % denominator;
+        quotientStep = (2 * numSteps) / denominator;
+        remainderStep = (2 * numSteps) % denominator;
+    }
+
+    int x;
+    int y;
+    GetLineStepPoint(pLine, firstStep, &x, &y);
+    uint8_t* pRow = pBuffer + (size_t)y * pitch * bytesPerPixel;
+    const ptrdiff_t rowStride = pLine->MinorDir * (ptrdiff_t)pitch * bytesPerPixel;
+
+    int step = firstStep;
+    while (step <= lastStep)
+    {
+        const int64_t runEnd = runEndQuotient + (runEndRemainder > 0) - 1;
+        const int runLength = (int)(MIN(runEnd, (int64_t)lastStep) - step + 1);
+
+        const int startX = (pLine->MajorDir > 0) ? x : x - (runLength - 1);
+        FillPackedSpan(pRow + (size_t)startX * bytesPerPixel, bytesPerPixel, (size_t)runLength, color);
+
+        x += pLine->MajorDir * runLength;
+        pRow += rowStride;
+        step += runLength;
+
+        runEndQuotient += quotientStep;
+        runEndRemainder += remainderStep;
+        if (runEndRemainder >= denominator)
+        {
+            runEndRemainder -= denominator;
+            ++runEndQuotient;
+        }
+    }
+}
+
+void __stdcall RasterizePackedLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                   const int x0, const int y0, const int x1, const int y1, const uint32_t color)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    LINE_STEPS line;
+    InitLineSteps(&line, x0, y0, x1, y1);
+
+    int firstStep;
+    int lastStep;
+    if (!ClipLine(pScissor, &line, &firstStep, &lastStep))
+    {
+        return;
+    }
+
+    if (line.bGradual && line.NumSteps >= (int64_t)MIN_LINE_SPAN_LENGTH * line.MinorDelta)
+    {
+        rasterizePackedLineRuns((uint8_t*)pBuffer, pitch, bytesPerPixel, &line, firstStep, lastStep, color);
+    }
+    else
+    {
+        rasterizePackedLineSteps((uint8_t*)pBuffer, pitch, bytesPerPixel, &line, firstStep, lastStep, color);
+    }
+}
+
+void __stdcall RasterizePackedBitmap(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                     const int x, const int y, const uint_t width, const uint_t height,
+                                     const void* pBitmap, const uint_t bitmapPitch)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    const int startX = MAX(x, pScissor->MinX);
+    const int startY = MAX(y, pScissor->MinY);
+    const int endX = (int)MIN((int64_t)x + width - 1, (int64_t)pScissor->MaxX);
+    const int endY = (int)MIN((int64_t)y + height - 1, (int64_t)pScissor->MaxY);
+    if (startX > endX || startY > endY)
+    {
+        return;
+    }
+
+    // 행 복사는 CRT memcpy가 명령어 집합별로 이미 최적화되어 있으므로 그대로 씀
+    const size_t rowSize = (size_t)(endX - startX + 1) * bytesPerPixel;
+    const size_t srcStride = (size_t)bitmapPitch * bytesPerPixel;
+    const size_t destStride = (size_t)pitch * bytesPerPixel;
+    const uint8_t* pSrc = (const uint8_t*)pBitmap + (size_t)(startY - y) * srcStride + (size_t)(startX - x) * bytesPerPixel;
+    uint8_t* pDest = (uint8_t*)pBuffer + (size_t)startY * destStride + (size_t)startX * bytesPerPixel;
+    for (int i = startY; i <= endY; ++i)
+    {
+        memcpy(pDest, pSrc, rowSize);
+        pDest += destStride;
+        pSrc += srcStride;
+    }
+}
+
+// 5, 6비트 채널은 상위 비트를 하위에 반복해서 0 ~ 255 전체 범위로 늘림
+static uint32_t expandR5G6B5(const uint32_t pixel)
+{
+    return 0xff000000u
+        | ((pixel & 0xf800) << 8) | ((pixel & 0xe000) << 3)
+        | ((pixel & 0x07e0) << 5) | ((pixel & 0x0600) >> 1)
+        | ((pixel & 0x001f) << 3) | ((pixel & 0x001c) >> 2);
+}
+
+// 16비트 그대로 채널을 상위 비트에 두고 mulhi로 비트를 반복한 후 GB, AR 쌍을 섞어 8픽셀을 만듦
+// (c << 11) * 0x108 >> 16 = (c << 3) | (c >> 2), (g << 5) * 0x2080 >> 16 = (g << 2) | (g >> 4)
+static void expandR5G6B5Span(uint32_t* pDest, const uint16_t* pSrc, const size_t count)
+{
+    const __m128i RED_MASK = _mm_set1_epi16((short)0xf800);
+    const __m128i GREEN_MASK = _mm_set1_epi16(0x07e0);
+    const __m128i EXPAND5 = _mm_set1_epi16(0x0108);
+    const __m128i EXPAND6 = _mm_set1_epi16(0x2080);
+    const __m128i ALPHA = _mm_set1_epi16((short)0xff00);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(pSrc + i));
+        const __m128i red = _mm_mulhi_epu16(_mm_and_si128(pixels, RED_MASK), EXPAND5);
+        const __m128i green = _mm_mulhi_epu16(_mm_and_si128(pixels, GREEN_MASK), EXPAND6);
+        const __m128i blue = _mm_mulhi_epu16(_mm_slli_epi16(pixels, 11), EXPAND5);
+
+        const __m128i greenBlue = _mm_or_si128(blue, _mm_slli_epi16(green, 8));
+        const __m128i alphaRed = _mm_or_si128(red, ALPHA);
+        _mm_storeu_si128((__m128i*)(pDest + i), _mm_unpacklo_epi16(greenBlue, alphaRed));
+        _mm_storeu_si128((__m128i*)(pDest + i + 4), _mm_unpackhi_epi16(greenBlue, alphaRed));
+    }
+
+    for (; i < count; ++i)
+    {
+        pDest[i] = expandR5G6B5(pSrc[i]);
+    }
+}
+
+// 팔레트 조회는 SSE에 gather가 없으므로 스칼라로 풀어서 씀
+static void expandP8Span(uint32_t* pDest, const uint8_t* pSrc, const size_t count, const uint32_t* pPalette)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        pDest[i] = pPalette[pSrc[i]];
+        pDest[i + 1] = pPalette[pSrc[i + 1]];
+        pDest[i + 2] = pPalette[pSrc[i + 2]];
+        pDest[i + 3] = pPalette[pSrc[i + 3]];
+    }
+
+    for (; i < count; ++i)
+    {
+        pDest[i] = pPalette[pSrc[i]];
+    }
+}
+
+void __stdcall ExpandPackedRect(uint32_t* pDest, const void* pSrc, const uint_t pitch, const BACK_BUFFER_FORMAT format,
+                                const uint32_t* pPalette, const CLIP_RECT* pRect)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT(format != BACK_BUFFER_FORMAT_P8 || pPalette != NULL, "pPalette is NULL");
+
+    const size_t width = (size_t)(pRect->MaxX - pRect->MinX + 1);
+    for (int y = pRect->MinY; y <= pRect->MaxY; ++y)
+    {
+        const size_t offset = (size_t)y * pitch + pRect->MinX;
+        if (format == BACK_BUFFER_FORMAT_R5G6B5)
+        {
+            expandR5G6B5Span(pDest + offset, (const uint16_t*)pSrc + offset, width);
+        }
+        else if (format == BACK_BUFFER_FORMAT_P8)
+        {
+            expandP8Span(pDest + offset, (const uint8_t*)pSrc + offset, width, pPalette);
+        }
+        else
+        {
+            CopySpan(pDest + offset, (const uint32_t*)pSrc + offset, width);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// R5G6B5, P8 백 버퍼용 채우기/복사/선 커널과 출력할 때 A8R8G8B8로 펼치는 커널
+// pitch는 모두 픽셀 단위
+
+#ifndef SAFE99_PACKED_SURFACE_H
+#define SAFE99_PACKED_SURFACE_H
+
+uint_t      __stdcall   GetBytesPerPixel(const BACK_BUFFER_FORMAT format);
+
+// A8R8G8B8을 백 버퍼 형식의 값으로 바꿈, P8은 하위 8비트를 팔레트 인덱스로 씀
+uint32_t    __stdcall   PackColor(const BACK_BUFFER_FORMAT format, const uint32_t argb);
+
+void        __stdcall   FillPackedSpan(void* pDest, const uint_t bytesPerPixel, const size_t count, const uint32_t color);
+void        __stdcall   StreamFillPackedSpan(void* pDest, const uint_t bytesPerPixel, const size_t count, const uint32_t color);
+
+void        __stdcall   RasterizePackedHorizontalLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                                      const int x, const int y, const uint_t width, const uint32_t color);
+void        __stdcall   RasterizePackedVerticalLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                                    const int x, const int y, const uint_t height, const uint32_t color);
+
+// RasterizeLine과 같은 점을 찍음
+void        __stdcall   RasterizePackedLine(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                            const int x0, const int y0, const int x1, const int y1, const uint32_t color);
+
+// 비트맵은 백 버퍼와 같은 형식, bitmapPitch는 픽셀 단위
+void        __stdcall   RasterizePackedBitmap(void* pBuffer, const uint_t pitch, const uint_t bytesPerPixel, const CLIP_RECT* pScissor,
+                                              const int x, const int y, const uint_t width, const uint_t height,
+                                              const void* pBitmap, const uint_t bitmapPitch);
+
+// pRect 영역을 A8R8G8B8로 펼침, P8은 pPalette(256개)를 씀
+void        __stdcall   ExpandPackedRect(uint32_t* pDest, const void* pSrc, const uint_t pitch, const BACK_BUFFER_FORMAT format,
+                                         const uint32_t* pPalette, const CLIP_RECT* pRect);
+
+#endif // SAFE99_PACKED_SURFACE_H
\ No newline at end of file
@@ -0,0 +1,703 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "PostProcess.h"
+
+#include <math.h>
+
+// 스레드마다 띠를 이만큼 만들어 행마다 비용이 달라도 고르게 나눔
+#define BANDS_PER_THREAD 4
+
+#define ROUND_UP_4(x) (((x) + 3) & ~(uint_t)3)
+
+static bool isPointEffect(const POST_EFFECT_TYPE type)
+{
+    return type == POST_EFFECT_COLOR_LUT || type == POST_EFFECT_BRIGHTNESS_CONTRAST;
+}
+
+static void prepareBlur(PREPARED_POST_EFFECT* pEffect, const POST_EFFECT* pSrc)
+{
+    const uint_t radius = pSrc->Radius;
+    const uint_t numTaps = 2 * radius + 1;
+    pEffect->Radius = radius;
+
+    // 탭 수가 64 미만이면 BOX_RECIPROCAL_BITS 비트 역수를 곱해서 나눠도 내림 결과가 같음
+    if (pSrc->Type == POST_EFFECT_BOX_BLUR)
+    {
+        pEffect->BoxReciprocal = ((1 << BOX_RECIPROCAL_BITS) + numTaps - 1) / numTaps;
+        return;
+    }
+
+    // 가중치 합이 (1 << BLUR_WEIGHT_BITS)가 되도록 반올림하고 남은 값은 가운데 탭에 더함
+    const int total = 1 << BLUR_WEIGHT_BITS;
+    const float sigma = (float)radius * 0.5f;
+    float gaussians[2 * MAX_BLUR_TAP_PAIRS];
+    float gaussianSum = 0.0f;
+    for (uint_t i = 0; i < numTaps; ++i)
+    {
+        const float offset = (float)i - (float)radius;
+        gaussians[i] = expf(-offset * offset / (2.0f * sigma * sigma));
+        gaussianSum += gaussians[i];
+    }
+
+    int weights[2 * MAX_BLUR_TAP_PAIRS] = { 0, };
+    int sum = 0;
+    for (uint_t i = 0; i < numTaps; ++i)
+    {
+        weights[i] = (int)(gaussians[i] / gaussianSum * (float)total + 0.5f);
+        sum += weights[i];
+    }
+    weights[radius] += total - sum;
+
+    // 탭 수를 짝수로 맞추는 마지막 탭의 가중치는 0
+    pEffect->NumTapPairs = radius + 1;
+    for (uint_t i = 0; i < pEffect->NumTapPairs; ++i)
+    {
+        pEffect->TapWeights[i] = (uint32_t)weights[2 * i] | ((uint32_t)weights[2 * i + 1] << 16);
+    }
+}
+
+static bool prepareColorLut(PREPARED_POST_EFFECT* pEffect, const POST_EFFECT* pSrc)
+{
+    const uint_t size = pSrc->LutSize;
+    const size_t numEntries = (size_t)size * size * size;
+
+    pEffect->pLut = (uint32_t*)malloc(sizeof(uint32_t) * numEntries);
+    if (pEffect->pLut == NULL)
+    {
+        return false;
+    }
+    memcpy(pEffect->pLut, pSrc->pLut, sizeof(uint32_t) * numEntries);
+    pEffect->LutSize = size;
+
+    // 채널 값 c는 격자 좌표 c * (size - 1) / 255, 마지막 격자는 한 칸 앞에서 가중치 256
+    for (uint_t c = 0; c < 256; ++c)
+    {
+        const uint_t pos = c * (size - 1);
+        uint_t index = pos / 255;
+        uint_t weight = ((pos % 255) * 256 + 127) / 255;
+        if (index == size - 1)
+        {
+            index = size - 2;
+            weight = 256;
+        }
+
+        pEffect->LutIndices[c] = (uint8_t)index;
+        pEffect->LutWeights[c] = (uint16_t)weight;
+    }
+
+    return true;
+}
+
+static void prepareBrightnessContrast(PREPARED_POST_EFFECT* pEffect, const POST_EFFECT* pSrc)
+{
+    const int scale = ROUND_INT(pSrc->Contrast * 256.0f);
+    const int offset = 128 + ROUND_INT(pSrc->Brightness * 255.0f);
+
+    // 바이트 순서는 B, G, R, A
+    for (uint_t i = 0; i < 3; ++i)
+    {
+        pEffect->Scales[i] = (int16_t)scale;
+        pEffect->Offsets[i] = (int16_t)offset;
+    }
+    pEffect->Scales[3] = 256;
+    pEffect->Offsets[3] = 128;
+}
+
+static void releaseEffects(POST_PROCESS* pPostProcess)
+{
+    for (uint_t i = 0; i < pPostProcess->NumEffects; ++i)
+    {
+        SAFE_FREE(pPostProcess->Effects[i].pLut);
+    }
+
+    pPostProcess->NumEffects = 0;
+    pPostProcess->NumPasses = 0;
+}
+
+static void addPass(POST_PROCESS* pPostProcess, const POST_PASS_TYPE type, const uint_t blurIndex,
+                    const uint_t firstPointEffect, const uint_t numPointEffects)
+{
+    ASSERT(pPostProcess->NumPasses < 2 * MAX_POST_EFFECTS, "Too many passes");
+
+    POST_PASS* pPass = &pPostProcess->Passes[pPostProcess->NumPasses++];
+    pPass->Type = type;
+    pPass->BlurIndex = blurIndex;
+    pPass->FirstPointEffect = firstPointEffect;
+    pPass->NumPointEffects = numPointEffects;
+}
+
+// 픽셀 단위 효과는 이웃한 블러에 묶고, 블러가 없으면 한 패스로 묶음
+static void planFusedPasses(POST_PROCESS* pPostProcess)
+{
+    const uint_t numEffects = pPostProcess->NumEffects;
+
+    uint_t firstPending = 0;
+    uint_t lastBlur = UINT_MAX;
+    for (uint_t i = 0; i < numEffects; ++i)
+    {
+        if (isPointEffect(pPostProcess->Effects[i].Type))
+        {
+            continue;
+        }
+
+        // 앞 블러가 있으면 사이의 효과는 앞 블러의 세로 패스가 쓰기 전에 적용했음
+        const uint_t numPre = (lastBlur == UINT_MAX) ? i - firstPending : 0;
+        addPass(pPostProcess, POST_PASS_BLUR_HORIZONTAL, i, firstPending, numPre);
+
+        // 다음 블러(또는 끝)까지의 효과
+        uint_t end = i + 1;
+        while (end < numEffects && isPointEffect(pPostProcess->Effects[end].Type))
+        {
+            ++end;
+        }
+        addPass(pPostProcess, POST_PASS_BLUR_VERTICAL, i, i + 1, end - (i + 1));
+
+        firstPending = end;
+        lastBlur = i;
+    }
+
+    if (lastBlur == UINT_MAX && numEffects > 0)
+    {
+        addPass(pPostProcess, POST_PASS_POINT, 0, 0, numEffects);
+    }
+}
+
+static void planPasses(POST_PROCESS* pPostProcess)
+{
+    for (uint_t i = 0; i < pPostProcess->NumEffects; ++i)
+    {
+        if (isPointEffect(pPostProcess->Effects[i].Type))
+        {
+            addPass(pPostProcess, POST_PASS_POINT, 0, i, 1);
+        }
+        else
+        {
+            addPass(pPostProcess, POST_PASS_BLUR_HORIZONTAL, i, i, 0);
+            addPass(pPostProcess, POST_PASS_BLUR_VERTICAL, i, i, 0);
+        }
+    }
+}
+
+bool __stdcall PostProcessInit(POST_PROCESS* pPostProcess, const uint_t numThreads)
+{
+    ASSERT(pPostProcess != NULL, "pPostProcess is NULL");
+    ASSERT(numThreads > 0, "numThreads is 0");
+
+    memset(pPostProcess, 0, sizeof(POST_PROCESS));
+
+    if (!WorkerPoolInit(&pPostProcess->Pool, numThreads))
+    {
+        return false;
+    }
+    pPostProcess->NumBands = (numThreads == 1) ? 1 : numThreads * BANDS_PER_THREAD;
+
+    return true;
+}
+
+void __stdcall PostProcessRelease(POST_PROCESS* pPostProcess)
+{
+    ASSERT(pPostProcess != NULL, "pPostProcess is NULL");
+
+    WorkerPoolRelease(&pPostProcess->Pool);
+    releaseEffects(pPostProcess);
+    SAFE_ALIGNED_FREE(pPostProcess->pTemp);
+    SAFE_ALIGNED_FREE(pPostProcess->pRowBuffers);
+    pPostProcess->TempCapacity = 0;
+    pPostProcess->RowBufferPitch = 0;
+}
+
+bool __stdcall PostProcessSetEffects(POST_PROCESS* pPostProcess, const POST_EFFECT* pEffects, const uint_t numEffects, const bool bFuse)
+{
+    ASSERT(pPostProcess != NULL, "pPostProcess is NULL");
+    ASSERT(pEffects != NULL || numEffects == 0, "pEffects is NULL");
+    ASSERT(numEffects <= MAX_POST_EFFECTS, "Too many effects");
+
+    releaseEffects(pPostProcess);
+
+    for (uint_t i = 0; i < numEffects; ++i)
+    {
+        const POST_EFFECT* pSrc = &pEffects[i];
+        PREPARED_POST_EFFECT* pEffect = &pPostProcess->Effects[i];
+        memset(pEffect, 0, sizeof(PREPARED_POST_EFFECT));
+        pEffect->Type = pSrc->Type;
+        ++pPostProcess->NumEffects;
+
+        switch (pSrc->Type)
+        {
+        case POST_EFFECT_BOX_BLUR:
+        case POST_EFFECT_GAUSSIAN_BLUR:
+            ASSERT(pSrc->Radius >= 1 && pSrc->Radius <= MAX_BLUR_RADIUS, "Invalid blur radius");
+            prepareBlur(pEffect, pSrc);
+            break;
+        case POST_EFFECT_COLOR_LUT:
+            ASSERT(pSrc->pLut != NULL, "pLut is NULL");
+            ASSERT(pSrc->LutSize >= 2 && pSrc->LutSize <= 64, "Invalid LUT size");
+            if (!prepareColorLut(pEffect, pSrc))
+            {
+                releaseEffects(pPostProcess);
+                return false;
+            }
+            break;
+        case POST_EFFECT_BRIGHTNESS_CONTRAST:
+            ASSERT(pSrc->Contrast >= 0.0f && pSrc->Contrast <= 127.0f, "Invalid contrast");
+            ASSERT(pSrc->Brightness >= -1.0f && pSrc->Brightness <= 1.0f, "Invalid brightness");
+            prepareBrightnessContrast(pEffect, pSrc);
+            break;
+        default:
+            ASSERT(false, "Invalid post effect");
+            break;
+        }
+    }
+
+    if (bFuse)
+    {
+        planFusedPasses(pPostProcess);
+    }
+    else
+    {
+        planPasses(pPostProcess);
+    }
+
+    return true;
+}
+
+// a * (256 - w) + b * w 는 16비트를 넘지 않음
+static __m128i lerpChannels(const __m128i a, const __m128i b, const __m128i weight)
+{
+    const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(256), weight);
+    const __m128i sum = _mm_add_epi16(_mm_mullo_epi16(a, inverse), _mm_mullo_epi16(b, weight));
+    return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+}
+
+// 격자 8개를 b, g, r 순서로 보간, 알파는 원본을 유지
+static uint32_t applyColorLut(const PREPARED_POST_EFFECT* pEffect, const uint32_t pixel)
+{
+    const uint_t r = (pixel >> 16) & 0xff;
+    const uint_t g = (pixel >> 8) & 0xff;
+    const uint_t b = pixel & 0xff;
+
+    const uint_t size = pEffect->LutSize;
+    const uint_t strideG = size;
+    const uint_t strideB = size * size;
+    const uint32_t* pBase = pEffect->pLut + pEffect->LutIndices[r] + pEffect->LutIndices[g] * strideG + pEffect->LutIndices[b] * strideB;
+
+    const __m128i zero = _mm_setzero_si128();
+
+    // (r0g0, r1g0, r0g1, r1g1)를 b0, b1 평면에서
+    const __m128i plane0 = _mm_setr_epi32((int)pBase[0], (int)pBase[1], (int)pBase[strideG], (int)pBase[strideG + 1]);
+    const __m128i plane1 = _mm_setr_epi32((int)pBase[strideB], (int)pBase[strideB + 1], (int)pBase[strideB + strideG], (int)pBase[strideB + strideG + 1]);
+
+    const __m128i weightB = _mm_set1_epi16((short)pEffect->LutWeights[b]);
+    const __m128i g0 = lerpChannels(_mm_unpacklo_epi8(plane0, zero), _mm_unpacklo_epi8(plane1, zero), weightB);
+    const __m128i g1 = lerpChannels(_mm_unpackhi_epi8(plane0, zero), _mm_unpackhi_epi8(plane1, zero), weightB);
+
+    // (r0, r1)
+    const __m128i rs = lerpChannels(g0, g1, _mm_set1_epi16((short)pEffect->LutWeights[g]));
+    const __m128i color = lerpChannels(rs, _mm_srli_si128(rs, 8), _mm_set1_epi16((short)pEffect->LutWeights[r]));
+
+    const uint32_t result = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(color, zero));
+    return (result & 0x00ffffff) | (pixel & 0xff000000);
+}
+
+// 채널마다 ((c - 128) * scale + offset * 256 + 128) >> 8
+static __m128i applyBrightnessContrast(const PREPARED_POST_EFFECT* pEffect, const __m128i pixels)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i round = _mm_set1_epi32(128);
+    const __m128i offsets = _mm_loadl_epi64((const __m128i*)pEffect->Offsets);
+    const __m128i scales = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)pEffect->Scales), _mm_set1_epi16(256));
+    const __m128i offsets2 = _mm_unpacklo_epi64(offsets, offsets);
+
+    const __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(pixels, zero), bias);
+    const __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(pixels, zero), bias);
+
+    __m128i c0 = _mm_madd_epi16(_mm_unpacklo_epi16(lo, offsets2), scales);
+    __m128i c1 = _mm_madd_epi16(_mm_unpackhi_epi16(lo, offsets2), scales);
+    __m128i c2 = _mm_madd_epi16(_mm_unpacklo_epi16(hi, offsets2), scales);
+    __m128i c3 = _mm_madd_epi16(_mm_unpackhi_epi16(hi, offsets2), scales);
+    c0 = _mm_srai_epi32(_mm_add_epi32(c0, round), 8);
+    c1 = _mm_srai_epi32(_mm_add_epi32(c1, round), 8);
+    c2 = _mm_srai_epi32(_mm_add_epi32(c2, round), 8);
+    c3 = _mm_srai_epi32(_mm_add_epi32(c3, round), 8);
+
+    return _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+}
+
+static __m128i applyPointEffects(const PREPARED_POST_EFFECT* pEffects, const uint_t numEffects, __m128i pixels)
+{
+    for (uint_t i = 0; i < numEffects; ++i)
+    {
+        const PREPARED_POST_EFFECT* pEffect = &pEffects[i];
+        if (pEffect->Type == POST_EFFECT_BRIGHTNESS_CONTRAST)
+        {
+            pixels = applyBrightnessContrast(pEffect, pixels);
+            continue;
+        }
+
+        pixels = _mm_setr_epi32((int)applyColorLut(pEffect, (uint32_t)_mm_cvtsi128_si32(pixels)),
+                                (int)applyColorLut(pEffect, (uint32_t)_mm_extract_epi32(pixels, 1)),
+                                (int)applyColorLut(pEffect, (uint32_t)_mm_extract_epi32(pixels, 2)),
+                                (int)applyColorLut(pEffect, (uint32_t)_mm_extract_epi32(pixels, 3)));
+    }
+
+    return pixels;
+}
+
+// 픽셀 단위 효과를 roundUp4(width)개 픽셀에 적용, pDest와 pSrc는 같아도 됨
+static void applyPointEffectsRow(uint32_t* pDest, const uint32_t* pSrc, const PREPARED_POST_EFFECT* pEffects, const uint_t numEffects,
+                                 const uint_t width)
+{
+    for (uint_t x = 0; x < width; x += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(pSrc + x));
+        _mm_storeu_si128((__m128i*)(pDest + x), applyPointEffects(pEffects, numEffects, pixels));
+    }
+}
+
+// pDest[x] = sum(ppTaps[k][x] * weight[k]), 탭 두 개의 같은 채널을 16비트 쌍으로 섞어 pmaddwd 한 번에 곱해서 더함
+// roundUp4(width)개 픽셀을 씀, 쓰기 전에 pPostEffects를 적용
+static void convolveRow(uint32_t* pDest, const uint32_t* const* ppTaps, const PREPARED_POST_EFFECT* pBlur,
+                        const PREPARED_POST_EFFECT* pPostEffects, const uint_t numPostEffects, const uint_t width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (BLUR_WEIGHT_BITS - 1));
+
+    for (uint_t x = 0; x < width; x += 4)
+    {
+        __m128i sum0 = round;
+        __m128i sum1 = round;
+        __m128i sum2 = round;
+        __m128i sum3 = round;
+        for (uint_t i = 0; i < pBlur->NumTapPairs; ++i)
+        {
+            const __m128i a = _mm_loadu_si128((const __m128i*)(ppTaps[2 * i] + x));
+            const __m128i b = _mm_loadu_si128((const __m128i*)(ppTaps[2 * i + 1] + x));
+            const __m128i weights = _mm_set1_epi32((int)pBlur->TapWeights[i]);
+
+            // (a, b) 바이트 쌍 -> 픽셀마다 채널 4개의 16비트 쌍
+            const __m128i ab01 = _mm_unpacklo_epi8(a, b);
+            const __m128i ab23 = _mm_unpackhi_epi8(a, b);
+            sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi8(ab01, zero), weights));
+            sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi8(ab01, zero), weights));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi8(ab23, zero), weights));
+            sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi8(ab23, zero), weights));
+        }
+
+        sum0 = _mm_srli_epi32(sum0, BLUR_WEIGHT_BITS);
+        sum1 = _mm_srli_epi32(sum1, BLUR_WEIGHT_BITS);
+        sum2 = _mm_srli_epi32(sum2, BLUR_WEIGHT_BITS);
+        sum3 = _mm_srli_epi32(sum3, BLUR_WEIGHT_BITS);
+
+        __m128i pixels = _mm_packus_epi16(_mm_packs_epi32(sum0, sum1), _mm_packs_epi32(sum2, sum3));
+        if (numPostEffects > 0)
+        {
+            pixels = applyPointEffects(pPostEffects, numPostEffects, pixels);
+        }
+
+        _mm_storeu_si128((__m128i*)(pDest + x), pixels);
+    }
+}
+
+// (합 + Radius) / 탭 수, 합은 채널마다 32비트
+static __m128i divideBoxSums(const PREPARED_POST_EFFECT* pBlur, const __m128i sums)
+{
+    const __m128i rounded = _mm_add_epi32(sums, _mm_set1_epi32((int)pBlur->Radius));
+    return _mm_srli_epi32(_mm_mullo_epi32(rounded, _mm_set1_epi32((int)pBlur->BoxReciprocal)), BOX_RECIPROCAL_BITS);
+}
+
+// pRow[x] ~ pRow[x + 2 * Radius]의 평균, 한 픽셀씩 창을 밀면서 나가는 픽셀을 빼고 들어오는 픽셀을 더함
+static void boxBlurRow(uint32_t* pDest, const uint32_t* pRow, const PREPARED_POST_EFFECT* pBlur, const uint_t width)
+{
+    const uint_t numTaps = 2 * pBlur->Radius + 1;
+
+    __m128i sums = _mm_setzero_si128();
+    for (uint_t i = 0; i < numTaps; ++i)
+    {
+        sums = _mm_add_epi32(sums, _mm_cvtepu8_epi32(_mm_cvtsi32_si128((int)pRow[i])));
+    }
+
+    for (uint_t x = 0; x < width; ++x)
+    {
+        const __m128i average = divideBoxSums(pBlur, sums);
+        pDest[x] = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(average, average), average));
+
+        sums = _mm_add_epi32(sums, _mm_cvtepu8_epi32(_mm_cvtsi32_si128((int)pRow[x + numTaps])));
+        sums = _mm_sub_epi32(sums, _mm_cvtepu8_epi32(_mm_cvtsi32_si128((int)pRow[x])));
+    }
+}
+
+// 띠의 행마다 열 합으로 평균을 내고 다음 행을 위해 위쪽 행을 빼고 아래쪽 행을 더함, roundUp4(width)개 픽셀을 씀
+static void boxBlurColumns(POST_PROCESS* pPostProcess, uint16_t* pSums, const PREPARED_POST_EFFECT* pBlur,
+                           const PREPARED_POST_EFFECT* pPostEffects, const uint_t numPostEffects, const uint_t minY, const uint_t maxY)
+{
+    const uint_t pitch = pPostProcess->Pitch;
+    const int lastY = (int)pPostProcess->Height - 1;
+    const int radius = (int)pBlur->Radius;
+    const uint_t paddedWidth = ROUND_UP_4(pPostProcess->Width);
+    const uint32_t* pSrc = pPostProcess->pPassSrc;
+    const __m128i zero = _mm_setzero_si128();
+
+    // 첫 행의 창, 채널 합은 최대 255 * 33이라 16비트에 들어감
+    memset(pSums, 0, sizeof(uint16_t) * 4 * paddedWidth);
+    for (int k = -radius; k <= radius; ++k)
+    {
+        const uint32_t* pRow = pSrc + (size_t)MIN(MAX((int)minY + k, 0), lastY) * pitch;
+        for (uint_t x = 0; x < paddedWidth; x += 4)
+        {
+            const __m128i pixels = _mm_loadu_si128((const __m128i*)(pRow + x));
+            __m128i* pSum = (__m128i*)(pSums + 4 * x);
+            _mm_storeu_si128(pSum, _mm_add_epi16(_mm_loadu_si128(pSum), _mm_unpacklo_epi8(pixels, zero)));
+            _mm_storeu_si128(pSum + 1, _mm_add_epi16(_mm_loadu_si128(pSum + 1), _mm_unpackhi_epi8(pixels, zero)));
+        }
+    }
+
+    for (uint_t y = minY; y < maxY; ++y)
+    {
+        uint32_t* pDest = pPostProcess->pPassDest + (size_t)y * pitch;
+        const uint32_t* pAddRow = pSrc + (size_t)MIN((int)y + radius + 1, lastY) * pitch;
+        const uint32_t* pSubRow = pSrc + (size_t)MAX((int)y - radius, 0) * pitch;
+        for (uint_t x = 0; x < paddedWidth; x += 4)
+        {
+            __m128i* pSum = (__m128i*)(pSums + 4 * x);
+            __m128i sum01 = _mm_loadu_si128(pSum);
+            __m128i sum23 = _mm_loadu_si128(pSum + 1);
+
+            const __m128i average01 = _mm_packus_epi32(divideBoxSums(pBlur, _mm_unpacklo_epi16(sum01, zero)),
+                                                       divideBoxSums(pBlur, _mm_unpackhi_epi16(sum01, zero)));
+            const __m128i average23 = _mm_packus_epi32(divideBoxSums(pBlur, _mm_unpacklo_epi16(sum23, zero)),
+                                                       divideBoxSums(pBlur, _mm_unpackhi_epi16(sum23, zero)));
+            __m128i pixels = _mm_packus_epi16(average01, average23);
+            if (numPostEffects > 0)
+            {
+                pixels = applyPointEffects(pPostEffects, numPostEffects, pixels);
+            }
+            _mm_storeu_si128((__m128i*)(pDest + x), pixels);
+
+            const __m128i added = _mm_loadu_si128((const __m128i*)(pAddRow + x));
+            const __m128i removed = _mm_loadu_si128((const __m128i*)(pSubRow + x));
+            sum01 = _mm_sub_epi16(_mm_add_epi16(sum01, _mm_unpacklo_epi8(added, zero)), _mm_unpacklo_epi8(removed, zero));
+            sum23 = _mm_sub_epi16(_mm_add_epi16(sum23, _mm_unpackhi_epi8(added, zero)), _mm_unpackhi_epi8(removed, zero));
+            _mm_storeu_si128(pSum, sum01);
+            _mm_storeu_si128(pSum + 1, sum23);
+        }
+    }
+}
+
+static void __stdcall runBand(void* pContext, const uint_t jobIndex)
+{
+    POST_PROCESS* pPostProcess = (POST_PROCESS*)pContext;
+    const POST_PASS* pPass = pPostProcess->pPass;
+
+    const uint_t pitch = pPostProcess->Pitch;
+    const uint_t width = pPostProcess->Width;
+    const uint_t height = pPostProcess->Height;
+    const uint_t paddedWidth = ROUND_UP_4(width);
+    const uint_t minY = jobIndex * pPostProcess->BandHeight;
+    const uint_t maxY = MIN(minY + pPostProcess->BandHeight, height);
+
+    const PREPARED_POST_EFFECT* pPointEffects = &pPostProcess->Effects[pPass->FirstPointEffect];
+    const uint_t numPointEffects = pPass->NumPointEffects;
+    const PREPARED_POST_EFFECT* pBlur = &pPostProcess->Effects[pPass->BlurIndex];
+    const uint_t numTaps = 2 * pBlur->NumTapPairs;
+
+    const uint32_t* ppTaps[2 * MAX_BLUR_TAP_PAIRS];
+
+    switch (pPass->Type)
+    {
+    case POST_PASS_POINT:
+        for (uint_t y = minY; y < maxY; ++y)
+        {
+            applyPointEffectsRow(pPostProcess->pPassDest + (size_t)y * pitch, pPostProcess->pPassSrc + (size_t)y * pitch,
+                                 pPointEffects, numPointEffects, paddedWidth);
+        }
+        break;
+    case POST_PASS_BLUR_HORIZONTAL:
+    {
+        // 행을 가운데에 두고 양쪽을 가장자리 픽셀로 채움, 탭 k는 x + k - Radius를 읽음
+        const uint_t radius = pBlur->Radius;
+        uint32_t* pRow = pPostProcess->pRowBuffers + (size_t)jobIndex * pPostProcess->RowBufferPitch;
+        for (uint_t k = 0; k < numTaps; ++k)
+        {
+            ppTaps[k] = pRow + k;
+        }
+
+        for (uint_t y = minY; y < maxY; ++y)
+        {
+            const uint32_t* pSrc = pPostProcess->pPassSrc + (size_t)y * pitch;
+            if (numPointEffects > 0)
+            {
+                applyPointEffectsRow(pRow + radius, pSrc, pPointEffects, numPointEffects, paddedWidth);
+            }
+            else
+            {
+                memcpy(pRow + radius, pSrc, sizeof(uint32_t) * paddedWidth);
+            }
+
+            const uint32_t left = pRow[radius];
+            const uint32_t right = pRow[radius + width - 1];
+            for (uint_t x = 0; x < radius; ++x)
+            {
+                pRow[x] = left;
+            }
+            for (uint_t x = radius + width; x < paddedWidth + 2 * radius + 2; ++x)
+            {
+                pRow[x] = right;
+            }
+
+            uint32_t* pDest = pPostProcess->pTemp + (size_t)y * pitch;
+            if (pBlur->Type == POST_EFFECT_BOX_BLUR)
+            {
+                boxBlurRow(pDest, pRow, pBlur, paddedWidth);
+            }
+            else
+            {
+                convolveRow(pDest, ppTaps, pBlur, NULL, 0, width);
+            }
+        }
+        break;
+    }
+    case POST_PASS_BLUR_VERTICAL:
+        if (pBlur->Type == POST_EFFECT_BOX_BLUR)
+        {
+            uint16_t* pSums = (uint16_t*)(pPostProcess->pRowBuffers + (size_t)jobIndex * pPostProcess->RowBufferPitch);
+            boxBlurColumns(pPostProcess, pSums, pBlur, pPointEffects, numPointEffects, minY, maxY);
+            break;
+        }
+
+        for (uint_t y = minY; y < maxY; ++y)
+        {
+            for (uint_t k = 0; k < numTaps; ++k)
+            {
+                const int tapY = (int)y + (int)k - (int)pBlur->Radius;
+                const uint_t clampedY = (uint_t)MIN(MAX(tapY, 0), (int)height - 1);
+                ppTaps[k] = pPostProcess->pTemp + (size_t)clampedY * pitch;
+            }
+
+            convolveRow(pPostProcess->pPassDest + (size_t)y * pitch, ppTaps, pBlur, pPointEffects, numPointEffects, width);
+        }
+        break;
+    default:
+        ASSERT(false, "Invalid post pass");
+        break;
+    }
+}
+
+static bool reserveBuffers(POST_PROCESS* pPostProcess, const uint_t pitch, const uint_t width, const uint_t height)
+{
+    bool bBlur = false;
+    for (uint_t i = 0; i < pPostProcess->NumPasses; ++i)
+    {
+        bBlur = bBlur || (pPostProcess->Passes[i].Type != POST_PASS_POINT);
+    }
+
+    if (!bBlur)
+    {
+        return true;
+    }
+
+    const size_t tempSize = (size_t)pitch * height;
+    if (tempSize > pPostProcess->TempCapacity)
+    {
+        SAFE_ALIGNED_FREE(pPostProcess->pTemp);
+        pPostProcess->TempCapacity = 0;
+
+        pPostProcess->pTemp = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * tempSize, DEFAULT_ALIGN);
+        if (pPostProcess->pTemp == NULL)
+        {
+            return false;
+        }
+        pPostProcess->TempCapacity = tempSize;
+    }
+
+    // 가로 패스는 가운데 roundUp4(width)개, 양쪽 Radius개, 마지막 4픽셀 묶음이 읽는 0 가중치 탭
+    // 박스 블러 세로 패스는 픽셀마다 16비트 채널 합 4개
+    const uint_t rowBufferPitch = 2 * ROUND_UP_4(width) + 2 * MAX_BLUR_RADIUS + 4;
+    if (rowBufferPitch > pPostProcess->RowBufferPitch)
+    {
+        SAFE_ALIGNED_FREE(pPostProcess->pRowBuffers);
+        pPostProcess->RowBufferPitch = 0;
+
+        pPostProcess->pRowBuffers = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * rowBufferPitch * pPostProcess->NumBands, DEFAULT_ALIGN);
+        if (pPostProcess->pRowBuffers == NULL)
+        {
+            return false;
+        }
+        pPostProcess->RowBufferPitch = rowBufferPitch;
+    }
+
+    return true;
+}
+
+bool __stdcall PostProcessRun(POST_PROCESS* pPostProcess, uint32_t* pDest, const uint32_t* pSrc,
+                              const uint_t pitch, const uint_t width, const uint_t height)
+{
+    ASSERT(pPostProcess != NULL, "pPostProcess is NULL");
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(ROUND_UP_4(width) <= pitch, "pitch is not padded to 4 pixels");
+
+    if (width == 0 || height == 0)
+    {
+        return true;
+    }
+
+    if (!reserveBuffers(pPostProcess, pitch, width, height))
+    {
+        return false;
+    }
+
+    if (pPostProcess->NumPasses == 0)
+    {
+        memcpy(pDest, pSrc, sizeof(uint32_t) * pitch * height);
+        return true;
+    }
+
+    const uint_t bandHeight = (height + pPostProcess->NumBands - 1) / pPostProcess->NumBands;
+    const uint_t numBands = (height + bandHeight - 1) / bandHeight;
+
+    pPostProcess->Pitch = pitch;
+    pPostProcess->Width = width;
+    pPostProcess->Height = height;
+    pPostProcess->BandHeight = bandHeight;
+
+    // 가로 패스는 중간 버퍼로, 나머지는 pDest로 씀
+    const uint32_t* pCurrent = pSrc;
+    for (uint_t i = 0; i < pPostProcess->NumPasses; ++i)
+    {
+        const POST_PASS* pPass = &pPostProcess->Passes[i];
+        pPostProcess->pPass = pPass;
+
+        switch (pPass->Type)
+        {
+        case POST_PASS_BLUR_HORIZONTAL:
+            pPostProcess->pPassSrc = pCurrent;
+            pPostProcess->pPassDest = pPostProcess->pTemp;
+            break;
+        case POST_PASS_BLUR_VERTICAL:
+            pPostProcess->pPassSrc = pPostProcess->pTemp;
+            pPostProcess->pPassDest = pDest;
+            pCurrent = pDest;
+            break;
+        case POST_PASS_POINT:
+        default:
+            pPostProcess->pPassSrc = pCurrent;
+            pPostProcess->pPassDest = pDest;
+            pCurrent = pDest;
+            break;
+        }
+
+        WorkerPoolDispatch(&pPostProcess->Pool, runBand, pPostProcess, numBands);
+    }
+
+    pPostProcess->pPass = NULL;
+    pPostProcess->pPassSrc = NULL;
+    pPostProcess->pPassDest = NULL;
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 출력 직전에 프레임에 적용하는 효과, 각 패스는 행 띠로 나눠 워커 풀에서 처리
+// 블러는 가로 패스(원본 -> 중간 버퍼)와 세로 패스(중간 버퍼 -> 대상)로 나눔
+// 가우시안은 탭 두 개씩 pmaddwd로 곱해서 더하고, 박스는 창을 밀면서 합을 고쳐 반지름과 관계없이 픽셀마다 덧셈 두 번
+// 묶으면 블러 앞의 픽셀 단위 효과는 가로 패스가 행을 읽을 때, 뒤의 효과는 세로 패스가 쓰기 전에 적용
+
+#ifndef SAFE99_POST_PROCESS_H
+#define SAFE99_POST_PROCESS_H
+
+#include "safe99_Common/Util/WorkerPool.h"
+
+// 블러 가중치의 합 (12비트 고정소수점)
+#define BLUR_WEIGHT_BITS 12
+
+#define MAX_BLUR_TAP_PAIRS (MAX_BLUR_RADIUS + 1)
+
+#define BOX_RECIPROCAL_BITS 20
+
+typedef struct PREPARED_POST_EFFECT
+{
+    POST_EFFECT_TYPE    Type;
+
+    // 블러, 가우시안 탭 2 * Radius + 1개를 짝수로 맞추고 (k번째 | k + 1번째 << 16)으로 묶음
+    uint_t      Radius;
+    uint_t      NumTapPairs;
+    uint32_t    TapWeights[MAX_BLUR_TAP_PAIRS];
+
+    // 박스 블러, (합 + Radius) * BoxReciprocal >> BOX_RECIPROCAL_BITS 로 탭 수로 나눈 값을 반올림
+    uint32_t    BoxReciprocal;
+
+    // 색 LUT, 채널 값마다 아래쪽 격자 인덱스와 위쪽 격자 가중치 (0 ~ 256)
+    uint32_t*   pLut;
+    uint_t      LutSize;
+    uint8_t     LutIndices[256];
+    uint16_t    LutWeights[256];
+
+    // 밝기/대비, 채널마다 (c - 128, offset) 쌍에 곱할 (scale, 256)
+    int16_t     Scales[4];
+    int16_t     Offsets[4];
+} PREPARED_POST_EFFECT;
+
+typedef enum POST_PASS_TYPE
+{
+    POST_PASS_POINT,
+    POST_PASS_BLUR_HORIZONTAL,
+    POST_PASS_BLUR_VERTICAL,
+} POST_PASS_TYPE;
+
+typedef struct POST_PASS
+{
+    POST_PASS_TYPE  Type;
+    uint_t          BlurIndex;
+
+    // 픽셀 단위 효과 [FirstPointEffect, FirstPointEffect + NumPointEffects)
+    // 가로 패스는 원본 행에, 세로 패스와 POST_PASS_POINT는 결과에 적용
+    uint_t          FirstPointEffect;
+    uint_t          NumPointEffects;
+} POST_PASS;
+
+typedef struct POST_PROCESS
+{
+    WORKER_POOL             Pool;
+    uint_t                  NumBands;
+
+    PREPARED_POST_EFFECT    Effects[MAX_POST_EFFECTS];
+    uint_t                  NumEffects;
+
+    // 블러 하나는 패스 두 개
+    POST_PASS               Passes[2 * MAX_POST_EFFECTS];
+    uint_t                  NumPasses;
+
+    // 블러 가로 패스의 중간 결과, 피치는 프레임과 같음
+    uint32_t*               pTemp;
+    size_t                  TempCapacity;
+
+    // 띠마다 가장자리를 늘린 행 하나, 박스 블러 세로 패스에서는 열마다 채널 합 (16비트)
+    uint32_t*               pRowBuffers;
+    uint_t                  RowBufferPitch;
+
+    // Run 중에만 유효
+    const POST_PASS*        pPass;
+    const uint32_t*         pPassSrc;
+    uint32_t*               pPassDest;
+    uint_t                  Pitch;
+    uint_t                  Width;
+    uint_t                  Height;
+    uint_t                  BandHeight;
+} POST_PROCESS;
+
+bool    __stdcall   PostProcessInit(POST_PROCESS* pPostProcess, const uint_t numThreads);
+void    __stdcall   PostProcessRelease(POST_PROCESS* pPostProcess);
+
+// 효과를 준비하고 패스를 나눔, bFuse면 픽셀 단위 효과를 이웃한 패스에 묶음, 메모리 할당에 실패하면 false
+bool    __stdcall   PostProcessSetEffects(POST_PROCESS* pPostProcess, const POST_EFFECT* pEffects, const uint_t numEffects, const bool bFuse);
+
+// pSrc에 효과를 적용해서 pDest에 씀 (같은 피치), 메모리 할당에 실패하면 false
+bool    __stdcall   PostProcessRun(POST_PROCESS* pPostProcess, uint32_t* pDest, const uint32_t* pSrc,
+                                   const uint_t pitch, const uint_t width, const uint_t height);
+
+#endif // SAFE99_POST_PROCESS_H
\ No newline at end of file
@@ -0,0 +1,236 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "Clipping.h"
+#include "DirtyRects.h"
+#include "PresentQueue.h"
+
+#if defined(UW_PLATFORM_WIN)
+    #include <process.h>
+
+    typedef HANDLE THREAD_HANDLE;
+    typedef CRITICAL_SECTION MUTEX_HANDLE;
+    typedef CONDITION_VARIABLE CONDITION_HANDLE;
+
+    #define THREAD_RETURN unsigned int __stdcall
+#else
+    #include <pthread.h>
+
+    typedef pthread_t THREAD_HANDLE;
+    typedef pthread_mutex_t MUTEX_HANDLE;
+    typedef pthread_cond_t CONDITION_HANDLE;
+
+    #define THREAD_RETURN void*
+#endif // UW_PLATFORM_WIN
+
+static void lock(PRESENT_QUEUE* pQueue)
+{
+#if defined(UW_PLATFORM_WIN)
+    EnterCriticalSection((MUTEX_HANDLE*)pQueue->pMutex);
+#else
+    pthread_mutex_lock((MUTEX_HANDLE*)pQueue->pMutex);
+#endif // UW_PLATFORM_WIN
+}
+
+static void unlock(PRESENT_QUEUE* pQueue)
+{
+#if defined(UW_PLATFORM_WIN)
+    LeaveCriticalSection((MUTEX_HANDLE*)pQueue->pMutex);
+#else
+    pthread_mutex_unlock((MUTEX_HANDLE*)pQueue->pMutex);
+#endif // UW_PLATFORM_WIN
+}
+
+// 잠금을 가진 상태에서 호출
+static void waitCondition(PRESENT_QUEUE* pQueue)
+{
+#if defined(UW_PLATFORM_WIN)
+    SleepConditionVariableCS((CONDITION_HANDLE*)pQueue->pCondition, (MUTEX_HANDLE*)pQueue->pMutex, INFINITE);
+#else
+    pthread_cond_wait((CONDITION_HANDLE*)pQueue->pCondition, (MUTEX_HANDLE*)pQueue->pMutex);
+#endif // UW_PLATFORM_WIN
+}
+
+// 제출 스레드와 출력 스레드가 같은 조건 변수를 기다리므로 모두 깨움
+static void wakeAll(PRESENT_QUEUE* pQueue)
+{
+#if defined(UW_PLATFORM_WIN)
+    WakeAllConditionVariable((CONDITION_HANDLE*)pQueue->pCondition);
+#else
+    pthread_cond_broadcast((CONDITION_HANDLE*)pQueue->pCondition);
+#endif // UW_PLATFORM_WIN
+}
+
+static void destroySync(PRESENT_QUEUE* pQueue)
+{
+#if defined(UW_PLATFORM_WIN)
+    DeleteCriticalSection((MUTEX_HANDLE*)pQueue->pMutex);
+#else
+    pthread_mutex_destroy((MUTEX_HANDLE*)pQueue->pMutex);
+    pthread_cond_destroy((CONDITION_HANDLE*)pQueue->pCondition);
+#endif // UW_PLATFORM_WIN
+
+    SAFE_FREE(pQueue->pMutex);
+    SAFE_FREE(pQueue->pCondition);
+}
+
+static THREAD_RETURN presentThreadMain(void* pArg)
+{
+    PRESENT_QUEUE* pQueue = (PRESENT_QUEUE*)pArg;
+
+    lock(pQueue);
+    while (true)
+    {
+        while (pQueue->NumRequests == 0 && !pQueue->bExit)
+        {
+            waitCondition(pQueue);
+        }
+
+        if (pQueue->NumRequests == 0)
+        {
+            break;
+        }
+
+        // 출력하는 동안 요청 슬롯을 덮어쓰지 않도록 NumRequests는 출력 후에 줄임
+        const PRESENT_REQUEST* pRequest = &pQueue->Requests[pQueue->Head];
+        unlock(pQueue);
+
+        pQueue->pfnPresent(pQueue->pContext, pRequest->BufferIndex, &pRequest->DirtyRects);
+
+        lock(pQueue);
+        pQueue->Head = (pQueue->Head + 1) % MAX_PRESENT_REQUESTS;
+        --pQueue->NumRequests;
+        ++pQueue->CompletedFence;
+        wakeAll(pQueue);
+    }
+    unlock(pQueue);
+
+    return 0;
+}
+
+bool __stdcall PresentQueueInit(PRESENT_QUEUE* pQueue, PresentFunc pfnPresent, void* pContext, const uint64_t initialFence)
+{
+    ASSERT(pQueue != NULL, "pQueue is NULL");
+    ASSERT(pfnPresent != NULL, "pfnPresent is NULL");
+
+    memset(pQueue, 0, sizeof(PRESENT_QUEUE));
+    pQueue->pfnPresent = pfnPresent;
+    pQueue->pContext = pContext;
+    pQueue->SubmittedFence = initialFence;
+    pQueue->CompletedFence = initialFence;
+
+    THREAD_HANDLE* pThread = (THREAD_HANDLE*)malloc(sizeof(THREAD_HANDLE));
+    MUTEX_HANDLE* pMutex = (MUTEX_HANDLE*)malloc(sizeof(MUTEX_HANDLE));
+    CONDITION_HANDLE* pCondition = (CONDITION_HANDLE*)malloc(sizeof(CONDITION_HANDLE));
+    if (pThread == NULL || pMutex == NULL || pCondition == NULL)
+    {
+        SAFE_FREE(pThread);
+        SAFE_FREE(pMutex);
+        SAFE_FREE(pCondition);
+        return false;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    InitializeCriticalSection(pMutex);
+    InitializeConditionVariable(pCondition);
+#else
+    pthread_mutex_init(pMutex, NULL);
+    pthread_cond_init(pCondition, NULL);
+#endif // UW_PLATFORM_WIN
+
+    pQueue->pMutex = pMutex;
+    pQueue->pCondition = pCondition;
+
+#if defined(UW_PLATFORM_WIN)
+    *pThread = (HANDLE)_beginthreadex(NULL, 0, presentThreadMain, pQueue, 0, NULL);
+    const bool bCreated = (*pThread != NULL);
+#else
+    const bool bCreated = (pthread_create(pThread, NULL, presentThreadMain, pQueue) == 0);
+#endif // UW_PLATFORM_WIN
+    if (!bCreated)
+    {
+        SAFE_FREE(pThread);
+        destroySync(pQueue);
+        return false;
+    }
+
+    pQueue->pThread = pThread;
+
+    return true;
+}
+
+void __stdcall PresentQueueRelease(PRESENT_QUEUE* pQueue)
+{
+    ASSERT(pQueue != NULL, "pQueue is NULL");
+
+    if (pQueue->pThread == NULL)
+    {
+        return;
+    }
+
+    lock(pQueue);
+    pQueue->bExit = true;
+    wakeAll(pQueue);
+    unlock(pQueue);
+
+    THREAD_HANDLE* pThread = (THREAD_HANDLE*)pQueue->pThread;
+#if defined(UW_PLATFORM_WIN)
+    WaitForSingleObject(*pThread, INFINITE);
+    CloseHandle(*pThread);
+#else
+    pthread_join(*pThread, NULL);
+#endif // UW_PLATFORM_WIN
+
+    SAFE_FREE(pQueue->pThread);
+    destroySync(pQueue);
+}
+
+uint64_t __stdcall PresentQueueSubmit(PRESENT_QUEUE* pQueue, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects)
+{
+    ASSERT(pQueue != NULL, "pQueue is NULL");
+    ASSERT(pDirtyRects != NULL, "pDirtyRects is NULL");
+
+    lock(pQueue);
+    while (pQueue->NumRequests == MAX_PRESENT_REQUESTS)
+    {
+        waitCondition(pQueue);
+    }
+
+    PRESENT_REQUEST* pRequest = &pQueue->Requests[(pQueue->Head + pQueue->NumRequests) % MAX_PRESENT_REQUESTS];
+    pRequest->BufferIndex = bufferIndex;
+    pRequest->DirtyRects = *pDirtyRects;
+    ++pQueue->NumRequests;
+
+    const uint64_t fence = ++pQueue->SubmittedFence;
+    wakeAll(pQueue);
+    unlock(pQueue);
+
+    return fence;
+}
+
+void __stdcall PresentQueueWait(PRESENT_QUEUE* pQueue, const uint64_t fence)
+{
+    ASSERT(pQueue != NULL, "pQueue is NULL");
+
+    lock(pQueue);
+    ASSERT(fence <= pQueue->SubmittedFence, "Waiting for a fence that was never submitted");
+
+    while (pQueue->CompletedFence < fence)
+    {
+        waitCondition(pQueue);
+    }
+    unlock(pQueue);
+}
+
+uint64_t __stdcall PresentQueueGetCompletedFence(PRESENT_QUEUE* pQueue)
+{
+    ASSERT(pQueue != NULL, "pQueue is NULL");
+
+    lock(pQueue);
+    const uint64_t fence = pQueue->CompletedFence;
+    unlock(pQueue);
+
+    return fence;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 완성된 백 버퍼를 전용 스레드에서 차례로 출력
+// 제출할 때마다 1씩 증가하는 펜스 값을 돌려주며 출력이 끝난 펜스까지 기다릴 수 있음
+
+#ifndef SAFE99_PRESENT_QUEUE_H
+#define SAFE99_PRESENT_QUEUE_H
+
+#define MAX_PRESENT_REQUESTS 4
+
+typedef void(__stdcall* PresentFunc)(void* pContext, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects);
+
+typedef struct PRESENT_REQUEST
+{
+    uint_t      BufferIndex;
+    DIRTY_RECTS DirtyRects;
+} PRESENT_REQUEST;
+
+typedef struct PRESENT_QUEUE
+{
+    void*           pThread;
+    void*           pMutex;
+    void*           pCondition;
+
+    PresentFunc     pfnPresent;
+    void*           pContext;
+
+    PRESENT_REQUEST Requests[MAX_PRESENT_REQUESTS];
+    uint_t          Head;
+    uint_t          NumRequests;
+
+    // pMutex로 보호
+    uint64_t        SubmittedFence;
+    uint64_t        CompletedFence;
+    bool            bExit;
+} PRESENT_QUEUE;
+
+// 펜스 값은 initialFence 다음부터 시작
+bool        __stdcall   PresentQueueInit(PRESENT_QUEUE* pQueue, PresentFunc pfnPresent, void* pContext, const uint64_t initialFence);
+
+// 남은 요청을 모두 출력한 후 스레드를 종료
+void        __stdcall   PresentQueueRelease(PRESENT_QUEUE* pQueue);
+
+// 큐가 가득 차 있으면 자리가 날 때까지 대기, 요청의 펜스 값을 반환
+uint64_t    __stdcall   PresentQueueSubmit(PRESENT_QUEUE* pQueue, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects);
+
+void        __stdcall   PresentQueueWait(PRESENT_QUEUE* pQueue, const uint64_t fence);
+uint64_t    __stdcall   PresentQueueGetCompletedFence(PRESENT_QUEUE* pQueue);
+
+#endif // SAFE99_PRESENT_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,300 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Common/Util/CpuFeature.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "SpanKernels.h"
+#include "Raster.h"
+
+// SelectSpanKernels 전에도 쓸 수 있도록 기본값은 SSE
+static SPAN_KERNELS s_spanKernels = { NULL, NULL, NULL, NULL };
+static SIMD_LEVEL s_simdLevel = SIMD_LEVEL_SSE41;
+
+static const SPAN_KERNELS* getSpanKernels(void)
+{
+    if (s_spanKernels.pfnFillSpan == NULL)
+    {
+        GetSpanKernelsSSE(&s_spanKernels);
+    }
+
+    return &s_spanKernels;
+}
+
+SIMD_LEVEL __stdcall GetMaxSimdLevel(void)
+{
+    const uint32_t features = GetCpuFeatures();
+    if (features & CPU_FEATURE_AVX512)
+    {
+        return SIMD_LEVEL_AVX512;
+    }
+
+    if (features & CPU_FEATURE_AVX2)
+    {
+        return SIMD_LEVEL_AVX2;
+    }
+
+    return SIMD_LEVEL_SSE41;
+}
+
+bool __stdcall SelectSpanKernels(const SIMD_LEVEL level)
+{
+    if (level > GetMaxSimdLevel())
+    {
+        return false;
+    }
+
+    SPAN_KERNELS kernels;
+    switch (level)
+    {
+    case SIMD_LEVEL_SSE41:
+        GetSpanKernelsSSE(&kernels);
+        break;
+    case SIMD_LEVEL_AVX2:
+        GetSpanKernelsAVX2(&kernels);
+        break;
+    case SIMD_LEVEL_AVX512:
+        GetSpanKernelsAVX512(&kernels);
+        break;
+    default:
+        return false;
+    }
+
+    s_spanKernels = kernels;
+    s_simdLevel = level;
+
+    return true;
+}
+
+SIMD_LEVEL __stdcall GetSelectedSimdLevel(void)
+{
+    return s_simdLevel;
+}
+
+void __stdcall FillSpan(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    getSpanKernels()->pfnFillSpan(pDest, count, argb);
+}
+
+void __stdcall StreamFillSpan(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    getSpanKernels()->pfnStreamFillSpan(pDest, count, argb);
+}
+
+void __stdcall CopySpan(uint32_t* pDest, const uint32_t* pSrc, const size_t count)
+{
+    getSpanKernels()->pfnCopySpan(pDest, pSrc, count);
+}
+
+void __stdcall BlendSpan(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode)
+{
+    getSpanKernels()->pfnBlendSpan(pDest, pSrc, count, blendMode);
+}
+
+void __stdcall FillRect(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pRect, const uint32_t argb)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    const size_t width = (size_t)(pRect->MaxX - pRect->MinX + 1);
+    uint32_t* pRow = pBuffer + pRect->MinY * pitch + pRect->MinX;
+    for (int y = pRect->MinY; y <= pRect->MaxY; ++y)
+    {
+        FillSpan(pRow, width, argb);
+        pRow += pitch;
+    }
+}
+
+void __stdcall RasterizeHorizontalLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                       const int x, const int y, const uint_t width, const uint32_t argb)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    if (y < pScissor->MinY || y > pScissor->MaxY)
+    {
+        return;
+    }
+
+    const int startX = MAX(x, pScissor->MinX);
+    const int endX = (int)MIN((int64_t)x + width - 1, (int64_t)pScissor->MaxX);
+    if (startX > endX)
+    {
+        return;
+    }
+
+    FillSpan(pBuffer + y * pitch + startX, (size_t)(endX - startX + 1), argb);
+}
+
+void __stdcall RasterizeVerticalLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                     const int x, const int y, const uint_t height, const uint32_t argb)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    if (x < pScissor->MinX || x > pScissor->MaxX)
+    {
+        return;
+    }
+
+    const int startY = MAX(y, pScissor->MinY);
+    const int endY = (int)MIN((int64_t)y + height - 1, (int64_t)pScissor->MaxY);
+
+    uint32_t* pPixel = pBuffer + startY * pitch + x;
+    for (int i = startY; i <= endY; ++i)
+    {
+        *pPixel = argb;
+        pPixel += pitch;
+    }
+}
+
+// ClipLine이 부축 범위까지 잘랐으므로 firstStep ~ lastStep의 모든 점이 시저 영역 안
+static void rasterizeLineSteps(uint32_t* pBuffer, const uint_t pitch, const LINE_STEPS* pLine,
+                               const int firstStep, const int lastStep, const uint32_t argb)
+{
+    // Bresenham을 firstStep까지 진행한 상태를 바로 계산
+    const int64_t numSteps = pLine->NumSteps;
+    const int64_t minorDelta = pLine->MinorDelta;
+    const int minorCount = GetLineMinorCount(pLine, firstStep);
+    int64_t discriminant = 2 * (firstStep + 1) * minorDelta - numSteps - 2 * minorCount * numSteps;
+    const int64_t NEXT_DISCRIMINANT0 = 2 * minorDelta;
+    const int64_t NEXT_DISCRIMINANT1 = 2 * (minorDelta - numSteps);
+
+    const int majorStride = pLine->bGradual ? pLine->MajorDir : pLine->MajorDir * (int)pitch;
+    const int minorStride = pLine->bGradual ? pLine->MinorDir * (int)pitch : pLine->MinorDir;
+
+    int x;
+    int y;
+    GetLineStepPoint(pLine, firstStep, &x, &y);
+    uint32_t* pPixel = pBuffer + (size_t)y * pitch + x;
+
+    for (int i = firstStep; i <= lastStep; ++i)
+    {
+        *pPixel = argb;
+
+        if (discriminant < 0)
+        {
+            discriminant += NEXT_DISCRIMINANT0;
+        }
+        else
+        {
+            discriminant += NEXT_DISCRIMINANT1;
+            pPixel += minorStride;
+        }
+
+        pPixel += majorStride;
+    }
+}
+
+// 완만한 선을 y가 같은 가로 run 단위로 그림
+// minorCount번째 run의 마지막 step = ceil((2 * numSteps * (minorCount + 1) - numSteps) / (2 * minorDelta)) - 1
+// run마다 분자가 2 * numSteps씩 늘어나므로 몫과 나머지를 더하기만으로 갱신
+static void rasterizeLineRuns(uint32_t* pBuffer, const uint_t pitch, const LINE_STEPS* pLine,
+                              const int firstStep, const int lastStep, const uint32_t argb)
+{
+    ASSERT(pLine->bGradual, "Line is not gradual");
+
+    const int64_t numSteps = pLine->NumSteps;
+    const int64_t minorDelta = pLine->MinorDelta;
+    const int64_t denominator = 2 * minorDelta;
+
+    int64_t runEndQuotient = numSteps;
+    int64_t runEndRemainder = 0;
+    int64_t quotientStep = 0;
+    int64_t remainderStep = 0;
+    if (minorDelta > 0)
+    {
+        const int64_t numerator = 2 * numSteps * (GetLineMinorCount(pLine, firstStep) + 1) - numSteps;
+        runEndQuotient = numerator / denominator;
+        runEndRemainder = numerator % denominator;
+        quotientStep = (2 * numSteps) / denominator;
+        remainderStep = (2 * numSteps) % denominator;
+    }
+
+    int x;
+    int y;
+    GetLineStepPoint(pLine, firstStep, &x, &y);
+    uint32_t* pRow = pBuffer + (size_t)y * pitch;
+    const int rowStride = pLine->MinorDir * (int)pitch;
+
+    int step = firstStep;
+    while (step <= lastStep)
+    {
+        // 나머지가 있으면 올림
+        const int64_t runEnd = runEndQuotient + (runEndRemainder > 0) - 1;
+        const int runLength = (int)(MIN(runEnd, (int64_t)lastStep) - step + 1);
+
+        const int startX = (pLine->MajorDir > 0) ? x : x - (runLength - 1);
+        FillSpan(pRow + startX, (size_t)runLength, argb);
+
+        x += pLine->MajorDir * runLength;
+        pRow += rowStride;
+        step += runLength;
+
+        runEndQuotient += quotientStep;
+        runEndRemainder += remainderStep;
+        if (runEndRemainder >= denominator)
+        {
+            runEndRemainder -= denominator;
+            ++runEndQuotient;
+        }
+    }
+}
+
+void __stdcall RasterizeLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                             const int x0, const int y0, const int x1, const int y1, const uint32_t argb)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+
+    LINE_STEPS line;
+    InitLineSteps(&line, x0, y0, x1, y1);
+
+    int firstStep;
+    int lastStep;
+    if (!ClipLine(pScissor, &line, &firstStep, &lastStep))
+    {
+        return;
+    }
+
+    // 가로 run이 평균적으로 충분히 길 때만 span으로 채움, 나머지는 run을 구하는 비용이 더 큼
+    if (line.bGradual && line.NumSteps >= (int64_t)MIN_LINE_SPAN_LENGTH * line.MinorDelta)
+    {
+        rasterizeLineRuns(pBuffer, pitch, &line, firstStep, lastStep, argb);
+    }
+    else
+    {
+        rasterizeLineSteps(pBuffer, pitch, &line, firstStep, lastStep, argb);
+    }
+}
+
+void __stdcall RasterizeBitmap(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                               const int x, const int y, const uint_t width, const uint_t height,
+                               const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    const int startX = MAX(x, pScissor->MinX);
+    const int startY = MAX(y, pScissor->MinY);
+    const int endX = (int)MIN((int64_t)x + width - 1, (int64_t)pScissor->MaxX);
+    const int endY = (int)MIN((int64_t)y + height - 1, (int64_t)pScissor->MaxY);
+    if (startX > endX || startY > endY)
+    {
+        return;
+    }
+
+    const size_t clippedWidth = (size_t)(endX - startX + 1);
+    const uint32_t* pSrc = (const uint32_t*)pBitmap + (size_t)(startY - y) * bitmapPitch + (startX - x);
+    uint32_t* pDest = pBuffer + startY * pitch + startX;
+    for (int i = startY; i <= endY; ++i)
+    {
+        BlendSpan(pDest, pSrc, clippedWidth, blendMode);
+        pDest += pitch;
+        pSrc += bitmapPitch;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 시저 영역으로 클리핑하며 그리는 기본 커널
+// 시저 영역과 상관없이 같은 픽셀에 같은 값을 쓰므로 타일 단위로 나눠 그려도 결과가 같음
+
+#ifndef SAFE99_RASTER_H
+#define SAFE99_RASTER_H
+
+// 완만한 선의 가로 run 평균 길이가 이 이상이면 span으로 채움
+#define MIN_LINE_SPAN_LENGTH 8
+
+// CPU가 지원하는 가장 높은 단계
+SIMD_LEVEL  __stdcall   GetMaxSimdLevel(void);
+
+// 이후 FillSpan, CopySpan, BlendSpan과 RasterizeTriangle이 쓸 커널을 고름, CPU가 지원하지 않으면 false
+// 선택 전에는 SSE 커널을 씀
+bool        __stdcall   SelectSpanKernels(const SIMD_LEVEL level);
+SIMD_LEVEL  __stdcall   GetSelectedSimdLevel(void);
+
+void    __stdcall   FillSpan(uint32_t* pDest, const size_t count, const uint32_t argb);
+// 비시간적(non-temporal) 저장으로 캐시를 오염시키지 않음, 곧바로 다시 읽지 않을 큰 영역에만 사용
+void    __stdcall   StreamFillSpan(uint32_t* pDest, const size_t count, const uint32_t argb);
+void    __stdcall   CopySpan(uint32_t* pDest, const uint32_t* pSrc, const size_t count);
+
+// 완전히 투명한(0) 픽셀 묶음은 건너뛰고 BLEND_MODE_ALPHA에서 완전히 불투명한 묶음은 복사만 함
+void    __stdcall   BlendSpan(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode);
+
+void    __stdcall   FillRect(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pRect, const uint32_t argb);
+
+void    __stdcall   RasterizeHorizontalLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                            const int x, const int y, const uint_t width, const uint32_t argb);
+void    __stdcall   RasterizeVerticalLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                          const int x, const int y, const uint_t height, const uint32_t argb);
+
+// 마지막 점은 그리지 않음, 시저 영역 밖의 점은 ClipLine으로 잘라냄 (좌표는 ±LINE_COORD_LIMIT 이내)
+void    __stdcall   RasterizeLine(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                  const int x0, const int y0, const int x1, const int y1, const uint32_t argb);
+
+// bitmapPitch는 픽셀 단위, 아틀라스의 일부를 그릴 때는 아틀라스 너비
+void    __stdcall   RasterizeBitmap(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                    const int x, const int y, const uint_t width, const uint_t height,
+                                    const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode);
+
+#endif // SAFE99_RASTER_H
\ No newline at end of file
@@ -0,0 +1,107 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "RenderTarget.h"
+
+static size_t           __stdcall   AddRef(IRenderTarget* pThis);
+static size_t           __stdcall   Release(IRenderTarget* pThis);
+static size_t           __stdcall   GetRefCount(const IRenderTarget* pThis);
+
+static uint_t           __stdcall   GetWidth(const IRenderTarget* pThis);
+static uint_t           __stdcall   GetHeight(const IRenderTarget* pThis);
+static const TEXTURE*   __stdcall   GetTexture(const IRenderTarget* pThis);
+
+static const IRenderTarget s_vtbl =
+{
+    AddRef,
+    Release,
+    GetRefCount,
+
+    GetWidth,
+    GetHeight,
+    GetTexture
+};
+
+IRenderTarget* __stdcall CreateRenderTargetInstance(IRenderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    RenderTarget* pTarget = (RenderTarget*)malloc(sizeof(RenderTarget));
+    if (pTarget == NULL)
+    {
+        return NULL;
+    }
+
+    memset(pTarget, 0, sizeof(RenderTarget));
+    pTarget->Vtbl = s_vtbl;
+    pTarget->RefCount = 1;
+    pTarget->pRenderer = pRenderer;
+
+    // 백 버퍼가 하나이므로 앞 버퍼가 곧 그리는 버퍼
+    uint_t pitch;
+    pTarget->Texture.pBitmap = (char*)pRenderer->GetFrontBuffer(pRenderer, &pitch);
+    pTarget->Texture.Width = (uint32_t)pitch;
+    pTarget->Texture.Height = (uint32_t)pRenderer->GetHeight(pRenderer);
+    pTarget->Texture.NumMipLevels = 1;
+    ASSERT(pitch == pRenderer->GetWidth(pRenderer), "Pitch is not equal to width");
+
+    return &pTarget->Vtbl;
+}
+
+size_t __stdcall AddRef(IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    RenderTarget* pTarget = (RenderTarget*)pThis;
+    return ++pTarget->RefCount;
+}
+
+size_t __stdcall Release(IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    RenderTarget* pTarget = (RenderTarget*)pThis;
+    if (--pTarget->RefCount == 0)
+    {
+        pTarget->pRenderer->Release(pTarget->pRenderer);
+        SAFE_FREE(pTarget);
+        return 0;
+    }
+
+    return pTarget->RefCount;
+}
+
+size_t __stdcall GetRefCount(const IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const RenderTarget* pTarget = (const RenderTarget*)pThis;
+    return pTarget->RefCount;
+}
+
+uint_t __stdcall GetWidth(const IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const RenderTarget* pTarget = (const RenderTarget*)pThis;
+    return pTarget->Texture.Width;
+}
+
+uint_t __stdcall GetHeight(const IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const RenderTarget* pTarget = (const RenderTarget*)pThis;
+    return pTarget->Texture.Height;
+}
+
+const TEXTURE* __stdcall GetTexture(const IRenderTarget* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    const RenderTarget* pTarget = (const RenderTarget*)pThis;
+    return &pTarget->Texture;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// IRenderTarget 구현, 서피스는 헤드리스 렌더러 하나가 가지며 바인딩하면 그리기 함수가 그 렌더러로 넘어감
+
+#ifndef SAFE99_RENDER_TARGET_H
+#define SAFE99_RENDER_TARGET_H
+
+typedef struct RenderTarget
+{
+    IRenderTarget   Vtbl;
+    size_t          RefCount;
+
+    // 백 버퍼 하나, 선형 A8R8G8B8, 피치 == 너비
+    IRenderer*      pRenderer;
+    TEXTURE         Texture;
+} RenderTarget;
+
+// pRenderer의 소유권을 넘겨받음, 실패하면 NULL
+IRenderTarget*  __stdcall   CreateRenderTargetInstance(IRenderer* pRenderer);
+
+#endif // SAFE99_RENDER_TARGET_H
\ No newline at end of file
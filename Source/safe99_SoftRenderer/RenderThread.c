@@ -0,0 +1,228 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "CommandList.h"
+#include "RenderThread.h"
+
+#if defined(UW_PLATFORM_WIN)
+    #include <process.h>
+
+    typedef HANDLE THREAD_HANDLE;
+    typedef HANDLE SEMAPHORE_HANDLE;
+
+    #define THREAD_RETURN unsigned int __stdcall
+#else
+    #include <pthread.h>
+    #include <semaphore.h>
+
+    typedef pthread_t THREAD_HANDLE;
+    typedef sem_t SEMAPHORE_HANDLE;
+
+    #define THREAD_RETURN void*
+#endif // UW_PLATFORM_WIN
+
+static void postSemaphore(void* pSemaphore)
+{
+#if defined(UW_PLATFORM_WIN)
+    ReleaseSemaphore(*(SEMAPHORE_HANDLE*)pSemaphore, 1, NULL);
+#else
+    sem_post((SEMAPHORE_HANDLE*)pSemaphore);
+#endif // UW_PLATFORM_WIN
+}
+
+static void waitSemaphore(void* pSemaphore)
+{
+#if defined(UW_PLATFORM_WIN)
+    WaitForSingleObject(*(SEMAPHORE_HANDLE*)pSemaphore, INFINITE);
+#else
+    while (sem_wait((SEMAPHORE_HANDLE*)pSemaphore) != 0)
+    {
+    }
+#endif // UW_PLATFORM_WIN
+}
+
+static bool createSemaphore(void** ppOutSemaphore, const uint_t initialCount)
+{
+    SEMAPHORE_HANDLE* pSemaphore = (SEMAPHORE_HANDLE*)malloc(sizeof(SEMAPHORE_HANDLE));
+    if (pSemaphore == NULL)
+    {
+        return false;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    *pSemaphore = CreateSemaphore(NULL, (LONG)initialCount, NUM_SUBMISSION_BUFFERS, NULL);
+    if (*pSemaphore == NULL)
+#else
+    if (sem_init(pSemaphore, 0, initialCount) != 0)
+#endif // UW_PLATFORM_WIN
+    {
+        free(pSemaphore);
+        return false;
+    }
+
+    *ppOutSemaphore = pSemaphore;
+    return true;
+}
+
+static void destroySemaphore(void** ppSemaphore)
+{
+    if (*ppSemaphore == NULL)
+    {
+        return;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    CloseHandle(*(SEMAPHORE_HANDLE*)*ppSemaphore);
+#else
+    sem_destroy((SEMAPHORE_HANDLE*)*ppSemaphore);
+#endif // UW_PLATFORM_WIN
+
+    SAFE_FREE(*ppSemaphore);
+}
+
+static void releaseResources(RENDER_THREAD* pThread)
+{
+    destroySemaphore(&pThread->pFrameSemaphore);
+    destroySemaphore(&pThread->pDoneSemaphore);
+
+    for (uint_t i = 0; i < NUM_SUBMISSION_BUFFERS; ++i)
+    {
+        if (pThread->pCommandLists[i] != NULL)
+        {
+            pThread->pCommandLists[i]->Release(pThread->pCommandLists[i]);
+            pThread->pCommandLists[i] = NULL;
+        }
+    }
+}
+
+static THREAD_RETURN renderThreadMain(void* pArg)
+{
+    RENDER_THREAD* pThread = (RENDER_THREAD*)pArg;
+
+    while (true)
+    {
+        // 세마포어의 release/acquire가 목록 내용의 가시성을 보장하므로 목록 자체는 잠그지 않음
+        waitSemaphore(pThread->pFrameSemaphore);
+        if (pThread->bExit)
+        {
+            break;
+        }
+
+        pThread->pfnRenderFrame(pThread->pContext, pThread->pCommandLists[pThread->RenderIndex]);
+        pThread->RenderIndex = (pThread->RenderIndex + 1) % NUM_SUBMISSION_BUFFERS;
+
+        postSemaphore(pThread->pDoneSemaphore);
+    }
+
+    return 0;
+}
+
+bool __stdcall RenderThreadInit(RENDER_THREAD* pThread, RenderFrameFunc pfnRenderFrame, void* pContext)
+{
+    ASSERT(pThread != NULL, "pThread is NULL");
+    ASSERT(pfnRenderFrame != NULL, "pfnRenderFrame is NULL");
+
+    memset(pThread, 0, sizeof(RENDER_THREAD));
+    pThread->pfnRenderFrame = pfnRenderFrame;
+    pThread->pContext = pContext;
+
+    for (uint_t i = 0; i < NUM_SUBMISSION_BUFFERS; ++i)
+    {
+        pThread->pCommandLists[i] = CreateCommandListInstance();
+        if (pThread->pCommandLists[i] == NULL)
+        {
+            releaseResources(pThread);
+            return false;
+        }
+    }
+
+    THREAD_HANDLE* pHandle = (THREAD_HANDLE*)malloc(sizeof(THREAD_HANDLE));
+    if (pHandle == NULL
+        || !createSemaphore(&pThread->pFrameSemaphore, 0)
+        || !createSemaphore(&pThread->pDoneSemaphore, NUM_SUBMISSION_BUFFERS - 1))
+    {
+        SAFE_FREE(pHandle);
+        releaseResources(pThread);
+        return false;
+    }
+
+#if defined(UW_PLATFORM_WIN)
+    *pHandle = (HANDLE)_beginthreadex(NULL, 0, renderThreadMain, pThread, 0, NULL);
+    if (*pHandle == NULL)
+#else
+    if (pthread_create(pHandle, NULL, renderThreadMain, pThread) != 0)
+#endif // UW_PLATFORM_WIN
+    {
+        SAFE_FREE(pHandle);
+        releaseResources(pThread);
+        return false;
+    }
+
+    pThread->pThread = pHandle;
+    return true;
+}
+
+void __stdcall RenderThreadRelease(RENDER_THREAD* pThread)
+{
+    ASSERT(pThread != NULL, "pThread is NULL");
+
+    if (pThread->pThread == NULL)
+    {
+        return;
+    }
+
+    RenderThreadWaitIdle(pThread);
+
+    pThread->bExit = true;
+    postSemaphore(pThread->pFrameSemaphore);
+
+    THREAD_HANDLE* pHandle = (THREAD_HANDLE*)pThread->pThread;
+#if defined(UW_PLATFORM_WIN)
+    WaitForSingleObject(*pHandle, INFINITE);
+    CloseHandle(*pHandle);
+#else
+    pthread_join(*pHandle, NULL);
+#endif // UW_PLATFORM_WIN
+
+    SAFE_FREE(pThread->pThread);
+    releaseResources(pThread);
+}
+
+ICommandList* __stdcall RenderThreadGetCommandList(RENDER_THREAD* pThread)
+{
+    ASSERT(pThread != NULL, "pThread is NULL");
+    return pThread->pCommandLists[pThread->RecordIndex];
+}
+
+void __stdcall RenderThreadSubmit(RENDER_THREAD* pThread)
+{
+    ASSERT(pThread != NULL, "pThread is NULL");
+
+    // 빈 버퍼가 생길 때까지 (= 렌더 스레드가 이전 프레임을 마칠 때까지) 대기
+    waitSemaphore(pThread->pDoneSemaphore);
+    postSemaphore(pThread->pFrameSemaphore);
+
+    pThread->RecordIndex = (pThread->RecordIndex + 1) % NUM_SUBMISSION_BUFFERS;
+
+    ICommandList* pNextList = pThread->pCommandLists[pThread->RecordIndex];
+    pNextList->Reset(pNextList);
+}
+
+void __stdcall RenderThreadWaitIdle(RENDER_THREAD* pThread)
+{
+    ASSERT(pThread != NULL, "pThread is NULL");
+
+    // 빈 버퍼를 모두 가져왔다 돌려놓으면 그리던 프레임이 끝난 것
+    for (uint_t i = 0; i < NUM_SUBMISSION_BUFFERS - 1; ++i)
+    {
+        waitSemaphore(pThread->pDoneSemaphore);
+    }
+
+    for (uint_t i = 0; i < NUM_SUBMISSION_BUFFERS - 1; ++i)
+    {
+        postSemaphore(pThread->pDoneSemaphore);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 명령 목록 두 개를 번갈아 쓰는 렌더 스레드
+// 호출 스레드가 한 목록에 다음 프레임을 기록하는 동안 렌더 스레드가 다른 목록의 이전 프레임을 그림
+
+#ifndef SAFE99_RENDER_THREAD_H
+#define SAFE99_RENDER_THREAD_H
+
+#define NUM_SUBMISSION_BUFFERS 2
+
+typedef void(__stdcall* RenderFrameFunc)(void* pContext, const ICommandList* pCommandList);
+
+typedef struct RENDER_THREAD
+{
+    void*           pThread;
+    void*           pFrameSemaphore;    // 제출했지만 아직 그리지 않은 프레임 수
+    void*           pDoneSemaphore;     // 비어 있는 제출 버퍼 수 (기록 중인 버퍼 제외)
+
+    RenderFrameFunc pfnRenderFrame;
+    void*           pContext;
+
+    ICommandList*   pCommandLists[NUM_SUBMISSION_BUFFERS];
+    uint_t          RecordIndex;        // 호출 스레드만 씀
+    uint_t          RenderIndex;        // 렌더 스레드만 씀
+    volatile bool   bExit;
+} RENDER_THREAD;
+
+bool            __stdcall   RenderThreadInit(RENDER_THREAD* pThread, RenderFrameFunc pfnRenderFrame, void* pContext);
+
+// 남은 프레임을 모두 그린 후 스레드를 종료
+void            __stdcall   RenderThreadRelease(RENDER_THREAD* pThread);
+
+// 호출 스레드가 기록할 목록
+ICommandList*   __stdcall   RenderThreadGetCommandList(RENDER_THREAD* pThread);
+
+// 기록한 목록을 넘기고 다음 목록으로 바꿈, 렌더 스레드가 이전 프레임을 그리고 있으면 끝날 때까지 대기
+void            __stdcall   RenderThreadSubmit(RENDER_THREAD* pThread);
+
+// 제출한 프레임을 모두 그릴 때까지 대기
+void            __stdcall   RenderThreadWaitIdle(RENDER_THREAD* pThread);
+
+#endif // SAFE99_RENDER_THREAD_H
\ No newline at end of file
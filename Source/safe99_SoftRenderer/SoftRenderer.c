@@ -5,43 +5,155 @@
 
 #include "Precompiled.h"
 #include "safe99_Common/Common.h"
-#include "safe99_Common/Util/HighPerformanceTimer.h"
 #include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Common/Util/HighPerformanceTimer.h"
 #include "safe99_Math/safe99_Math.inl"
 #include "Clipping.h"
-
-#define NUM_MAX_BACK_BUFFERS 1
-
-#define USE_SSE 1
+#include "Depth.h"
+#include "Triangle.h"
+#include "TransformedBitmap.h"
+#include "Raster.h"
+#include "TileBinner.h"
+#include "SpriteBatch.h"
+#include "FastClear.h"
+#include "DirtyRects.h"
+#include "PresentQueue.h"
+#include "FramePacer.h"
+#include "CommandList.h"
+#include "RenderThread.h"
+#include "PackedSurface.h"
+#include "TiledSurface.h"
+#include "RenderTarget.h"
+#include "DynamicResolution.h"
+#include "Upscale.h"
+#include "PostProcess.h"
+
+#define NUM_MAX_BACK_BUFFERS 3
+#define NUM_PALETTE_ENTRIES 256
+#define BACK_BUFFER_ALIGN 64
+
+// L2보다 충분히 큰 버퍼는 캐시를 거치지 않고 지움
+#define STREAM_CLEAR_MIN_BYTES (4 * 1024 * 1024)
+
+// DrawLines가 한 번에 클리핑하는 선분 수 (스택에 둠)
+#define LINE_BATCH_SIZE 256
+
+// 가드 밴드 경계 (화면 좌표), 반올림해도 래스터라이저 좌표 범위를 넘지 않도록 1픽셀 여유를 둠
+#define GUARD_BAND_COORD ((float)(MAX_RASTER_COORD - 1))
+
+typedef enum PRESENT_MODE
+{
+    PRESENT_MODE_GDI,
+    PRESENT_MODE_MEMORY,
+} PRESENT_MODE;
 
 typedef struct Renderer
 {
     IRenderer   Vtbl;
     size_t      RefCount;
 
-    HWND        hWnd;
+    PRESENT_MODE    PresentMode;
 
+    // BackBufferFormat 형식, pitch는 모든 형식에서 픽셀 단위
     uint32_t*   pBackBuffers[NUM_MAX_BACK_BUFFERS];
+    uint8_t     NumBackBuffers;
     uint8_t     BackBufferIndex;
+    uint8_t     FrontBufferIndex;
     uint_t      Pitch;
     uint_t      Width;
     uint_t      Height;
 
+    BACK_BUFFER_FORMAT      BackBufferFormat;
+    uint_t                  BytesPerPixel;
+    uint32_t                Palette[NUM_PALETTE_ENTRIES];
+
+    // true면 백 버퍼와 깊이 버퍼가 타일 배치 (TiledSurface.h), A8R8G8B8에서만 씀
+    bool                    bTiledLayout;
+
+    // A8R8G8B8이 아니거나 타일 배치면 출력할 때 앞 버퍼를 선형 A8R8G8B8로 펼쳐 두는 버퍼, 출력 스레드가 있으면 출력 스레드만 씀
+    // 후처리를 켜면 효과를 적용한 프레임
+    uint32_t*               pPresentBuffer;
+
+    // Format이 DEPTH_FORMAT_NONE이면 없음
+    DEPTH_BUFFER    DepthBuffer;
+
+    TEXTURE_FILTER  TextureFilter;
+    TEXTURE_ADDRESS TextureAddress;
+
+#if defined(UW_PLATFORM_WIN)
+    HWND        hWnd;
     HDC         hdc;
     HBITMAP     hBitmap;
     BITMAPINFO  Bmi;
+#endif // UW_PLATFORM_WIN
 
-    HIGH_PERFORMANCE_TIMER  FrameTimer;
+    FRAME_PACER             FramePacer;
     uint_t                  MaxFps;
     uint_t                  Fps;
-    float                   TicksPerFrame;
+
+    // true면 그리기 명령을 타일별로 모았다가 EndRender에서 병렬로 래스터화
+    bool                    bTileBinning;
+    TILE_BINNER             TileBinner;
+
+    // DrawSprites에서 재사용
+    SPRITE_BATCH            SpriteBatch;
+
+    // true면 즉시 그리기 모드의 Clear를 타일별로 미룸
+    bool                    bFastClear;
+    FAST_CLEAR              FastClear;
+
+    // 백 버퍼에서 이번 프레임에 바뀐 영역, EndRender에서 이 영역만 출력
+    DIRTY_RECTS             DirtyRects;
+
+    // 백 버퍼가 2개 이상이면 출력 스레드에서 출력
+    bool                    bAsyncPresent;
+    PRESENT_QUEUE           PresentQueue;
+    uint64_t                PresentFence;                               // 마지막으로 제출한 프레임
+    volatile uint64_t       CompletedPresentFence;                      // 바로 출력할 때 출력이 끝난 마지막 프레임, 렌더 스레드가 씀
+    uint64_t                BufferFences[NUM_MAX_BACK_BUFFERS];         // 각 버퍼를 마지막으로 제출한 프레임
+    DIRTY_RECTS             BufferDirtyRects[NUM_MAX_BACK_BUFFERS];     // 각 버퍼에 마지막으로 그린 프레임에서 바뀐 영역
+
+    // 새 백 버퍼는 다른 버퍼에 그린 최근 프레임들만큼 뒤처져 있으므로 첫 그리기 전에 앞 버퍼에서 복사
+    // 전체를 지우는 Clear가 먼저 오면 복사하지 않음
+    bool                    bPreservePending;
+    DIRTY_RECTS             PreserveRects;
+
+    // true면 그리기 함수는 명령 목록에 기록만 하고 EndRender에서 렌더 스레드로 넘김
+    bool                    bRenderThread;
+    RENDER_THREAD           RenderThread;
+
+    // NULL이 아니면 그리기 함수는 렌더 타겟의 렌더러에 그림
+    IRenderTarget*          pRenderTarget;
+
+    // NULL이 아니면 렌더 타겟이 없을 때 그리기 함수는 배율에 맞춘 내부 서피스(헤드리스 렌더러)에 그리고 출력할 때 백 버퍼로 늘림
+    // 내부 서피스의 백 버퍼는 최대 배율 크기로 만들어 두고 배율이 바뀌면 크기만 바꿈
+    struct Renderer*        pScaledSurface;
+    DYNAMIC_RESOLUTION      DynamicResolution;
+    UPSCALE_FILTER          UpscaleFilter;
+    UPSCALER                Upscaler;
+    HIGH_PERFORMANCE_TIMER  FrameTimer;     // 프레임 시작에서 리셋하고 finishFrame 끝에서 잼
+
+    // 다음에 기록할 프레임의 내부 서피스 크기, 호출 스레드만 읽고 씀
+    // 렌더 스레드 모드에서는 EndRender가 이전 프레임을 기다린 후 그 프레임 시간으로 정하고 기록을 마친 프레임의 크기는 Frame*에 넘김
+    uint_t                  RenderWidth;
+    uint_t                  RenderHeight;
+    uint_t                  FrameRenderWidth;
+    uint_t                  FrameRenderHeight;
+
+    // true면 출력할 때 앞 버퍼에 효과를 적용해서 pPresentBuffer에 씀, 출력 스레드가 있으면 출력 스레드만 씀
+    bool                    bPostProcess;
+    POST_PROCESS            PostProcess;
 } Renderer;
 
+// 렌더 타겟도 헤드리스 렌더러로 만듦
+void                __stdcall   CreateDllInstance(void** ppOutInstance);
+
 static size_t       __stdcall   AddRef(IRenderer* pThis);
 static size_t       __stdcall   Release(IRenderer* pThis);
 static size_t       __stdcall   GetRefCount(const IRenderer* pThis);
 
 static bool         __stdcall   Init(IRenderer* pThis, void* hWnd);
+static bool         __stdcall   InitHeadless(IRenderer* pThis, const uint_t width, const uint_t height);
 
 static void         __stdcall   OnMoveWindow(IRenderer* pThis);
 static void         __stdcall   OnResizeWindow(IRenderer* pThis);
@@ -49,18 +161,129 @@ static void         __stdcall   OnResizeWindow(IRenderer* pThis);
 static uint_t       __stdcall   GetWidth(const IRenderer* pThis);
 static uint_t       __stdcall   GetHeight(const IRenderer* pThis);
 
+static const uint32_t* __stdcall GetFrontBuffer(const IRenderer* pThis, uint_t* pOutPitch);
+
 static void         __stdcall   BeginRender(IRenderer* pThis);
 static void         __stdcall   EndRender(IRenderer* pThis);
 
 static void         __stdcall   Clear(IRenderer* pThis, const uint32_t argb);
+static void         __stdcall   ClearDepth(IRenderer* pThis, const float depth);
 static void         __stdcall   DrawHorizontalLine(IRenderer* pThis, const int x, const int y, const uint_t width, const uint32_t argb);
 static void         __stdcall   DrawVerticalLine(IRenderer* pThis, const int x, const int y, const uint_t height, const uint32_t argb);
 static void         __stdcall   DrawLine(IRenderer* pThis, const int x0, const int y0, const int x1, const int y1, const uint_t argb);
+static void         __stdcall   DrawLines(IRenderer* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                          const uint_t numLines, const uint32_t argb);
 static void         __stdcall   DrawBitmap(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap);
+static void         __stdcall   DrawBitmapBlended(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                                  const BLEND_MODE blendMode);
+static void         __stdcall   DrawBitmapTransformed(IRenderer* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                                      const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+static void         __stdcall   DrawSprites(IRenderer* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture);
+static void         __stdcall   DrawTriangle(IRenderer* pThis, const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2);
+static void         __stdcall   DrawTriangles(IRenderer* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static void         __stdcall   DrawTexturedTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                                      const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static void         __stdcall   DrawClipSpaceTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                                       const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static bool         __stdcall   CreateCommandList(IRenderer* pThis, ICommandList** ppOutCommandList);
+static void         __stdcall   ExecuteCommandList(IRenderer* pThis, const ICommandList* pCommandList);
+static bool         __stdcall   CreateRenderTarget(IRenderer* pThis, const uint_t width, const uint_t height, const DEPTH_FORMAT depthFormat,
+                                                   IRenderTarget** ppOutTarget);
+static void         __stdcall   SetRenderTarget(IRenderer* pThis, IRenderTarget* pTarget);
 
 static void         __stdcall   SetMaxFps(IRenderer* pThis, const uint_t fps);
 static uint_t       __stdcall   GetFps(const IRenderer* pThis);
 
+static bool         __stdcall   SetNumRasterThreads(IRenderer* pThis, const uint_t numThreads);
+static bool         __stdcall   SetDepthFormat(IRenderer* pThis, const DEPTH_FORMAT format);
+static void         __stdcall   SetTextureSampler(IRenderer* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address);
+static bool         __stdcall   SetSimdLevel(IRenderer* pThis, const SIMD_LEVEL level);
+static SIMD_LEVEL   __stdcall   GetSimdLevel(const IRenderer* pThis);
+static bool         __stdcall   SetFastClear(IRenderer* pThis, const bool bEnable);
+static bool         __stdcall   SetNumBackBuffers(IRenderer* pThis, const uint_t numBuffers);
+static uint64_t     __stdcall   GetPresentFence(const IRenderer* pThis);
+static uint64_t     __stdcall   GetCompletedPresentFence(const IRenderer* pThis);
+static void         __stdcall   WaitForPresentFence(IRenderer* pThis, const uint64_t fence);
+static bool         __stdcall   SetRenderThread(IRenderer* pThis, const bool bEnable);
+static bool         __stdcall   SetBackBufferFormat(IRenderer* pThis, const BACK_BUFFER_FORMAT format);
+static void         __stdcall   SetPalette(IRenderer* pThis, const uint32_t* pArgbs, const uint_t firstIndex, const uint_t numEntries);
+static bool         __stdcall   SetSurfaceLayout(IRenderer* pThis, const SURFACE_LAYOUT layout);
+static bool         __stdcall   SetDynamicResolution(IRenderer* pThis, const float minScale, const float maxScale, const float targetFrameTime,
+                                                     const UPSCALE_FILTER filter);
+static uint_t       __stdcall   GetRenderWidth(const IRenderer* pThis);
+static uint_t       __stdcall   GetRenderHeight(const IRenderer* pThis);
+static bool         __stdcall   SetPostEffects(IRenderer* pThis, const POST_EFFECT* pEffects, const uint_t numEffects, const uint_t numThreads,
+                                               const bool bFuse);
+static void         __stdcall   GetFramePacingStats(const IRenderer* pThis, FRAME_PACING_STATS* pOutStats);
+static void         __stdcall   ResetFramePacingStats(IRenderer* pThis);
+
+static bool                     initBackBuffers(Renderer* pRenderer, const uint_t width, const uint_t height);
+static void                     applyPostEffects(Renderer* pRenderer, const uint32_t* pFrame);
+static void                     present(Renderer* pRenderer, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects);
+static void         __stdcall   presentFromQueue(void* pContext, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects);
+static void                     submitFrame(Renderer* pRenderer);
+static void                     prepareBackBuffer(Renderer* pRenderer);
+static void                     preserveBackBuffer(Renderer* pRenderer);
+static void                     waitForPresentIdle(Renderer* pRenderer);
+static void                     storeFence(volatile uint64_t* pFence, const uint64_t fence);
+static uint64_t                 loadFence(const volatile uint64_t* pFence);
+static void                     waitForRenderThreadIdle(Renderer* pRenderer);
+static void                     finishFrame(Renderer* pRenderer);
+static void         __stdcall   renderFrameFromThread(void* pContext, const ICommandList* pCommandList);
+static bool                     getLineBounds(const LINE_STEPS* pLine, const CLIP_RECT* pScreenRect, CLIP_RECT* pOutRect);
+static void                     getScreenRect(const Renderer* pRenderer, CLIP_RECT* pOutRect);
+static void                     flushTileBinner(Renderer* pRenderer);
+static void                     resolveFastClear(Renderer* pRenderer, const CLIP_RECT* pRect);
+static void                     markDirty(Renderer* pRenderer, const CLIP_RECT* pRect);
+static void                     markAllDirty(Renderer* pRenderer);
+static DEPTH_BUFFER*            getDepthBuffer(Renderer* pRenderer);
+static bool                     isPackedFormat(const Renderer* pRenderer);
+static Renderer*                getDrawTarget(Renderer* pRenderer);
+static IRenderer*               createHeadlessRenderer(const uint_t width, const uint_t height, const DEPTH_FORMAT depthFormat);
+static void                     getScaledSize(const Renderer* pRenderer, const float scale, uint_t* pOutWidth, uint_t* pOutHeight);
+static bool                     createScaledSurface(Renderer* pRenderer);
+static void                     releaseScaledSurface(Renderer* pRenderer);
+static void                     resizeScaledSurface(Renderer* pSurface, const uint_t width, const uint_t height);
+static void                     applyRenderSize(Renderer* pRenderer, const uint_t width, const uint_t height);
+static void                     latchRenderSize(Renderer* pRenderer);
+static void                     upscaleScaledSurface(Renderer* pRenderer);
+static void                     updateDynamicResolution(Renderer* pRenderer);
+static uint_t                   getBufferHeight(const Renderer* pRenderer);
+static uint_t                   getTiledHeight(const Renderer* pRenderer);
+static void                     drawTiled(Renderer* pRenderer, const DRAW_COMMAND* pCommand, const CLIP_RECT* pRect);
+static void                     drawTriangleSetup(Renderer* pRenderer, const TRIANGLE_SETUP* pSetup);
+static void                     drawPolygon(Renderer* pRenderer, const TEXTURE* pTexture,
+                                            const CLIP_POLYGON_VERTEX* pVertices, const uint_t numVertices);
+static void                     drawGuardBandClippedTriangle(Renderer* pRenderer, const TEXTURE* pTexture, CLIP_POLYGON_VERTEX vertices[MAX_CLIP_POLYGON_VERTICES]);
+static void                     drawBitmap(Renderer* pRenderer, const int x, const int y, const uint_t width, const uint_t height,
+                                           const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode);
+static void                     drawTransformedBitmap(Renderer* pRenderer, const TRANSFORMED_BITMAP_SETUP* pSetup);
+
+// 렌더 스레드 모드에서 그리기 함수 대신 쓰는 기록 함수
+static ICommandList*           getRecordingCommandList(IRenderer* pThis);
+static void         __stdcall   recordClear(IRenderer* pThis, const uint32_t argb);
+static void         __stdcall   recordClearDepth(IRenderer* pThis, const float depth);
+static void         __stdcall   recordHorizontalLine(IRenderer* pThis, const int x, const int y, const uint_t width, const uint32_t argb);
+static void         __stdcall   recordVerticalLine(IRenderer* pThis, const int x, const int y, const uint_t height, const uint32_t argb);
+static void         __stdcall   recordLine(IRenderer* pThis, const int x0, const int y0, const int x1, const int y1, const uint_t argb);
+static void         __stdcall   recordLines(IRenderer* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                            const uint_t numLines, const uint32_t argb);
+static void         __stdcall   recordBitmap(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap);
+static void         __stdcall   recordBitmapBlended(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                                    const BLEND_MODE blendMode);
+static void         __stdcall   recordBitmapTransformed(IRenderer* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                                        const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+static void         __stdcall   recordSprites(IRenderer* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture);
+static void         __stdcall   recordTriangle(IRenderer* pThis, const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2);
+static void         __stdcall   recordTriangles(IRenderer* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static void         __stdcall   recordTexturedTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                                        const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static void         __stdcall   recordClipSpaceTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                                         const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles);
+static void         __stdcall   recordCommandList(IRenderer* pThis, const ICommandList* pCommandList);
+static void         __stdcall   recordRenderTarget(IRenderer* pThis, IRenderTarget* pTarget);
+static void         __stdcall   recordTextureSampler(IRenderer* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address);
+
 static const IRenderer s_vtbl =
 {
     AddRef,
@@ -68,6 +291,7 @@ static const IRenderer s_vtbl =
     GetRefCount,
 
     Init,
+    InitHeadless,
 
     OnMoveWindow,
     OnResizeWindow,
@@ -75,17 +299,118 @@ static const IRenderer s_vtbl =
     GetWidth,
     GetHeight,
 
+    GetFrontBuffer,
+
     BeginRender,
     EndRender,
 
     Clear,
+    ClearDepth,
     DrawHorizontalLine,
     DrawVerticalLine,
     DrawLine,
+    DrawLines,
     DrawBitmap,
+    DrawBitmapBlended,
+    DrawBitmapTransformed,
+    DrawSprites,
+    DrawTriangle,
+    DrawTriangles,
+    DrawTexturedTriangles,
+    DrawClipSpaceTriangles,
+    CreateCommandList,
+    ExecuteCommandList,
+    CreateRenderTarget,
+    SetRenderTarget,
+
+    SetMaxFps,
+    GetFps,
+
+    SetNumRasterThreads,
+    SetDepthFormat,
+    SetTextureSampler,
+    SetSimdLevel,
+    GetSimdLevel,
+    SetFastClear,
+    SetNumBackBuffers,
+    GetPresentFence,
+    GetCompletedPresentFence,
+    WaitForPresentFence,
+    SetRenderThread,
+    SetBackBufferFormat,
+    SetPalette,
+    SetSurfaceLayout,
+    SetDynamicResolution,
+    GetRenderWidth,
+    GetRenderHeight,
+    SetPostEffects,
+    GetFramePacingStats,
+    ResetFramePacingStats
+};
+
+// 렌더 스레드 모드, 그리기 함수와 상태 기록 함수만 다름
+static const IRenderer s_renderThreadVtbl =
+{
+    AddRef,
+    Release,
+    GetRefCount,
+
+    Init,
+    InitHeadless,
+
+    OnMoveWindow,
+    OnResizeWindow,
+
+    GetWidth,
+    GetHeight,
+
+    GetFrontBuffer,
+
+    BeginRender,
+    EndRender,
+
+    recordClear,
+    recordClearDepth,
+    recordHorizontalLine,
+    recordVerticalLine,
+    recordLine,
+    recordLines,
+    recordBitmap,
+    recordBitmapBlended,
+    recordBitmapTransformed,
+    recordSprites,
+    recordTriangle,
+    recordTriangles,
+    recordTexturedTriangles,
+    recordClipSpaceTriangles,
+    CreateCommandList,
+    recordCommandList,
+    CreateRenderTarget,
+    recordRenderTarget,
 
     SetMaxFps,
-    GetFps
+    GetFps,
+
+    SetNumRasterThreads,
+    SetDepthFormat,
+    recordTextureSampler,
+    SetSimdLevel,
+    GetSimdLevel,
+    SetFastClear,
+    SetNumBackBuffers,
+    GetPresentFence,
+    GetCompletedPresentFence,
+    WaitForPresentFence,
+    SetRenderThread,
+    SetBackBufferFormat,
+    SetPalette,
+    SetSurfaceLayout,
+    SetDynamicResolution,
+    GetRenderWidth,
+    GetRenderHeight,
+    SetPostEffects,
+    GetFramePacingStats,
+    ResetFramePacingStats
 };
 
 size_t __stdcall AddRef(IRenderer* pThis)
@@ -103,14 +428,56 @@ size_t __stdcall Release(IRenderer* pThis)
     Renderer* pRenderer = (Renderer*)pThis;
     if (--pRenderer->RefCount == 0)
     {
-        DeleteObject(pRenderer->hBitmap);
-        ReleaseDC(pRenderer->hWnd, pRenderer->hdc);
+        // 렌더 스레드와 출력 스레드가 DC와 백 버퍼를 쓰므로 가장 먼저 정리
+        if (pRenderer->bRenderThread)
+        {
+            RenderThreadRelease(&pRenderer->RenderThread);
+        }
+
+        if (pRenderer->bAsyncPresent)
+        {
+            PresentQueueRelease(&pRenderer->PresentQueue);
+        }
+
+        releaseScaledSurface(pRenderer);
+
+        if (pRenderer->bPostProcess)
+        {
+            PostProcessRelease(&pRenderer->PostProcess);
+        }
+
+#if defined(UW_PLATFORM_WIN)
+        if (pRenderer->PresentMode == PRESENT_MODE_GDI)
+        {
+            DeleteObject(pRenderer->hBitmap);
+            ReleaseDC(pRenderer->hWnd, pRenderer->hdc);
+        }
+#endif // UW_PLATFORM_WIN
+
+        if (pRenderer->bTileBinning)
+        {
+            TileBinnerRelease(&pRenderer->TileBinner);
+        }
+
+        if (pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE)
+        {
+            DepthBufferRelease(&pRenderer->DepthBuffer);
+        }
+
+        SpriteBatchRelease(&pRenderer->SpriteBatch);
+        FramePacerRelease(&pRenderer->FramePacer);
+
+        if (pRenderer->bFastClear)
+        {
+            FastClearRelease(&pRenderer->FastClear);
+        }
 
         for (size_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
         {
-            SAFE_FREE(pRenderer->pBackBuffers[i]);
+            SAFE_ALIGNED_FREE(pRenderer->pBackBuffers[i]);
         }
 
+        SAFE_ALIGNED_FREE(pRenderer->pPresentBuffer);
         SAFE_FREE(pRenderer);
         return 0;
     }
@@ -130,35 +497,28 @@ bool __stdcall Init(IRenderer* pThis, void* hWnd)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
 
-    Renderer* pRenderer = (Renderer*)pThis;
-
     bool bResult = false;
 
+#if defined(UW_PLATFORM_WIN)
+    Renderer* pRenderer = (Renderer*)pThis;
+
     RECT windowRect;
     GetClientRect((HWND)hWnd, &windowRect);
     const uint_t windowWidth = windowRect.right - windowRect.left;
     const uint_t windowHeight = windowRect.bottom - windowRect.top;
 
-    const uint_t padding = DEFAULT_ALIGN - windowWidth % DEFAULT_ALIGN;
-    const uint_t pitch = windowWidth + ((padding == DEFAULT_ALIGN) ? 0 : padding);
-
-    for (size_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
+    if (!initBackBuffers(pRenderer, windowWidth, windowHeight))
     {
-        uint32_t* pBackBuffer = (uint32_t*)malloc(4 * pitch * windowHeight);
-        ASSERT(pBackBuffer != NULL, "Failed to malloc");
-
-        memset(pBackBuffer, 0, 4 * pitch * windowHeight);
-        pRenderer->pBackBuffers[i] = pBackBuffer;
+        goto lb_return;
     }
 
-    pRenderer->BackBufferIndex = 0;
-    pRenderer->Pitch = pitch;
-    pRenderer->Width = windowWidth;
-    pRenderer->Height = windowHeight;
+    SelectSpanKernels(GetMaxSimdLevel());
+
+    pRenderer->PresentMode = PRESENT_MODE_GDI;
 
     memset(&pRenderer->Bmi, 0, sizeof(pRenderer->Bmi));
     pRenderer->Bmi.bmiHeader.biSize = sizeof(pRenderer->Bmi);
-    pRenderer->Bmi.bmiHeader.biWidth = (LONG)pitch;
+    pRenderer->Bmi.bmiHeader.biWidth = (LONG)pRenderer->Pitch;
     pRenderer->Bmi.bmiHeader.biHeight = -(LONG)windowHeight;
     pRenderer->Bmi.bmiHeader.biBitCount = 32;
     pRenderer->Bmi.bmiHeader.biCompression = BI_RGB;
@@ -166,30 +526,51 @@ bool __stdcall Init(IRenderer* pThis, void* hWnd)
 
     pRenderer->hWnd = (HWND)hWnd;
     pRenderer->hdc = GetDC(pRenderer->hWnd);
-    pRenderer->hBitmap = CreateCompatibleBitmap(pRenderer->hdc, (int)pitch, (int)windowHeight);
+    pRenderer->hBitmap = CreateCompatibleBitmap(pRenderer->hdc, (int)pRenderer->Pitch, (int)windowHeight);
 
     SelectObject(pRenderer->hdc, pRenderer->hBitmap);
 
-    HighPerformanceTimerInit(&pRenderer->FrameTimer);
-    pRenderer->MaxFps = UINT32_MAX;
-    pRenderer->TicksPerFrame = 0.0f;
-    pRenderer->Fps = 0;
-
     bResult = true;
 
+lb_return:
+#else
+    (void)hWnd;
+    ASSERT(false, "GDI present is not supported on this platform");
+#endif // UW_PLATFORM_WIN
+
     return bResult;
 }
 
+bool __stdcall InitHeadless(IRenderer* pThis, const uint_t width, const uint_t height)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(width > 0, "width is 0");
+    ASSERT(height > 0, "height is 0");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+
+    if (!initBackBuffers(pRenderer, width, height))
+    {
+        return false;
+    }
+
+    SelectSpanKernels(GetMaxSimdLevel());
+
+    pRenderer->PresentMode = PRESENT_MODE_MEMORY;
+
+    return true;
+}
+
 void __stdcall OnMoveWindow(IRenderer* pThis)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
 
     Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
 
-    StretchDIBits(pRenderer->hdc,
-                  0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
-                  0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
-                  pRenderer->pBackBuffers[pRenderer->BackBufferIndex], &pRenderer->Bmi, DIB_RGB_COLORS, SRCCOPY);
+    // 가려졌던 부분이 있을 수 있으므로 전체를 출력, 출력 스레드와 DC를 같이 쓰지 않도록 먼저 기다림
+    waitForPresentIdle(pRenderer);
+    present(pRenderer, pRenderer->FrontBufferIndex, NULL);
 }
 
 // TODO: 크기에 따라 객체들의 위치도 바뀌도록 수정
@@ -198,7 +579,14 @@ void __stdcall OnResizeWindow(IRenderer* pThis)
     ASSERT(pThis != NULL, "pThis is NULL");
 
     Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+
+    if (pRenderer->PresentMode != PRESENT_MODE_GDI)
+    {
+        return;
+    }
 
+#if defined(UW_PLATFORM_WIN)
     RECT windowRect;
     GetClientRect(pRenderer->hWnd, &windowRect);
     const uint_t windowWidth = windowRect.right - windowRect.left;
@@ -213,6 +601,11 @@ void __stdcall OnResizeWindow(IRenderer* pThis)
         return;
     }
 
+    flushTileBinner(pRenderer);
+    resolveFastClear(pRenderer, NULL);
+    preserveBackBuffer(pRenderer);
+    waitForPresentIdle(pRenderer);
+
     //HBITMAP hNewBitmap = CreateCompatibleBitmap(pRenderer->hdc, (int)pitch, (int)windowHeight);
     //HBITMAP hOldBitmap = (HBITMAP)SelectObject(pRenderer->hdc, hNewBitmap);
     //DeleteObject(hOldBitmap);
@@ -224,19 +617,60 @@ void __stdcall OnResizeWindow(IRenderer* pThis)
     const uint_t minPitch = MIN(pitch, pRenderer->Pitch);
     const uint_t minHeight = MIN(windowHeight, pRenderer->Height);
 
-    for (size_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
+    // 모든 버퍼를 지금 그리고 있는 백 버퍼 내용으로 맞춤
+    const uint_t bytesPerPixel = pRenderer->BytesPerPixel;
+    const uint_t bufferHeight = pRenderer->bTiledLayout ? GetTiledHeight(windowHeight) : windowHeight;
+    const uint_t oldTiledHeight = getTiledHeight(pRenderer);
+    const uint8_t* pOldBackBuffer = (const uint8_t*)pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+    uint32_t* pNewBackBuffers[NUM_MAX_BACK_BUFFERS] = { NULL, };
+    for (size_t i = 0; i < pRenderer->NumBackBuffers; ++i)
     {
-        uint32_t* pBackBuffer = (uint32_t*)malloc(4 * pitch * windowHeight);
+        uint8_t* pBackBuffer = (uint8_t*)ALIGNED_MALLOC(bytesPerPixel * pitch * bufferHeight, BACK_BUFFER_ALIGN);
         ASSERT(pBackBuffer != NULL, "Failed to malloc");
 
-        memset(pBackBuffer, 0, 4 * pitch * windowHeight);
-        memcpy(pBackBuffer, pRenderer->pBackBuffers[i], 4 * minPitch * minHeight);
+        memset(pBackBuffer, 0, bytesPerPixel * pitch * bufferHeight);
+        if (pRenderer->bTiledLayout)
+        {
+            // 띠 안의 행들은 이어져 있으므로 띠마다 한 번에 복사
+            for (uint_t strip = 0; strip < minPitch / SURFACE_TILE_SIZE; ++strip)
+            {
+                memcpy(pBackBuffer + (size_t)strip * SURFACE_TILE_SIZE * bufferHeight * bytesPerPixel,
+                       pOldBackBuffer + (size_t)strip * SURFACE_TILE_SIZE * oldTiledHeight * bytesPerPixel,
+                       (size_t)SURFACE_TILE_SIZE * minHeight * bytesPerPixel);
+            }
+        }
+        else
+        {
+            for (uint_t y = 0; y < minHeight; ++y)
+            {
+                memcpy(pBackBuffer + (size_t)y * pitch * bytesPerPixel,
+                       pOldBackBuffer + (size_t)y * pRenderer->Pitch * bytesPerPixel, bytesPerPixel * minPitch);
+            }
+        }
+
+        pNewBackBuffers[i] = (uint32_t*)pBackBuffer;
+    }
+
+    // 펼친 버퍼는 markAllDirty로 다음 출력에서 전체를 다시 펼침
+    if (pRenderer->pPresentBuffer != NULL)
+    {
+        SAFE_ALIGNED_FREE(pRenderer->pPresentBuffer);
+        pRenderer->pPresentBuffer = (uint32_t*)ALIGNED_MALLOC(4 * pitch * windowHeight, BACK_BUFFER_ALIGN);
+        ASSERT(pRenderer->pPresentBuffer != NULL, "Failed to malloc");
+
+        memset(pRenderer->pPresentBuffer, 0, 4 * pitch * windowHeight);
+    }
+
+    for (size_t i = 0; i < pRenderer->NumBackBuffers; ++i)
+    {
+        SAFE_ALIGNED_FREE(pRenderer->pBackBuffers[i]);
+        pRenderer->pBackBuffers[i] = pNewBackBuffers[i];
 
-        SAFE_FREE(pRenderer->pBackBuffers[i]);
-        pRenderer->pBackBuffers[i] = pBackBuffer;
+        DirtyRectsReset(&pRenderer->BufferDirtyRects[i]);
     }
 
     pRenderer->BackBufferIndex = 0;
+    pRenderer->FrontBufferIndex = 0;
     pRenderer->Pitch = pitch;
     pRenderer->Width = windowWidth;
     pRenderer->Height = windowHeight;
@@ -244,6 +678,48 @@ void __stdcall OnResizeWindow(IRenderer* pThis)
     pRenderer->Bmi.bmiHeader.biWidth = (LONG)pitch;
     pRenderer->Bmi.bmiHeader.biHeight = -(LONG)windowHeight;
 
+    markAllDirty(pRenderer);
+
+    // 깊이 버퍼는 매 프레임 지우므로 내용을 옮기지 않음
+    if (pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE)
+    {
+        const DEPTH_FORMAT depthFormat = pRenderer->DepthBuffer.Format;
+        DepthBufferRelease(&pRenderer->DepthBuffer);
+        if (!DepthBufferInit(&pRenderer->DepthBuffer, depthFormat, pitch, bufferHeight))
+        {
+            ASSERT(false, "Failed to malloc");
+        }
+    }
+
+    if (pRenderer->bFastClear)
+    {
+        FastClearRelease(&pRenderer->FastClear);
+        pRenderer->bFastClear = FastClearInit(&pRenderer->FastClear, pitch, windowHeight, getTiledHeight(pRenderer));
+    }
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerResize(&pRenderer->TileBinner, windowWidth, windowHeight, pitch, getTiledHeight(pRenderer)))
+        {
+            TileBinnerSetDepthBuffer(&pRenderer->TileBinner, getDepthBuffer(pRenderer));
+        }
+        else
+        {
+            TileBinnerRelease(&pRenderer->TileBinner);
+            pRenderer->bTileBinning = false;
+        }
+    }
+
+    // 내부 서피스는 새 백 버퍼 크기로 다시 만들고 배율은 유지, 만들지 못하면 동적 해상도를 끔
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        releaseScaledSurface(pRenderer);
+        if (!createScaledSurface(pRenderer))
+        {
+            releaseScaledSurface(pRenderer);
+        }
+    }
+
     BOOL a = BitBlt(hNewDC, 0, 0, (int)minPitch, (int)minHeight, pRenderer->hdc, 0, 0, SRCCOPY);
 
     HBITMAP hOldBitmap = (HBITMAP)SelectObject(pRenderer->hdc, hNewBitmap);
@@ -255,6 +731,7 @@ void __stdcall OnResizeWindow(IRenderer* pThis)
                   0, 0, (int)minPitch, (int)minHeight,
                   pRenderer->pBackBuffers[pRenderer->BackBufferIndex], &pRenderer->Bmi, DIB_RGB_COLORS, SRCCOPY);
 #endif
+#endif // UW_PLATFORM_WIN
     return;
 }
 
@@ -274,13 +751,34 @@ uint_t __stdcall GetHeight(const IRenderer* pThis)
     return pRenderer->Height;
 }
 
-void __stdcall BeginRender(IRenderer* pThis)
+const uint32_t* __stdcall GetFrontBuffer(const IRenderer* pThis, uint_t* pOutPitch)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
 
     Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+    if (pOutPitch != NULL)
+    {
+        *pOutPitch = pRenderer->Pitch;
+    }
+
+    if (pRenderer->pPresentBuffer != NULL)
+    {
+        // 출력 스레드가 펼치는 중일 수 있음
+        waitForPresentIdle(pRenderer);
+        return pRenderer->pPresentBuffer;
+    }
+
+    return pRenderer->pBackBuffers[pRenderer->FrontBufferIndex];
+}
+
+void __stdcall BeginRender(IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    (void)pThis;
 
-    HighPerformanceTimerUpdate(&pRenderer->FrameTimer, pRenderer->TicksPerFrame);
+    // 프레임 간격은 EndRender끼리 잼
 }
 
 void __stdcall EndRender(IRenderer* pThis)
@@ -289,45 +787,86 @@ void __stdcall EndRender(IRenderer* pThis)
 
     Renderer* pRenderer = (Renderer*)pThis;
 
-    StretchDIBits(pRenderer->hdc,
-                  0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
-                  0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
-                  pRenderer->pBackBuffers[pRenderer->BackBufferIndex], &pRenderer->Bmi, DIB_RGB_COLORS, SRCCOPY);
+    if (pRenderer->bRenderThread)
+    {
+        // 넘기기 전에 이전 프레임이 끝나야 하므로 RenderThreadSubmit만큼만 기다림
+        RenderThreadWaitIdle(&pRenderer->RenderThread);
+        latchRenderSize(pRenderer);
+        RenderThreadSubmit(&pRenderer->RenderThread);
+    }
+    else
+    {
+        finishFrame(pRenderer);
+    }
 
-    pRenderer->BackBufferIndex = (pRenderer->BackBufferIndex + 1) % NUM_MAX_BACK_BUFFERS;
+    const float deltaTime = FramePacerWait(&pRenderer->FramePacer);
+    pRenderer->Fps = (deltaTime > 0.0f) ? (uint_t)ROUND_INT((1.0f / deltaTime)) : 0;
 
-    float deltaTime = HighPerformanceTimerGetDeltaTime(&pRenderer->FrameTimer);
-    while (deltaTime < pRenderer->TicksPerFrame)
+    // 동적 해상도는 대기 시간을 뺀 다음 프레임의 시간을 잼, 렌더 스레드 모드는 렌더 스레드에서 잼
+    if (pRenderer->pScaledSurface != NULL && !pRenderer->bRenderThread)
     {
-        HighPerformanceTimerUpdate(&pRenderer->FrameTimer, pRenderer->TicksPerFrame);
-        deltaTime = HighPerformanceTimerGetDeltaTime(&pRenderer->FrameTimer);
+        HighPerformanceTimerUpdate(&pRenderer->FrameTimer, 0.0f);
     }
-
-    pRenderer->Fps = (uint_t)ROUND_INT((1.0f / deltaTime));
 }
 
 void __stdcall Clear(IRenderer* pThis, const uint32_t argb)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
 
-    Renderer* pRenderer = (Renderer*)pThis;
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    markAllDirty(pRenderer);
 
-#if USE_SSE
-    __m128i* pStartBufferSSE = (__m128i*)(pRenderer->pBackBuffers[pRenderer->BackBufferIndex]);
-    __m128i* pEndBufferSSE = (__m128i*)((uint32_t*)pStartBufferSSE + pRenderer->Height * pRenderer->Pitch);
-    while (pStartBufferSSE < pEndBufferSSE)
+    if (pRenderer->bTileBinning)
     {
-        *pStartBufferSSE++ = _mm_set1_epi32(argb);
+        if (TileBinnerAddClear(&pRenderer->TileBinner, argb))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
     }
 
-#else
-    uint32_t* pBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
-    uint32_t* pEndBuffer = pBuffer + pRenderer->Height * pRenderer->Pitch;
-    while (pBuffer < pEndBuffer)
+    if (pRenderer->bFastClear)
+    {
+        FastClearSet(&pRenderer->FastClear, argb);
+        return;
+    }
+
+    // A8R8G8B8이면 FillSpan, StreamFillSpan과 같음, 버퍼 전체를 채우므로 배치와 관계없음
+    uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+    const size_t numPixels = (size_t)getBufferHeight(pRenderer) * pRenderer->Pitch;
+    const uint32_t color = PackColor(pRenderer->BackBufferFormat, argb);
+    if (numPixels * pRenderer->BytesPerPixel >= STREAM_CLEAR_MIN_BYTES)
+    {
+        StreamFillPackedSpan(pBackBuffer, pRenderer->BytesPerPixel, numPixels, color);
+    }
+    else
+    {
+        FillPackedSpan(pBackBuffer, pRenderer->BytesPerPixel, numPixels, color);
+    }
+}
+
+void __stdcall ClearDepth(IRenderer* pThis, const float depth)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+    ASSERT(pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE, "Depth buffer is not created");
+
+    if (pRenderer->bTileBinning)
     {
-        *pBuffer++ = argb;
+        if (TileBinnerAddClearDepth(&pRenderer->TileBinner, depth))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
     }
-#endif // USE_SSE
+
+    // 버퍼 전체를 채우므로 배치와 관계없음
+    const CLIP_RECT rect = { 0, 0, (int)pRenderer->Pitch - 1, (int)getBufferHeight(pRenderer) - 1 };
+    ClearDepthRect(&pRenderer->DepthBuffer, pRenderer->Pitch, &rect, depth);
 }
 
 void __stdcall DrawHorizontalLine(IRenderer* pThis, const int x, const int y, const uint_t width, const uint32_t argb)
@@ -335,38 +874,45 @@ void __stdcall DrawHorizontalLine(IRenderer* pThis, const int x, const int y, co
     ASSERT(pThis != NULL, "pThis is NULL");
     ASSERT(width > 0, "width is 0");
 
-    Renderer* pRenderer = (Renderer*)pThis;
-
-    const int startY = MIN(MAX(y, 0), (int)pRenderer->Height - 1);
-    const int startX = MIN(MAX(x, 0), (int)pRenderer->Width - 1);
-    const int endX = MIN(MAX(x + (int)width, 0), (int)pRenderer->Width - 1);
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
 
-    uint32_t* pStartBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex] + startY * pRenderer->Pitch + startX;
-    uint32_t* pEndBuffer = pStartBuffer + endX - startX;
+    const CLIP_RECT rect = { x, y, (int)MIN((int64_t)x + width - 1, (int64_t)INT_MAX), y };
+    markDirty(pRenderer, &rect);
 
-#if USE_SSE
-    if (endX & 1)
+    if (pRenderer->bTileBinning)
     {
-        *pEndBuffer-- = argb;
-    }
+        if (TileBinnerAddHorizontalLine(&pRenderer->TileBinner, x, y, width, argb))
+        {
+            return;
+        }
 
-    if (endX & 2)
-    {
-        *pEndBuffer-- = argb;
+        flushTileBinner(pRenderer);
     }
 
-    __m128i* pStartBufferSSE = (__m128i*)pStartBuffer;
-    while (pStartBufferSSE <  (__m128i*)pEndBuffer)
+    resolveFastClear(pRenderer, &rect);
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+    if (isPackedFormat(pRenderer))
     {
-        *pStartBufferSSE++ = _mm_set1_epi32(argb);
+        RasterizePackedHorizontalLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pRenderer->BytesPerPixel,
+                                      &screenRect, x, y, width, PackColor(pRenderer->BackBufferFormat, argb));
+        return;
     }
-#else
-    while (pBuffer < pEndBuffer)
+
+    if (pRenderer->bTiledLayout)
     {
-        *pBuffer++ = argb;
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_HORIZONTAL_LINE;
+        command.Argb = argb;
+        command.Span.X = x;
+        command.Span.Y = y;
+        command.Span.Length = width;
+        drawTiled(pRenderer, &command, &rect);
+        return;
     }
 
-#endif // USE_SSE
+    RasterizeHorizontalLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, &screenRect, x, y, width, argb);
 }
 
 void __stdcall DrawVerticalLine(IRenderer* pThis, const int x, const int y, const uint_t height, const uint32_t argb)
@@ -374,137 +920,717 @@ void __stdcall DrawVerticalLine(IRenderer* pThis, const int x, const int y, cons
     ASSERT(pThis != NULL, "pThis is NULL");
     ASSERT(height > 0, "height is 0");
 
-    Renderer* pRenderer = (Renderer*)pThis;
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    const CLIP_RECT rect = { x, y, x, (int)MIN((int64_t)y + height - 1, (int64_t)INT_MAX) };
+    markDirty(pRenderer, &rect);
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerAddVerticalLine(&pRenderer->TileBinner, x, y, height, argb))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
+    }
 
-    const int startX = MIN(MAX(x, 0), (int)pRenderer->Width - 1);
-    const int startY = MIN(MAX(y, 0), (int)pRenderer->Height - 1);
-    const int endY = MIN(MAX(y + (int)height, 0), (int)pRenderer->Height - 1);
+    resolveFastClear(pRenderer, &rect);
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+    if (isPackedFormat(pRenderer))
+    {
+        RasterizePackedVerticalLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pRenderer->BytesPerPixel,
+                                    &screenRect, x, y, height, PackColor(pRenderer->BackBufferFormat, argb));
+        return;
+    }
 
-    uint32_t* pStartBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex] + startY * pRenderer->Pitch + startX;
-    uint32_t* pEndBuffer = pStartBuffer + (endY - startY) * pRenderer->Pitch;
-    while (pStartBuffer < pEndBuffer)
+    if (pRenderer->bTiledLayout)
     {
-        *pStartBuffer = argb;
-        pStartBuffer += pRenderer->Pitch;
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_VERTICAL_LINE;
+        command.Argb = argb;
+        command.Span.X = x;
+        command.Span.Y = y;
+        command.Span.Length = height;
+        drawTiled(pRenderer, &command, &rect);
+        return;
     }
+
+    RasterizeVerticalLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, &screenRect, x, y, height, argb);
 }
 
 void __stdcall DrawLine(IRenderer* pThis, const int x0, const int y0, const int x1, const int y1, const uint_t argb)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
 
-    Renderer* pRenderer = (Renderer*)pThis;
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
 
-    int startX = x0;
-    int startY = y0;
-    int endX = x1;
-    int endY = y1;
-    const bool bInsideWindow = ClipLine(0, 0, pRenderer->Width - 1, pRenderer->Height - 1, &startX, &startY, &endX, &endY);
-    if (!bInsideWindow)
+    int lineX0 = x0;
+    int lineY0 = y0;
+    int lineX1 = x1;
+    int lineY1 = y1;
+    if (!ClampLineToCoordLimit(&lineX0, &lineY0, &lineX1, &lineY1))
     {
         return;
     }
 
-    const int width = endX - startX;
-    const int height = endY - startY;
-    const bool bGradual = (ABS(width) >= ABS(height));
+    LINE_STEPS line;
+    InitLineSteps(&line, lineX0, lineY0, lineX1, lineY1);
 
-    const int dx = (width >= 0) ? 1 : -1;
-    const int dy = (height > 0) ? 1 : -1;
-
-    const int dw = dx * width;
-    const int dh = dy * height;
-
-    int discriminant =              bGradual ?  2 * dh - dw     : 2 * dw - dh;
-    const int NEXT_DISCRIMINANT0 =  bGradual ?  2 * dh          : 2 * dw;
-    const int NEXT_DISCRIMINANT1 =  bGradual ?  2 * (dh - dw)   : 2 * (dw - dh);
+    CLIP_RECT rect;
+    if (!getLineBounds(&line, &screenRect, &rect))
+    {
+        return;
+    }
 
-    uint32_t* pBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex] + startY * pRenderer->Pitch + startX;
-    uint32_t* pEndBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex] + endY * pRenderer->Pitch + endX;
+    markDirty(pRenderer, &rect);
 
-    if (bGradual)
+    if (pRenderer->bTileBinning)
     {
-        while (pBuffer != pEndBuffer)
+        if (TileBinnerAddLine(&pRenderer->TileBinner, lineX0, lineY0, lineX1, lineY1, argb))
         {
-            *pBuffer = argb;
-
-            if (discriminant < 0)
-            {
-                discriminant += NEXT_DISCRIMINANT0;
-            }
-            else
-            {
-                discriminant += NEXT_DISCRIMINANT1;
-                pBuffer += (int)pRenderer->Pitch * dy;
-            }
-
-            pBuffer += dx;
+            return;
         }
+
+        flushTileBinner(pRenderer);
     }
-    else
-    {
-        while (pBuffer != pEndBuffer)
-        {
-            *pBuffer = argb;
 
-            if (discriminant < 0)
-            {
-                discriminant += NEXT_DISCRIMINANT0;
-            }
-            else
-            {
-                discriminant += NEXT_DISCRIMINANT1;
-                pBuffer += dx;
-            }
+    resolveFastClear(pRenderer, &rect);
+    if (isPackedFormat(pRenderer))
+    {
+        RasterizePackedLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pRenderer->BytesPerPixel,
+                            &screenRect, lineX0, lineY0, lineX1, lineY1, PackColor(pRenderer->BackBufferFormat, argb));
+        return;
+    }
 
-            pBuffer += (int)pRenderer->Pitch * dy;
-        }
+    if (pRenderer->bTiledLayout)
+    {
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_LINE;
+        command.Argb = argb;
+        command.Line.X0 = lineX0;
+        command.Line.Y0 = lineY0;
+        command.Line.X1 = lineX1;
+        command.Line.Y1 = lineY1;
+        drawTiled(pRenderer, &command, &rect);
+        return;
     }
+
+    RasterizeLine(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, &screenRect, lineX0, lineY0, lineX1, lineY1, argb);
 }
 
-void __stdcall DrawBitmap(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap)
+void __stdcall DrawLines(IRenderer* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                         const uint_t numLines, const uint32_t argb)
 {
     ASSERT(pThis != NULL, "pThis is NULL");
-    ASSERT(pBitmap != NULL, "pBitmap is NULL");
-
-    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pX0s != NULL && pY0s != NULL && pX1s != NULL && pY1s != NULL, "Line array is NULL");
 
-    const uint_t startX = MIN(MAX(x, 0), (int)pRenderer->Width - 1);
-    const uint_t startY = MIN(MAX(y, 0), (int)pRenderer->Height - 1);
-    uint_t clippedWidth = width - (x - startX);
-    uint_t clippedHeight = height - (y - startY);
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
 
-    const uint_t endX = MIN(startX + clippedWidth, pRenderer->Width - 1);
-    const uint_t endY = MIN(startY + clippedHeight, pRenderer->Height - 1);
-    clippedWidth = clippedWidth - ((startX + clippedWidth) - endX);
-    clippedHeight = clippedHeight - ((startY + clippedHeight) - endY);
-    
-#if USE_SSE
-    const uint32_t* pPixel = (const uint32_t*)pBitmap;
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
 
-    uint32_t* pBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex] + startY * pRenderer->Pitch + startX;
-    //const size_t mask = ((clippedWidth & 1) == 1) + ((clippedWidth & 2) == 2);
-    const size_t mask = (clippedWidth & 3);
-    const size_t loopCount = (clippedWidth - mask) / 4;
-    for (size_t i = 0; i < clippedHeight; ++i)
+    uint32_t indices[LINE_BATCH_SIZE];
+    int lines[LINE_BATCH_SIZE][4];
+    CLIP_RECT lineRects[LINE_BATCH_SIZE];
+    for (uint_t first = 0; first < numLines; first += LINE_BATCH_SIZE)
     {
-        for (size_t k = 0; k < mask; ++k)
+        const uint_t numBatchLines = MIN(numLines - first, LINE_BATCH_SIZE);
+        const uint_t numVisibleLines = CullLines(&screenRect, pX0s + first, pY0s + first, pX1s + first, pY1s + first,
+                                                 numBatchLines, indices);
+
+        // 그릴 선분을 모아 두고 전체를 감싸는 영역을 한 번만 기록
+        CLIP_RECT bounds = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+        uint_t numLinesToDraw = 0;
+        for (uint_t i = 0; i < numVisibleLines; ++i)
         {
-            *pBuffer++ = *pPixel++;
+            const uint_t index = first + (indices[i] & ~LINE_NEEDS_CLIP);
+            int* pLine = lines[numLinesToDraw];
+            pLine[0] = pX0s[index];
+            pLine[1] = pY0s[index];
+            pLine[2] = pX1s[index];
+            pLine[3] = pY1s[index];
+
+            // 두 끝점이 화면 안이면 좌표 범위 안
+            if ((indices[i] & LINE_NEEDS_CLIP) != 0 && !ClampLineToCoordLimit(&pLine[0], &pLine[1], &pLine[2], &pLine[3]))
+            {
+                continue;
+            }
+
+            LINE_STEPS line;
+            InitLineSteps(&line, pLine[0], pLine[1], pLine[2], pLine[3]);
+
+            CLIP_RECT rect;
+            if ((indices[i] & LINE_NEEDS_CLIP) != 0)
+            {
+                if (!getLineBounds(&line, &screenRect, &rect))
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                // 두 끝점이 모두 화면 안이면 마지막 점을 빼고 전부 그림
+                if (line.NumSteps == 0)
+                {
+                    continue;
+                }
+
+                GetLineStepPoint(&line, line.NumSteps - 1, &rect.MaxX, &rect.MaxY);
+                rect.MinX = MIN(pLine[0], rect.MaxX);
+                rect.MinY = MIN(pLine[1], rect.MaxY);
+                rect.MaxX = MAX(pLine[0], rect.MaxX);
+                rect.MaxY = MAX(pLine[1], rect.MaxY);
+            }
+
+            bounds.MinX = MIN(bounds.MinX, rect.MinX);
+            bounds.MinY = MIN(bounds.MinY, rect.MinY);
+            bounds.MaxX = MAX(bounds.MaxX, rect.MaxX);
+            bounds.MaxY = MAX(bounds.MaxY, rect.MaxY);
+            lineRects[numLinesToDraw] = rect;
+            ++numLinesToDraw;
         }
 
-        __m128i* pBufferSSE = (__m128i*)pBuffer;
-        const __m128i* pPixelSSE = (const __m128i*)pPixel;
-        for (size_t k = 0; k < loopCount; ++k)
+        if (numLinesToDraw == 0)
         {
-            *pBufferSSE++ = *pPixelSSE++;
+            continue;
         }
 
-        pBuffer -= mask;
-        pBuffer += pRenderer->Pitch;
-        pPixel = (const uint32_t*)pPixelSSE;
-    }
-#endif
+        markDirty(pRenderer, &bounds);
+
+        uint_t i = 0;
+        if (pRenderer->bTileBinning)
+        {
+            for (; i < numLinesToDraw; ++i)
+            {
+                if (!TileBinnerAddLine(&pRenderer->TileBinner, lines[i][0], lines[i][1], lines[i][2], lines[i][3], argb))
+                {
+                    flushTileBinner(pRenderer);
+                    break;
+                }
+            }
+
+            if (i == numLinesToDraw)
+            {
+                continue;
+            }
+        }
+
+        resolveFastClear(pRenderer, &bounds);
+
+        uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+        if (isPackedFormat(pRenderer))
+        {
+            const uint32_t color = PackColor(pRenderer->BackBufferFormat, argb);
+            for (; i < numLinesToDraw; ++i)
+            {
+                RasterizePackedLine(pBackBuffer, pRenderer->Pitch, pRenderer->BytesPerPixel, &screenRect,
+                                    lines[i][0], lines[i][1], lines[i][2], lines[i][3], color);
+            }
+
+            continue;
+        }
+
+        if (pRenderer->bTiledLayout)
+        {
+            DRAW_COMMAND command;
+            command.Type = DRAW_COMMAND_LINE;
+            command.Argb = argb;
+            for (; i < numLinesToDraw; ++i)
+            {
+                command.Line.X0 = lines[i][0];
+                command.Line.Y0 = lines[i][1];
+                command.Line.X1 = lines[i][2];
+                command.Line.Y1 = lines[i][3];
+                drawTiled(pRenderer, &command, &lineRects[i]);
+            }
+
+            continue;
+        }
+
+        for (; i < numLinesToDraw; ++i)
+        {
+            RasterizeLine(pBackBuffer, pRenderer->Pitch, &screenRect, lines[i][0], lines[i][1], lines[i][2], lines[i][3], argb);
+        }
+    }
+}
+
+void __stdcall DrawBitmap(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap)
+{
+    DrawBitmapBlended(pThis, x, y, width, height, pBitmap, BLEND_MODE_OPAQUE);
+}
+
+void __stdcall DrawBitmapBlended(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                 const BLEND_MODE blendMode)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+    drawBitmap(pRenderer, x, y, width, height, pBitmap, width, blendMode);
+}
+
+void __stdcall DrawBitmapTransformed(IRenderer* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                     const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+    ASSERT(pTransform != NULL, "pTransform is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    // 샘플링한 A8R8G8B8을 섞어야 하므로 다른 형식의 백 버퍼에는 그리지 않음
+    if (isPackedFormat(pRenderer))
+    {
+        return;
+    }
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    TRANSFORMED_BITMAP_SETUP setup;
+    if (SetupTransformedBitmap(&setup, &screenRect, width, height, pBitmap, pTransform, filter, blendMode))
+    {
+        drawTransformedBitmap(pRenderer, &setup);
+    }
+}
+
+void __stdcall DrawSprites(IRenderer* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pSprites != NULL || numSprites == 0, "pSprites is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    // 텍스처는 A8R8G8B8이므로 다른 형식의 백 버퍼에는 그리지 않음
+    if (isPackedFormat(pRenderer))
+    {
+        return;
+    }
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    SPRITE_BATCH* pBatch = &pRenderer->SpriteBatch;
+    if (SpriteBatchBuild(pBatch, pSprites, numSprites, &screenRect, bSortByTexture))
+    {
+        for (uint_t i = 0; i < pBatch->NumDraws; ++i)
+        {
+            const SPRITE_DRAW* pDraw = &pBatch->pDraws[i];
+            drawBitmap(pRenderer, pDraw->X, pDraw->Y, pDraw->Width, pDraw->Height, pDraw->pSrc, pDraw->SrcPitch, pDraw->BlendMode);
+        }
+
+        return;
+    }
+
+    // 정렬할 메모리가 없으면 제출 순서대로 그림
+    for (uint_t i = 0; i < numSprites; ++i)
+    {
+        SPRITE_DRAW draw;
+        if (ClipSprite(&pSprites[i], &screenRect, &draw))
+        {
+            drawBitmap(pRenderer, draw.X, draw.Y, draw.Width, draw.Height, draw.pSrc, draw.SrcPitch, draw.BlendMode);
+        }
+    }
+}
+
+void __stdcall DrawTriangle(IRenderer* pThis, const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+
+    // 삼각형 래스터라이저는 A8R8G8B8에만 씀
+    if (isPackedFormat(pRenderer))
+    {
+        return;
+    }
+
+    TRIANGLE_SETUP setup;
+    if (SetupTriangle(&setup, 0, 0, pRenderer->Width - 1, pRenderer->Height - 1, pV0, pV1, pV2))
+    {
+        drawTriangleSetup(pRenderer, &setup);
+        return;
+    }
+
+    // 래스터라이저 좌표 범위를 넘는 삼각형은 가드 밴드로 잘라서 그림
+    const COLOR_VERTEX* pInputVertices[3] = { pV0, pV1, pV2 };
+    CLIP_POLYGON_VERTEX vertices[MAX_CLIP_POLYGON_VERTICES];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const COLOR_VERTEX* pVertex = pInputVertices[i];
+        vertices[i].X = pVertex->X;
+        vertices[i].Y = pVertex->Y;
+        vertices[i].Z = pVertex->Z;
+        vertices[i].W = 1.0f;
+        for (size_t j = 0; j < NUM_COLOR_CHANNELS; ++j)
+        {
+            vertices[i].Attributes[j] = (float)((pVertex->Argb >> (24 - 8 * j)) & 0xff);
+        }
+    }
+
+    drawGuardBandClippedTriangle(pRenderer, NULL, vertices);
+}
+
+void __stdcall DrawTriangles(IRenderer* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pVertices != NULL, "pVertices is NULL");
+
+    for (uint_t i = 0; i < numTriangles; ++i)
+    {
+        if (pIndices != NULL)
+        {
+            DrawTriangle(pThis, &pVertices[pIndices[3 * i]], &pVertices[pIndices[3 * i + 1]], &pVertices[pIndices[3 * i + 2]]);
+        }
+        else
+        {
+            DrawTriangle(pThis, &pVertices[3 * i], &pVertices[3 * i + 1], &pVertices[3 * i + 2]);
+        }
+    }
+}
+
+void __stdcall DrawTexturedTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                     const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pTexture != NULL, "pTexture is NULL");
+    ASSERT(pVertices != NULL, "pVertices is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+    if (isPackedFormat(pRenderer))
+    {
+        return;
+    }
+
+    TRIANGLE_SETUP setup;
+    for (uint_t i = 0; i < numTriangles; ++i)
+    {
+        const TEXTURE_VERTEX* pV0;
+        const TEXTURE_VERTEX* pV1;
+        const TEXTURE_VERTEX* pV2;
+        if (pIndices != NULL)
+        {
+            pV0 = &pVertices[pIndices[3 * i]];
+            pV1 = &pVertices[pIndices[3 * i + 1]];
+            pV2 = &pVertices[pIndices[3 * i + 2]];
+        }
+        else
+        {
+            pV0 = &pVertices[3 * i];
+            pV1 = &pVertices[3 * i + 1];
+            pV2 = &pVertices[3 * i + 2];
+        }
+
+        if (SetupTexturedTriangle(&setup, 0, 0, pRenderer->Width - 1, pRenderer->Height - 1,
+                                  pTexture, pRenderer->TextureFilter, pRenderer->TextureAddress, pV0, pV1, pV2))
+        {
+            drawTriangleSetup(pRenderer, &setup);
+            continue;
+        }
+
+        // 래스터라이저 좌표 범위를 넘는 삼각형은 화면 공간에서 선형인 u/w, v/w, 1/w로 잘라서 그림
+        const TEXTURE_VERTEX* pInputVertices[3] = { pV0, pV1, pV2 };
+        CLIP_POLYGON_VERTEX vertices[MAX_CLIP_POLYGON_VERTICES];
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const TEXTURE_VERTEX* pVertex = pInputVertices[j];
+            vertices[j].X = pVertex->X;
+            vertices[j].Y = pVertex->Y;
+            vertices[j].Z = pVertex->Z;
+            vertices[j].W = 1.0f;
+            vertices[j].Attributes[PERSPECTIVE_U] = pVertex->U * pVertex->Rhw;
+            vertices[j].Attributes[PERSPECTIVE_V] = pVertex->V * pVertex->Rhw;
+            vertices[j].Attributes[PERSPECTIVE_Q] = pVertex->Rhw;
+        }
+
+        drawGuardBandClippedTriangle(pRenderer, pTexture, vertices);
+    }
+}
+
+void __stdcall DrawClipSpaceTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                      const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pVertices != NULL, "pVertices is NULL");
+
+    Renderer* pRenderer = getDrawTarget((Renderer*)pThis);
+    if (isPackedFormat(pRenderer))
+    {
+        return;
+    }
+
+    // 화면 좌표 = (ndc + 1) * size / 2 가 가드 밴드 안에 들어오는 대칭 범위 (ndc 단위)
+    const float guardBandX = MAX(2.0f * GUARD_BAND_COORD / (float)pRenderer->Width - 1.0f, 1.0f);
+    const float guardBandY = MAX(2.0f * GUARD_BAND_COORD / (float)pRenderer->Height - 1.0f, 1.0f);
+    const float halfWidth = 0.5f * (float)pRenderer->Width;
+    const float halfHeight = 0.5f * (float)pRenderer->Height;
+
+    for (uint_t i = 0; i < numTriangles; ++i)
+    {
+        CLIP_POLYGON_VERTEX vertices[MAX_CLIP_POLYGON_VERTICES];
+        uint_t clipCodes[3];
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const CLIP_VERTEX* pVertex = &pVertices[(pIndices != NULL) ? pIndices[3 * i + j] : 3 * i + j];
+            vertices[j].X = pVertex->X;
+            vertices[j].Y = pVertex->Y;
+            vertices[j].Z = pVertex->Z;
+            vertices[j].W = pVertex->W;
+            if (pTexture != NULL)
+            {
+                vertices[j].Attributes[PERSPECTIVE_U] = pVertex->U;
+                vertices[j].Attributes[PERSPECTIVE_V] = pVertex->V;
+            }
+            else
+            {
+                for (size_t k = 0; k < NUM_COLOR_CHANNELS; ++k)
+                {
+                    vertices[j].Attributes[k] = (float)((pVertex->Argb >> (24 - 8 * k)) & 0xff);
+                }
+            }
+
+            clipCodes[j] = GetClipCode(&vertices[j], guardBandX, guardBandY);
+        }
+
+        // 한 평면 바깥에 모두 있으면 보이지 않음
+        if ((clipCodes[0] & clipCodes[1] & clipCodes[2]) != 0)
+        {
+            continue;
+        }
+
+        // 대부분의 삼각형은 자르지 않고 래스터라이저의 시저만 거침
+        uint_t numVertices = 3;
+        const uint_t planes = (clipCodes[0] | clipCodes[1] | clipCodes[2]) & CLIP_PLANES_TO_CLIP;
+        if (planes != 0)
+        {
+            numVertices = ClipPolygon(vertices, 3, planes, guardBandX, guardBandY);
+        }
+
+        bool bVisible = (numVertices >= 3);
+        for (uint_t j = 0; j < numVertices && bVisible; ++j)
+        {
+            CLIP_POLYGON_VERTEX* pVertex = &vertices[j];
+            if (!(pVertex->W > 0.0f))
+            {
+                bVisible = false;
+                break;
+            }
+
+            const float rhw = 1.0f / pVertex->W;
+            pVertex->X = (pVertex->X * rhw + 1.0f) * halfWidth;
+            pVertex->Y = (1.0f - pVertex->Y * rhw) * halfHeight;
+            pVertex->Z *= rhw;
+            pVertex->W = 1.0f;
+            if (pTexture != NULL)
+            {
+                pVertex->Attributes[PERSPECTIVE_U] *= rhw;
+                pVertex->Attributes[PERSPECTIVE_V] *= rhw;
+                pVertex->Attributes[PERSPECTIVE_Q] = rhw;
+            }
+        }
+
+        if (bVisible)
+        {
+            drawPolygon(pRenderer, pTexture, vertices, numVertices);
+        }
+    }
+}
+
+bool __stdcall CreateCommandList(IRenderer* pThis, ICommandList** ppOutCommandList)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(ppOutCommandList != NULL, "ppOutCommandList is NULL");
+
+    *ppOutCommandList = CreateCommandListInstance();
+    return *ppOutCommandList != NULL;
+}
+
+void __stdcall ExecuteCommandList(IRenderer* pThis, const ICommandList* pCommandList)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pCommandList != NULL, "pCommandList is NULL");
+
+    // 인자는 기록할 때 검사했으므로 vtable을 거치지 않고 바로 호출
+    const CommandList* pList = (const CommandList*)pCommandList;
+    const char* pCommand = pList->pCommands;
+    const char* pEnd = pList->pCommands + pList->Size;
+    while (pCommand < pEnd)
+    {
+        const LIST_COMMAND_HEADER* pHeader = (const LIST_COMMAND_HEADER*)pCommand;
+        switch ((LIST_COMMAND_TYPE)pHeader->Type)
+        {
+        case LIST_COMMAND_CLEAR:
+        {
+            const LIST_CLEAR_COMMAND* pClear = (const LIST_CLEAR_COMMAND*)pCommand;
+            Clear(pThis, pClear->Argb);
+            break;
+        }
+        case LIST_COMMAND_CLEAR_DEPTH:
+        {
+            const LIST_CLEAR_DEPTH_COMMAND* pClearDepth = (const LIST_CLEAR_DEPTH_COMMAND*)pCommand;
+            ClearDepth(pThis, pClearDepth->Depth);
+            break;
+        }
+        case LIST_COMMAND_DRAW_HORIZONTAL_LINE:
+        {
+            const LIST_SPAN_LINE_COMMAND* pLine = (const LIST_SPAN_LINE_COMMAND*)pCommand;
+            DrawHorizontalLine(pThis, pLine->X, pLine->Y, pLine->Length, pLine->Argb);
+            break;
+        }
+        case LIST_COMMAND_DRAW_VERTICAL_LINE:
+        {
+            const LIST_SPAN_LINE_COMMAND* pLine = (const LIST_SPAN_LINE_COMMAND*)pCommand;
+            DrawVerticalLine(pThis, pLine->X, pLine->Y, pLine->Length, pLine->Argb);
+            break;
+        }
+        case LIST_COMMAND_DRAW_LINE:
+        {
+            const LIST_LINE_COMMAND* pLine = (const LIST_LINE_COMMAND*)pCommand;
+            DrawLine(pThis, pLine->X0, pLine->Y0, pLine->X1, pLine->Y1, pLine->Argb);
+            break;
+        }
+        case LIST_COMMAND_DRAW_LINES:
+        {
+            const LIST_LINES_COMMAND* pLines = (const LIST_LINES_COMMAND*)pCommand;
+            const size_t arraySize = ALIGN_COMMAND_SIZE(sizeof(int) * pLines->NumLines);
+            const char* pArrays = pCommand + ALIGN_COMMAND_SIZE(sizeof(LIST_LINES_COMMAND));
+            DrawLines(pThis, (const int*)pArrays, (const int*)(pArrays + arraySize),
+                      (const int*)(pArrays + 2 * arraySize), (const int*)(pArrays + 3 * arraySize), pLines->NumLines, pLines->Argb);
+            break;
+        }
+        case LIST_COMMAND_DRAW_BITMAP:
+        {
+            const LIST_BITMAP_COMMAND* pBitmap = (const LIST_BITMAP_COMMAND*)pCommand;
+            DrawBitmapBlended(pThis, pBitmap->X, pBitmap->Y, pBitmap->Width, pBitmap->Height,
+                              pBitmap->pBitmap, pBitmap->BlendMode);
+            break;
+        }
+        case LIST_COMMAND_DRAW_BITMAP_TRANSFORMED:
+        {
+            const LIST_BITMAP_TRANSFORMED_COMMAND* pBitmap = (const LIST_BITMAP_TRANSFORMED_COMMAND*)pCommand;
+            DrawBitmapTransformed(pThis, pBitmap->Width, pBitmap->Height, pBitmap->pBitmap,
+                                  &pBitmap->Transform, pBitmap->Filter, pBitmap->BlendMode);
+            break;
+        }
+        case LIST_COMMAND_DRAW_SPRITES:
+        {
+            const LIST_SPRITES_COMMAND* pSprites = (const LIST_SPRITES_COMMAND*)pCommand;
+            DrawSprites(pThis, (const SPRITE*)(pCommand + ALIGN_COMMAND_SIZE(sizeof(LIST_SPRITES_COMMAND))),
+                        pSprites->NumSprites, pSprites->bSortByTexture);
+            break;
+        }
+        case LIST_COMMAND_DRAW_TRIANGLES:
+        case LIST_COMMAND_DRAW_TEXTURED_TRIANGLES:
+        case LIST_COMMAND_DRAW_CLIP_SPACE_TRIANGLES:
+        {
+            const LIST_TRIANGLES_COMMAND* pTriangles = (const LIST_TRIANGLES_COMMAND*)pCommand;
+            const char* pVertices = pCommand + ALIGN_COMMAND_SIZE(sizeof(LIST_TRIANGLES_COMMAND));
+
+            size_t vertexSize = sizeof(COLOR_VERTEX);
+            if (pHeader->Type == LIST_COMMAND_DRAW_TEXTURED_TRIANGLES)
+            {
+                vertexSize = sizeof(TEXTURE_VERTEX);
+            }
+            else if (pHeader->Type == LIST_COMMAND_DRAW_CLIP_SPACE_TRIANGLES)
+            {
+                vertexSize = sizeof(CLIP_VERTEX);
+            }
+
+            const uint16_t* pIndices = NULL;
+            if (pTriangles->bIndexed)
+            {
+                pIndices = (const uint16_t*)(pVertices + ALIGN_COMMAND_SIZE(vertexSize * pTriangles->NumVertices));
+            }
+
+            if (pHeader->Type == LIST_COMMAND_DRAW_TRIANGLES)
+            {
+                DrawTriangles(pThis, (const COLOR_VERTEX*)pVertices, pIndices, pTriangles->NumTriangles);
+            }
+            else if (pHeader->Type == LIST_COMMAND_DRAW_TEXTURED_TRIANGLES)
+            {
+                DrawTexturedTriangles(pThis, pTriangles->pTexture, (const TEXTURE_VERTEX*)pVertices, pIndices, pTriangles->NumTriangles);
+            }
+            else
+            {
+                DrawClipSpaceTriangles(pThis, pTriangles->pTexture, (const CLIP_VERTEX*)pVertices, pIndices, pTriangles->NumTriangles);
+            }
+            break;
+        }
+        case LIST_COMMAND_SET_TEXTURE_SAMPLER:
+        {
+            const LIST_TEXTURE_SAMPLER_COMMAND* pSampler = (const LIST_TEXTURE_SAMPLER_COMMAND*)pCommand;
+            SetTextureSampler(pThis, pSampler->Filter, pSampler->Address);
+            break;
+        }
+        case LIST_COMMAND_SET_RENDER_TARGET:
+        {
+            const LIST_RENDER_TARGET_COMMAND* pRenderTarget = (const LIST_RENDER_TARGET_COMMAND*)pCommand;
+            SetRenderTarget(pThis, pRenderTarget->pTarget);
+            break;
+        }
+        default:
+            ASSERT(false, "Unknown command");
+            break;
+        }
+
+        pCommand += pHeader->Size;
+    }
+}
+
+bool __stdcall CreateRenderTarget(IRenderer* pThis, const uint_t width, const uint_t height, const DEPTH_FORMAT depthFormat,
+                                 IRenderTarget** ppOutTarget)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(width > 0, "width is 0");
+    ASSERT(height > 0, "height is 0");
+    ASSERT(ppOutTarget != NULL, "ppOutTarget is NULL");
+
+    *ppOutTarget = NULL;
+
+    // 텍스처로 바로 쓰도록 너비를 피치에 맞춤
+    const uint_t padding = DEFAULT_ALIGN - width % DEFAULT_ALIGN;
+    const uint_t pitch = width + ((padding == DEFAULT_ALIGN) ? 0 : padding);
+
+    IRenderer* pRenderer = createHeadlessRenderer(pitch, height, depthFormat);
+    if (pRenderer == NULL)
+    {
+        return false;
+    }
+
+    *ppOutTarget = CreateRenderTargetInstance(pRenderer);
+    if (*ppOutTarget == NULL)
+    {
+        pRenderer->Release(pRenderer);
+        return false;
+    }
+
+    return true;
+}
+
+void __stdcall SetRenderTarget(IRenderer* pThis, IRenderTarget* pTarget)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+
+    // 모아둔 명령이 렌더 타겟을 원본으로 쓸 수 있으므로 렌더 타겟에 그리기 전에 먼저 그림
+    flushTileBinner(pRenderer);
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        flushTileBinner(pRenderer->pScaledSurface);
+    }
+
+    pRenderer->pRenderTarget = pTarget;
+
+    Renderer* pTargetRenderer = getDrawTarget(pRenderer);
+    pTargetRenderer->TextureFilter = pRenderer->TextureFilter;
+    pTargetRenderer->TextureAddress = pRenderer->TextureAddress;
 }
 
 void __stdcall SetMaxFps(IRenderer* pThis, const uint_t fps)
@@ -513,7 +1639,7 @@ void __stdcall SetMaxFps(IRenderer* pThis, const uint_t fps)
 
     Renderer* pRenderer = (Renderer*)pThis;
     pRenderer->MaxFps = (fps == 0) ? UINT_MAX : fps;
-    pRenderer->TicksPerFrame = (fps == 0) ? 0.0f : 1000.0f / (float)fps / 1000.0f;
+    FramePacerSetInterval(&pRenderer->FramePacer, (fps == 0) ? 0 : (1000000000ull + fps / 2) / fps);
 }
 
 uint_t __stdcall GetFps(const IRenderer* pThis)
@@ -524,6 +1650,1701 @@ uint_t __stdcall GetFps(const IRenderer* pThis)
     return pRenderer->Fps;
 }
 
+bool __stdcall SetNumRasterThreads(IRenderer* pThis, const uint_t numThreads)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    // 동적 해상도의 내부 서피스도 같은 수의 스레드로 그림
+    const bool bSurfaceResult = (pRenderer->pScaledSurface == NULL) || SetNumRasterThreads(&pRenderer->pScaledSurface->Vtbl, numThreads);
+
+    if (pRenderer->bTileBinning)
+    {
+        flushTileBinner(pRenderer);
+        TileBinnerRelease(&pRenderer->TileBinner);
+        pRenderer->bTileBinning = false;
+    }
+
+    if (numThreads == 0)
+    {
+        return bSurfaceResult;
+    }
+
+    // 타일 워커는 A8R8G8B8 커널만 씀
+    if (isPackedFormat(pRenderer))
+    {
+        return false;
+    }
+
+    resolveFastClear(pRenderer, NULL);
+
+    pRenderer->bTileBinning = TileBinnerInit(&pRenderer->TileBinner, numThreads, pRenderer->Width, pRenderer->Height, pRenderer->Pitch,
+                                             getTiledHeight(pRenderer));
+    if (pRenderer->bTileBinning)
+    {
+        TileBinnerSetDepthBuffer(&pRenderer->TileBinner, getDepthBuffer(pRenderer));
+    }
+
+    return pRenderer->bTileBinning && bSurfaceResult;
+}
+
+bool __stdcall SetDepthFormat(IRenderer* pThis, const DEPTH_FORMAT format)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    if (format == pRenderer->DepthBuffer.Format)
+    {
+        return true;
+    }
+
+    flushTileBinner(pRenderer);
+
+    if (pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE)
+    {
+        DepthBufferRelease(&pRenderer->DepthBuffer);
+    }
+
+    bool bResult = true;
+    if (format != DEPTH_FORMAT_NONE)
+    {
+        bResult = DepthBufferInit(&pRenderer->DepthBuffer, format, pRenderer->Pitch, getBufferHeight(pRenderer));
+    }
+
+    if (pRenderer->bTileBinning)
+    {
+        TileBinnerSetDepthBuffer(&pRenderer->TileBinner, getDepthBuffer(pRenderer));
+    }
+
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        bResult = SetDepthFormat(&pRenderer->pScaledSurface->Vtbl, format) && bResult;
+    }
+
+    return bResult;
+}
+
+static bool initBackBuffers(Renderer* pRenderer, const uint_t width, const uint_t height)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    const uint_t padding = DEFAULT_ALIGN - width % DEFAULT_ALIGN;
+    const uint_t pitch = width + ((padding == DEFAULT_ALIGN) ? 0 : padding);
+
+    // 나머지 백 버퍼는 SetNumBackBuffers에서 만듦
+    uint32_t* pBackBuffer = (uint32_t*)ALIGNED_MALLOC(4 * pitch * height, BACK_BUFFER_ALIGN);
+    if (pBackBuffer == NULL)
+    {
+        ASSERT(false, "Failed to malloc");
+        return false;
+    }
+
+    memset(pBackBuffer, 0, 4 * pitch * height);
+    pRenderer->pBackBuffers[0] = pBackBuffer;
+
+    pRenderer->NumBackBuffers = 1;
+    pRenderer->BackBufferIndex = 0;
+    pRenderer->FrontBufferIndex = 0;
+    pRenderer->Pitch = pitch;
+    pRenderer->Width = width;
+    pRenderer->Height = height;
+
+    pRenderer->BackBufferFormat = BACK_BUFFER_FORMAT_A8R8G8B8;
+    pRenderer->BytesPerPixel = 4;
+    for (uint_t i = 0; i < NUM_PALETTE_ENTRIES; ++i)
+    {
+        pRenderer->Palette[i] = 0xff000000 | (i * 0x010101);
+    }
+
+    markAllDirty(pRenderer);
+
+    pRenderer->bAsyncPresent = false;
+    pRenderer->PresentFence = 0;
+    storeFence(&pRenderer->CompletedPresentFence, 0);
+    memset(pRenderer->BufferFences, 0, sizeof(pRenderer->BufferFences));
+    memset(pRenderer->BufferDirtyRects, 0, sizeof(pRenderer->BufferDirtyRects));
+
+    FramePacerInit(&pRenderer->FramePacer);
+    pRenderer->MaxFps = UINT32_MAX;
+    pRenderer->Fps = 0;
+
+    return true;
+}
+
+// 메모리를 할당하지 못하면 효과 없이 복사
+static void applyPostEffects(Renderer* pRenderer, const uint32_t* pFrame)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pRenderer->bPostProcess, "Post process is disabled");
+
+    if (!PostProcessRun(&pRenderer->PostProcess, pRenderer->pPresentBuffer, pFrame, pRenderer->Pitch, pRenderer->Width, pRenderer->Height))
+    {
+        memcpy(pRenderer->pPresentBuffer, pFrame, sizeof(uint32_t) * pRenderer->Pitch * pRenderer->Height);
+    }
+}
+
+// 헤드리스 모드는 GetFrontBuffer로 프레임을 직접 가져가므로 출력할 것이 없음
+// pDirtyRects가 NULL이면 전체를 출력
+static void present(Renderer* pRenderer, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    // 바뀐 영역만 펼치므로 펼친 버퍼는 항상 마지막으로 출력한 프레임과 같음
+    const uint32_t* pFrame = pRenderer->pBackBuffers[bufferIndex];
+    if (pRenderer->bPostProcess)
+    {
+        // 블러는 바뀐 영역 밖으로 번지므로 바뀐 것이 있으면 전체를 다시 처리해서 전체를 출력
+        if (pDirtyRects == NULL || pDirtyRects->NumRects > 0)
+        {
+            applyPostEffects(pRenderer, pFrame);
+            pDirtyRects = NULL;
+        }
+
+        pFrame = pRenderer->pPresentBuffer;
+    }
+    else if (pRenderer->pPresentBuffer != NULL)
+    {
+        const CLIP_RECT fullRect = { 0, 0, (int)pRenderer->Pitch - 1, (int)pRenderer->Height - 1 };
+        const CLIP_RECT* pRects = (pDirtyRects != NULL) ? pDirtyRects->Rects : &fullRect;
+        const uint_t numRects = (pDirtyRects != NULL) ? pDirtyRects->NumRects : 1;
+        for (uint_t i = 0; i < numRects; ++i)
+        {
+            if (pRenderer->bTiledLayout)
+            {
+                DetileRect(pRenderer->pPresentBuffer, pRenderer->Pitch, pFrame, getTiledHeight(pRenderer), &pRects[i]);
+            }
+            else
+            {
+                ExpandPackedRect(pRenderer->pPresentBuffer, pFrame, pRenderer->Pitch, pRenderer->BackBufferFormat, pRenderer->Palette, &pRects[i]);
+            }
+        }
+
+        pFrame = pRenderer->pPresentBuffer;
+    }
+
+    switch (pRenderer->PresentMode)
+    {
+#if defined(UW_PLATFORM_WIN)
+    case PRESENT_MODE_GDI:
+        if (pDirtyRects == NULL)
+        {
+            StretchDIBits(pRenderer->hdc,
+                          0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
+                          0, 0, (int)pRenderer->Pitch, (int)pRenderer->Height,
+                          pFrame, &pRenderer->Bmi, DIB_RGB_COLORS, SRCCOPY);
+            break;
+        }
+
+        for (uint_t i = 0; i < pDirtyRects->NumRects; ++i)
+        {
+            const CLIP_RECT* pRect = &pDirtyRects->Rects[i];
+            const int width = pRect->MaxX - pRect->MinX + 1;
+            const int height = pRect->MaxY - pRect->MinY + 1;
+
+            // 원본 y는 top-down DIB여도 아래쪽 기준
+            StretchDIBits(pRenderer->hdc,
+                          pRect->MinX, pRect->MinY, width, height,
+                          pRect->MinX, (int)pRenderer->Height - 1 - pRect->MaxY, width, height,
+                          pFrame, &pRenderer->Bmi, DIB_RGB_COLORS, SRCCOPY);
+        }
+        break;
+#endif // UW_PLATFORM_WIN
+    case PRESENT_MODE_MEMORY:
+    default:
+        (void)pFrame;
+        break;
+    }
+}
+
+static void __stdcall presentFromQueue(void* pContext, const uint_t bufferIndex, const DIRTY_RECTS* pDirtyRects)
+{
+    present((Renderer*)pContext, bufferIndex, pDirtyRects);
+}
+
+// 백 버퍼를 앞 버퍼로 넘기고 다음 백 버퍼를 준비
+static void submitFrame(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    const uint8_t bufferIndex = pRenderer->BackBufferIndex;
+    pRenderer->FrontBufferIndex = bufferIndex;
+    pRenderer->BufferDirtyRects[bufferIndex] = pRenderer->DirtyRects;
+
+    if (pRenderer->bAsyncPresent)
+    {
+        pRenderer->PresentFence = PresentQueueSubmit(&pRenderer->PresentQueue, bufferIndex, &pRenderer->DirtyRects);
+    }
+    else
+    {
+        present(pRenderer, bufferIndex, &pRenderer->DirtyRects);
+        ++pRenderer->PresentFence;
+        storeFence(&pRenderer->CompletedPresentFence, pRenderer->PresentFence);
+    }
+
+    pRenderer->BufferFences[bufferIndex] = pRenderer->PresentFence;
+    DirtyRectsReset(&pRenderer->DirtyRects);
+
+    pRenderer->BackBufferIndex = (uint8_t)((bufferIndex + 1) % pRenderer->NumBackBuffers);
+    prepareBackBuffer(pRenderer);
+}
+
+// 출력 중인 버퍼에 그리지 않도록 기다리고 뒤처진 영역을 기록
+static void prepareBackBuffer(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    const uint8_t bufferIndex = pRenderer->BackBufferIndex;
+    if (pRenderer->bAsyncPresent)
+    {
+        PresentQueueWait(&pRenderer->PresentQueue, pRenderer->BufferFences[bufferIndex]);
+    }
+
+    // 다른 버퍼들은 이 버퍼보다 최근 프레임이므로 그 프레임들에서 바뀐 영역만큼 뒤처져 있음
+    DirtyRectsReset(&pRenderer->PreserveRects);
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers; ++i)
+    {
+        if (i == bufferIndex)
+        {
+            continue;
+        }
+
+        const DIRTY_RECTS* pBufferDirtyRects = &pRenderer->BufferDirtyRects[i];
+        for (uint_t j = 0; j < pBufferDirtyRects->NumRects; ++j)
+        {
+            DirtyRectsAdd(&pRenderer->PreserveRects, &pBufferDirtyRects->Rects[j]);
+        }
+    }
+
+    pRenderer->bPreservePending = (pRenderer->PreserveRects.NumRects > 0);
+}
+
+// 앞 버퍼는 항상 최신 프레임 전체를 가지고 있음
+static void preserveBackBuffer(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (!pRenderer->bPreservePending)
+    {
+        return;
+    }
+
+    pRenderer->bPreservePending = false;
+
+    const uint32_t* pFrontBuffer = pRenderer->pBackBuffers[pRenderer->FrontBufferIndex];
+    uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+    const uint_t pitch = pRenderer->Pitch;
+    const uint_t bytesPerPixel = pRenderer->BytesPerPixel;
+    for (uint_t i = 0; i < pRenderer->PreserveRects.NumRects; ++i)
+    {
+        const CLIP_RECT* pRect = &pRenderer->PreserveRects.Rects[i];
+        if (bytesPerPixel == 4)
+        {
+            CopySurfaceRect(pBackBuffer, pFrontBuffer, pitch, getTiledHeight(pRenderer), pRect);
+            continue;
+        }
+
+        const size_t width = (size_t)(pRect->MaxX - pRect->MinX + 1);
+        for (int y = pRect->MinY; y <= pRect->MaxY; ++y)
+        {
+            const size_t offset = (size_t)y * pitch + pRect->MinX;
+            memcpy((uint8_t*)pBackBuffer + offset * bytesPerPixel, (const uint8_t*)pFrontBuffer + offset * bytesPerPixel, width * bytesPerPixel);
+        }
+    }
+}
+
+static void waitForPresentIdle(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->bAsyncPresent)
+    {
+        PresentQueueWait(&pRenderer->PresentQueue, pRenderer->PresentFence);
+    }
+}
+
+// 렌더 스레드가 프레임을 출력하는 동안에도 GetCompletedPresentFence가 기다리지 않고 읽음
+static void storeFence(volatile uint64_t* pFence, const uint64_t fence)
+{
+#if defined(UW_PLATFORM_WIN)
+    InterlockedExchange64((volatile LONG64*)pFence, (LONG64)fence);
+#else
+    __atomic_store_n(pFence, fence, __ATOMIC_RELEASE);
+#endif // UW_PLATFORM_WIN
+}
+
+static uint64_t loadFence(const volatile uint64_t* pFence)
+{
+#if defined(UW_PLATFORM_WIN)
+    return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)pFence, 0, 0);
+#else
+    return __atomic_load_n(pFence, __ATOMIC_ACQUIRE);
+#endif // UW_PLATFORM_WIN
+}
+
+// 렌더 스레드 모드에서 렌더러 상태를 바꾸거나 읽기 전에 제출한 프레임을 모두 그림
+static void waitForRenderThreadIdle(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->bRenderThread)
+    {
+        RenderThreadWaitIdle(&pRenderer->RenderThread);
+    }
+}
+
+static void finishFrame(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    flushTileBinner(pRenderer);
+    resolveFastClear(pRenderer, NULL);
+
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        upscaleScaledSurface(pRenderer);
+    }
+
+    // 바뀐 것이 없으면 출력하지 않고 같은 백 버퍼를 계속 씀
+    if (pRenderer->DirtyRects.NumRects > 0)
+    {
+        submitFrame(pRenderer);
+    }
+
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        updateDynamicResolution(pRenderer);
+    }
+}
+
+// 렌더 스레드에서 호출
+static void __stdcall renderFrameFromThread(void* pContext, const ICommandList* pCommandList)
+{
+    Renderer* pRenderer = (Renderer*)pContext;
+
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        HighPerformanceTimerUpdate(&pRenderer->FrameTimer, 0.0f);
+        applyRenderSize(pRenderer, pRenderer->FrameRenderWidth, pRenderer->FrameRenderHeight);
+    }
+
+    ExecuteCommandList(&pRenderer->Vtbl, pCommandList);
+    finishFrame(pRenderer);
+}
+
+// 화면 안에 찍히는 점들을 감싸는 영역, 찍히는 점이 없으면 false
+static bool getLineBounds(const LINE_STEPS* pLine, const CLIP_RECT* pScreenRect, CLIP_RECT* pOutRect)
+{
+    ASSERT(pLine != NULL, "pLine is NULL");
+    ASSERT(pScreenRect != NULL, "pScreenRect is NULL");
+    ASSERT(pOutRect != NULL, "pOutRect is NULL");
+
+    int firstStep;
+    int lastStep;
+    if (!ClipLine(pScreenRect, pLine, &firstStep, &lastStep))
+    {
+        return false;
+    }
+
+    int firstX;
+    int firstY;
+    int lastX;
+    int lastY;
+    GetLineStepPoint(pLine, firstStep, &firstX, &firstY);
+    GetLineStepPoint(pLine, lastStep, &lastX, &lastY);
+
+    pOutRect->MinX = MIN(firstX, lastX);
+    pOutRect->MinY = MIN(firstY, lastY);
+    pOutRect->MaxX = MAX(firstX, lastX);
+    pOutRect->MaxY = MAX(firstY, lastY);
+
+    return true;
+}
+
+static void getScreenRect(const Renderer* pRenderer, CLIP_RECT* pOutRect)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pOutRect != NULL, "pOutRect is NULL");
+
+    pOutRect->MinX = 0;
+    pOutRect->MinY = 0;
+    pOutRect->MaxX = (int)pRenderer->Width - 1;
+    pOutRect->MaxY = (int)pRenderer->Height - 1;
+}
+
+static void flushTileBinner(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->bTileBinning)
+    {
+        // 타일 워커는 지연된 Clear를 모르므로 먼저 채움
+        resolveFastClear(pRenderer, NULL);
+        TileBinnerFlush(&pRenderer->TileBinner, pRenderer->pBackBuffers[pRenderer->BackBufferIndex]);
+    }
+}
+
+static void resolveFastClear(Renderer* pRenderer, const CLIP_RECT* pRect)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->bFastClear)
+    {
+        FastClearResolve(&pRenderer->FastClear, pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRect);
+    }
+}
+
+// 그리기 직전에 호출
+static void markDirty(Renderer* pRenderer, const CLIP_RECT* pRect)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    preserveBackBuffer(pRenderer);
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    CLIP_RECT rect;
+    if (IntersectClipRect(pRect, &screenRect, &rect))
+    {
+        DirtyRectsAdd(&pRenderer->DirtyRects, &rect);
+    }
+}
+
+static void markAllDirty(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    DirtyRectsReset(&pRenderer->DirtyRects);
+    DirtyRectsAdd(&pRenderer->DirtyRects, &screenRect);
+
+    // 화면 전체를 덮어쓰므로 뒤처진 영역을 복사할 필요가 없음
+    pRenderer->bPreservePending = false;
+}
+
+void __stdcall SetTextureSampler(IRenderer* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    pRenderer->TextureFilter = filter;
+    pRenderer->TextureAddress = address;
+
+    Renderer* pTargetRenderer = getDrawTarget(pRenderer);
+    pTargetRenderer->TextureFilter = filter;
+    pTargetRenderer->TextureAddress = address;
+}
+
+bool __stdcall SetSimdLevel(IRenderer* pThis, const SIMD_LEVEL level)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+
+    // 모아둔 명령은 이전 커널로 먼저 그림
+    flushTileBinner(pRenderer);
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        flushTileBinner(pRenderer->pScaledSurface);
+    }
+
+    return SelectSpanKernels(level);
+}
+
+SIMD_LEVEL __stdcall GetSimdLevel(const IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    return GetSelectedSimdLevel();
+}
+
+bool __stdcall SetFastClear(IRenderer* pThis, const bool bEnable)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    if (bEnable == pRenderer->bFastClear)
+    {
+        return true;
+    }
+
+    if (!bEnable)
+    {
+        resolveFastClear(pRenderer, NULL);
+        FastClearRelease(&pRenderer->FastClear);
+        pRenderer->bFastClear = false;
+
+        return true;
+    }
+
+    // 지연된 Clear는 A8R8G8B8 값으로 채움
+    if (isPackedFormat(pRenderer))
+    {
+        return false;
+    }
+
+    pRenderer->bFastClear = FastClearInit(&pRenderer->FastClear, pRenderer->Pitch, pRenderer->Height, getTiledHeight(pRenderer));
+    return pRenderer->bFastClear;
+}
+
+bool __stdcall SetNumBackBuffers(IRenderer* pThis, const uint_t numBuffers)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(numBuffers >= 1 && numBuffers <= NUM_MAX_BACK_BUFFERS, "Invalid numBuffers");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    if (numBuffers == pRenderer->NumBackBuffers)
+    {
+        return true;
+    }
+
+    flushTileBinner(pRenderer);
+    resolveFastClear(pRenderer, NULL);
+    preserveBackBuffer(pRenderer);
+    waitForPresentIdle(pRenderer);
+
+    // 그리고 있던 백 버퍼는 0번으로 두고 나머지는 앞 버퍼 내용으로 채움, 남는 버퍼는 앞 버퍼부터 재사용
+    uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+    uint32_t* pFrontBuffer = pRenderer->pBackBuffers[pRenderer->FrontBufferIndex];
+
+    uint32_t* pSpareBuffers[NUM_MAX_BACK_BUFFERS];
+    uint_t numSpareBuffers = 0;
+    if (pFrontBuffer != pBackBuffer)
+    {
+        pSpareBuffers[numSpareBuffers++] = pFrontBuffer;
+    }
+
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers; ++i)
+    {
+        if (pRenderer->pBackBuffers[i] != pBackBuffer && pRenderer->pBackBuffers[i] != pFrontBuffer)
+        {
+            pSpareBuffers[numSpareBuffers++] = pRenderer->pBackBuffers[i];
+        }
+    }
+
+    const size_t bufferSize = pRenderer->BytesPerPixel * (size_t)pRenderer->Pitch * getBufferHeight(pRenderer);
+    uint32_t* pNewBackBuffers[NUM_MAX_BACK_BUFFERS] = { pBackBuffer, };
+    for (uint_t i = 1; i < numBuffers; ++i)
+    {
+        if (i - 1 < numSpareBuffers)
+        {
+            pNewBackBuffers[i] = pSpareBuffers[i - 1];
+            continue;
+        }
+
+        pNewBackBuffers[i] = (uint32_t*)ALIGNED_MALLOC(bufferSize, BACK_BUFFER_ALIGN);
+        if (pNewBackBuffers[i] == NULL)
+        {
+            for (uint_t j = numSpareBuffers + 1; j < i; ++j)
+            {
+                SAFE_ALIGNED_FREE(pNewBackBuffers[j]);
+            }
+
+            return false;
+        }
+    }
+
+    for (uint_t i = 1; i < numBuffers; ++i)
+    {
+        if (pNewBackBuffers[i] != pFrontBuffer)
+        {
+            memcpy(pNewBackBuffers[i], pFrontBuffer, bufferSize);
+        }
+    }
+
+    for (uint_t i = numBuffers - 1; i < numSpareBuffers; ++i)
+    {
+        SAFE_ALIGNED_FREE(pSpareBuffers[i]);
+    }
+
+    memcpy(pRenderer->pBackBuffers, pNewBackBuffers, sizeof(pNewBackBuffers));
+    pRenderer->NumBackBuffers = (uint8_t)numBuffers;
+    pRenderer->BackBufferIndex = 0;
+    pRenderer->FrontBufferIndex = (pFrontBuffer != pBackBuffer && numBuffers > 1) ? 1 : 0;
+
+    // 0번을 뺀 모든 버퍼가 앞 버퍼와 같고 0번에 그린 영역은 DirtyRects에 있음
+    for (uint_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
+    {
+        pRenderer->BufferFences[i] = pRenderer->PresentFence;
+        DirtyRectsReset(&pRenderer->BufferDirtyRects[i]);
+    }
+
+    if (numBuffers == 1 && pRenderer->bAsyncPresent)
+    {
+        PresentQueueRelease(&pRenderer->PresentQueue);
+        pRenderer->bAsyncPresent = false;
+        storeFence(&pRenderer->CompletedPresentFence, pRenderer->PresentFence);
+    }
+    else if (numBuffers > 1 && !pRenderer->bAsyncPresent)
+    {
+        // 스레드를 만들지 못하면 EndRender에서 바로 출력
+        pRenderer->bAsyncPresent = PresentQueueInit(&pRenderer->PresentQueue, presentFromQueue, pRenderer, pRenderer->PresentFence);
+        return pRenderer->bAsyncPresent;
+    }
+
+    return true;
+}
+
+uint64_t __stdcall GetPresentFence(const IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+
+    return pRenderer->PresentFence;
+}
+
+uint64_t __stdcall GetCompletedPresentFence(const IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    if (pRenderer->bAsyncPresent)
+    {
+        return PresentQueueGetCompletedFence(&pRenderer->PresentQueue);
+    }
+
+    return loadFence(&pRenderer->CompletedPresentFence);
+}
+
+void __stdcall WaitForPresentFence(IRenderer* pThis, const uint64_t fence)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+    ASSERT(fence <= pRenderer->PresentFence, "Waiting for a fence that was never submitted");
+
+    if (pRenderer->bAsyncPresent)
+    {
+        PresentQueueWait(&pRenderer->PresentQueue, fence);
+    }
+}
+
+bool __stdcall SetRenderThread(IRenderer* pThis, const bool bEnable)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+
+    if (bEnable == pRenderer->bRenderThread)
+    {
+        return true;
+    }
+
+    if (!bEnable)
+    {
+        RenderThreadRelease(&pRenderer->RenderThread);
+        pRenderer->bRenderThread = false;
+        pRenderer->Vtbl = s_vtbl;
+
+        // 마지막 프레임을 그린 크기에서 GetRenderWidth, GetRenderHeight가 알려준 크기로 바꿈
+        if (pRenderer->pScaledSurface != NULL)
+        {
+            applyRenderSize(pRenderer, pRenderer->RenderWidth, pRenderer->RenderHeight);
+        }
+
+        return true;
+    }
+
+    if (!RenderThreadInit(&pRenderer->RenderThread, renderFrameFromThread, pRenderer))
+    {
+        return false;
+    }
+
+    pRenderer->bRenderThread = true;
+    pRenderer->Vtbl = s_renderThreadVtbl;
+
+    return true;
+}
+
+bool __stdcall SetBackBufferFormat(IRenderer* pThis, const BACK_BUFFER_FORMAT format)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    if (format == pRenderer->BackBufferFormat)
+    {
+        return true;
+    }
+
+    const bool bPacked = (format != BACK_BUFFER_FORMAT_A8R8G8B8);
+    if (bPacked && (pRenderer->bTileBinning || pRenderer->bFastClear || pRenderer->bTiledLayout || pRenderer->pScaledSurface != NULL
+                    || pRenderer->bPostProcess))
+    {
+        return false;
+    }
+
+    waitForPresentIdle(pRenderer);
+
+    const uint_t bytesPerPixel = GetBytesPerPixel(format);
+    const size_t numPixels = (size_t)pRenderer->Pitch * pRenderer->Height;
+
+    uint32_t* pNewBackBuffers[NUM_MAX_BACK_BUFFERS] = { NULL, };
+    uint32_t* pPresentBuffer = NULL;
+    bool bResult = true;
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers && bResult; ++i)
+    {
+        pNewBackBuffers[i] = (uint32_t*)ALIGNED_MALLOC(bytesPerPixel * numPixels, BACK_BUFFER_ALIGN);
+        bResult = (pNewBackBuffers[i] != NULL);
+    }
+
+    if (bResult && bPacked)
+    {
+        pPresentBuffer = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * numPixels, BACK_BUFFER_ALIGN);
+        bResult = (pPresentBuffer != NULL);
+    }
+
+    if (!bResult)
+    {
+        for (uint_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
+        {
+            SAFE_ALIGNED_FREE(pNewBackBuffers[i]);
+        }
+
+        SAFE_ALIGNED_FREE(pPresentBuffer);
+        return false;
+    }
+
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers; ++i)
+    {
+        memset(pNewBackBuffers[i], 0, bytesPerPixel * numPixels);
+
+        SAFE_ALIGNED_FREE(pRenderer->pBackBuffers[i]);
+        pRenderer->pBackBuffers[i] = pNewBackBuffers[i];
+
+        pRenderer->BufferFences[i] = pRenderer->PresentFence;
+        DirtyRectsReset(&pRenderer->BufferDirtyRects[i]);
+    }
+
+    if (pPresentBuffer != NULL)
+    {
+        memset(pPresentBuffer, 0, sizeof(uint32_t) * numPixels);
+    }
+
+    SAFE_ALIGNED_FREE(pRenderer->pPresentBuffer);
+    pRenderer->pPresentBuffer = pPresentBuffer;
+
+    pRenderer->BackBufferFormat = format;
+    pRenderer->BytesPerPixel = bytesPerPixel;
+    pRenderer->BackBufferIndex = 0;
+    pRenderer->FrontBufferIndex = 0;
+
+    // 모든 버퍼가 같은 내용(0)이므로 다음 출력에서 전체를 한 번만 펼침
+    markAllDirty(pRenderer);
+
+    return true;
+}
+
+void __stdcall SetPalette(IRenderer* pThis, const uint32_t* pArgbs, const uint_t firstIndex, const uint_t numEntries)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pArgbs != NULL || numEntries == 0, "pArgbs is NULL");
+    ASSERT(firstIndex <= NUM_PALETTE_ENTRIES && numEntries <= NUM_PALETTE_ENTRIES - firstIndex, "Invalid palette range");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    waitForRenderThreadIdle(pRenderer);
+
+    // 출력 스레드가 팔레트를 읽고 있을 수 있음
+    waitForPresentIdle(pRenderer);
+
+    memcpy(pRenderer->Palette + firstIndex, pArgbs, sizeof(uint32_t) * numEntries);
+
+    // 백 버퍼 내용은 그대로이므로 뒤처진 영역을 먼저 복사한 후 전체를 다시 펼치도록 기록
+    if (pRenderer->BackBufferFormat == BACK_BUFFER_FORMAT_P8)
+    {
+        preserveBackBuffer(pRenderer);
+        markAllDirty(pRenderer);
+    }
+}
+
+bool __stdcall SetSurfaceLayout(IRenderer* pThis, const SURFACE_LAYOUT layout)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    const bool bTiled = (layout == SURFACE_LAYOUT_TILED);
+    if (bTiled == pRenderer->bTiledLayout)
+    {
+        return true;
+    }
+
+    // 타일 배치 커널은 A8R8G8B8만 다룸, 동적 해상도의 내부 서피스와 후처리는 선형 배치로 읽고 씀
+    if (isPackedFormat(pRenderer) || (bTiled && (pRenderer->pScaledSurface != NULL || pRenderer->bPostProcess)))
+    {
+        return false;
+    }
+
+    flushTileBinner(pRenderer);
+    waitForPresentIdle(pRenderer);
+
+    const uint_t bufferHeight = bTiled ? GetTiledHeight(pRenderer->Height) : pRenderer->Height;
+    const size_t numPixels = (size_t)pRenderer->Pitch * bufferHeight;
+
+    uint32_t* pNewBackBuffers[NUM_MAX_BACK_BUFFERS] = { NULL, };
+    uint32_t* pPresentBuffer = NULL;
+    bool bResult = true;
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers && bResult; ++i)
+    {
+        pNewBackBuffers[i] = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * numPixels, BACK_BUFFER_ALIGN);
+        bResult = (pNewBackBuffers[i] != NULL);
+    }
+
+    if (bResult && bTiled)
+    {
+        pPresentBuffer = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * pRenderer->Pitch * pRenderer->Height, BACK_BUFFER_ALIGN);
+        bResult = (pPresentBuffer != NULL);
+    }
+
+    if (!bResult)
+    {
+        for (uint_t i = 0; i < NUM_MAX_BACK_BUFFERS; ++i)
+        {
+            SAFE_ALIGNED_FREE(pNewBackBuffers[i]);
+        }
+
+        SAFE_ALIGNED_FREE(pPresentBuffer);
+        return false;
+    }
+
+    for (uint_t i = 0; i < pRenderer->NumBackBuffers; ++i)
+    {
+        memset(pNewBackBuffers[i], 0, sizeof(uint32_t) * numPixels);
+
+        SAFE_ALIGNED_FREE(pRenderer->pBackBuffers[i]);
+        pRenderer->pBackBuffers[i] = pNewBackBuffers[i];
+
+        pRenderer->BufferFences[i] = pRenderer->PresentFence;
+        DirtyRectsReset(&pRenderer->BufferDirtyRects[i]);
+    }
+
+    if (pPresentBuffer != NULL)
+    {
+        memset(pPresentBuffer, 0, sizeof(uint32_t) * pRenderer->Pitch * pRenderer->Height);
+    }
+
+    SAFE_ALIGNED_FREE(pRenderer->pPresentBuffer);
+    pRenderer->pPresentBuffer = pPresentBuffer;
+
+    pRenderer->bTiledLayout = bTiled;
+    pRenderer->BackBufferIndex = 0;
+    pRenderer->FrontBufferIndex = 0;
+
+    markAllDirty(pRenderer);
+
+    // 깊이 버퍼, 빠른 Clear, 타일 워커를 새 배치로 다시 만듦, 만들지 못한 기능은 꺼짐
+    bResult = true;
+    if (pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE)
+    {
+        const DEPTH_FORMAT depthFormat = pRenderer->DepthBuffer.Format;
+        DepthBufferRelease(&pRenderer->DepthBuffer);
+        bResult = DepthBufferInit(&pRenderer->DepthBuffer, depthFormat, pRenderer->Pitch, bufferHeight);
+    }
+
+    if (pRenderer->bFastClear)
+    {
+        FastClearRelease(&pRenderer->FastClear);
+        pRenderer->bFastClear = FastClearInit(&pRenderer->FastClear, pRenderer->Pitch, pRenderer->Height, getTiledHeight(pRenderer));
+        bResult = bResult && pRenderer->bFastClear;
+    }
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerResize(&pRenderer->TileBinner, pRenderer->Width, pRenderer->Height, pRenderer->Pitch, getTiledHeight(pRenderer)))
+        {
+            TileBinnerSetDepthBuffer(&pRenderer->TileBinner, getDepthBuffer(pRenderer));
+        }
+        else
+        {
+            TileBinnerRelease(&pRenderer->TileBinner);
+            pRenderer->bTileBinning = false;
+            bResult = false;
+        }
+    }
+
+    return bResult;
+}
+
+bool __stdcall SetDynamicResolution(IRenderer* pThis, const float minScale, const float maxScale, const float targetFrameTime,
+                                   const UPSCALE_FILTER filter)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(minScale > 0.0f && minScale <= maxScale && maxScale <= 1.0f, "Invalid scale range");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    // 내부 서피스에 그린 것은 이미 백 버퍼로 늘렸으므로 버림
+    releaseScaledSurface(pRenderer);
+
+    if (minScale == 1.0f && maxScale == 1.0f)
+    {
+        return true;
+    }
+
+    ASSERT(targetFrameTime > 0.0f, "targetFrameTime is 0");
+
+    // 백 버퍼로 늘리는 커널은 선형 A8R8G8B8만 다룸
+    if (isPackedFormat(pRenderer) || pRenderer->bTiledLayout)
+    {
+        return false;
+    }
+
+    DynamicResolutionInit(&pRenderer->DynamicResolution, minScale, maxScale, targetFrameTime);
+    pRenderer->UpscaleFilter = filter;
+
+    if (!createScaledSurface(pRenderer))
+    {
+        releaseScaledSurface(pRenderer);
+        return false;
+    }
+
+    HighPerformanceTimerInit(&pRenderer->FrameTimer);
+
+    return true;
+}
+
+uint_t __stdcall GetRenderWidth(const IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    return (pRenderer->pScaledSurface != NULL) ? pRenderer->RenderWidth : pRenderer->Width;
+}
+
+uint_t __stdcall GetRenderHeight(const IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    return (pRenderer->pScaledSurface != NULL) ? pRenderer->RenderHeight : pRenderer->Height;
+}
+
+bool __stdcall SetPostEffects(IRenderer* pThis, const POST_EFFECT* pEffects, const uint_t numEffects, const uint_t numThreads,
+                              const bool bFuse)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pEffects != NULL || numEffects == 0, "pEffects is NULL");
+    ASSERT(numEffects <= MAX_POST_EFFECTS, "Too many post effects");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    ASSERT(pRenderer->pBackBuffers[0] != NULL, "Renderer is not initialized");
+    waitForRenderThreadIdle(pRenderer);
+
+    // 출력 스레드가 효과를 적용하고 있을 수 있음
+    waitForPresentIdle(pRenderer);
+
+    if (pRenderer->bPostProcess)
+    {
+        PostProcessRelease(&pRenderer->PostProcess);
+        SAFE_ALIGNED_FREE(pRenderer->pPresentBuffer);
+        pRenderer->bPostProcess = false;
+    }
+
+    // 백 버퍼 내용은 그대로이므로 뒤처진 영역을 먼저 복사한 후 전체를 다시 출력하도록 기록
+    preserveBackBuffer(pRenderer);
+    markAllDirty(pRenderer);
+
+    if (numEffects == 0)
+    {
+        return true;
+    }
+
+    ASSERT(numThreads > 0, "numThreads is 0");
+
+    // 효과 커널은 선형 A8R8G8B8만 다룸
+    if (isPackedFormat(pRenderer) || pRenderer->bTiledLayout)
+    {
+        return false;
+    }
+
+    uint32_t* pPresentBuffer = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * pRenderer->Pitch * pRenderer->Height, BACK_BUFFER_ALIGN);
+    if (pPresentBuffer == NULL)
+    {
+        return false;
+    }
+
+    if (!PostProcessInit(&pRenderer->PostProcess, numThreads))
+    {
+        SAFE_ALIGNED_FREE(pPresentBuffer);
+        return false;
+    }
+
+    if (!PostProcessSetEffects(&pRenderer->PostProcess, pEffects, numEffects, bFuse))
+    {
+        PostProcessRelease(&pRenderer->PostProcess);
+        SAFE_ALIGNED_FREE(pPresentBuffer);
+        return false;
+    }
+
+    pRenderer->pPresentBuffer = pPresentBuffer;
+    pRenderer->bPostProcess = true;
+
+    // 다음 EndRender 전에도 GetFrontBuffer가 효과를 적용한 프레임을 반환
+    applyPostEffects(pRenderer, pRenderer->pBackBuffers[pRenderer->FrontBufferIndex]);
+
+    return true;
+}
+
+void __stdcall GetFramePacingStats(const IRenderer* pThis, FRAME_PACING_STATS* pOutStats)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+    ASSERT(pOutStats != NULL, "pOutStats is NULL");
+
+    const Renderer* pRenderer = (const Renderer*)pThis;
+    FramePacerGetStats(&pRenderer->FramePacer, pOutStats);
+}
+
+void __stdcall ResetFramePacingStats(IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    FramePacerResetStats(&pRenderer->FramePacer);
+}
+
+
+static DEPTH_BUFFER* getDepthBuffer(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    return (pRenderer->DepthBuffer.Format != DEPTH_FORMAT_NONE) ? &pRenderer->DepthBuffer : NULL;
+}
+
+static bool isPackedFormat(const Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    return pRenderer->BackBufferFormat != BACK_BUFFER_FORMAT_A8R8G8B8;
+}
+
+// 그리기 함수가 그릴 렌더러 (렌더 타겟, 동적 해상도의 내부 서피스, 백 버퍼 순)
+// 렌더 타겟과 내부 서피스의 렌더러는 둘 다 쓰지 않으므로 한 단계만 따라감
+static Renderer* getDrawTarget(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->pRenderTarget != NULL)
+    {
+        return (Renderer*)((RenderTarget*)pRenderer->pRenderTarget)->pRenderer;
+    }
+
+    return (pRenderer->pScaledSurface != NULL) ? pRenderer->pScaledSurface : pRenderer;
+}
+
+// 렌더 타겟과 동적 해상도의 내부 서피스로 쓰는 렌더러, InitHeadless가 바꾼 SIMD 단계는 되돌림, 실패하면 NULL
+static IRenderer* createHeadlessRenderer(const uint_t width, const uint_t height, const DEPTH_FORMAT depthFormat)
+{
+    const SIMD_LEVEL simdLevel = GetSelectedSimdLevel();
+
+    IRenderer* pRenderer;
+    CreateDllInstance((void**)&pRenderer);
+    const bool bResult = pRenderer->InitHeadless(pRenderer, width, height)
+        && (depthFormat == DEPTH_FORMAT_NONE || pRenderer->SetDepthFormat(pRenderer, depthFormat));
+
+    SelectSpanKernels(simdLevel);
+
+    if (!bResult)
+    {
+        pRenderer->Release(pRenderer);
+        return NULL;
+    }
+
+    return pRenderer;
+}
+
+static void getScaledSize(const Renderer* pRenderer, const float scale, uint_t* pOutWidth, uint_t* pOutHeight)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pOutWidth != NULL, "pOutWidth is NULL");
+    ASSERT(pOutHeight != NULL, "pOutHeight is NULL");
+
+    *pOutWidth = MAX((uint_t)ROUND_INT((float)pRenderer->Width * scale), 1);
+    *pOutHeight = MAX((uint_t)ROUND_INT((float)pRenderer->Height * scale), 1);
+}
+
+// 내부 서피스를 최대 배율 크기로 만들고 백 버퍼의 깊이 형식, 래스터 스레드 수, 샘플러를 따름
+static bool createScaledSurface(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pRenderer->pScaledSurface == NULL, "Scaled surface already exists");
+
+    if (!UpscalerInit(&pRenderer->Upscaler, pRenderer->Width))
+    {
+        return false;
+    }
+
+    uint_t maxWidth;
+    uint_t maxHeight;
+    getScaledSize(pRenderer, pRenderer->DynamicResolution.MaxScale, &maxWidth, &maxHeight);
+
+    Renderer* pSurface = (Renderer*)createHeadlessRenderer(maxWidth, maxHeight, pRenderer->DepthBuffer.Format);
+    if (pSurface == NULL)
+    {
+        return false;
+    }
+
+    pRenderer->pScaledSurface = pSurface;
+    pSurface->TextureFilter = pRenderer->TextureFilter;
+    pSurface->TextureAddress = pRenderer->TextureAddress;
+
+    if (pRenderer->bTileBinning && !SetNumRasterThreads(&pSurface->Vtbl, pRenderer->TileBinner.Pool.NumThreads))
+    {
+        return false;
+    }
+
+    getScaledSize(pRenderer, pRenderer->DynamicResolution.Scale, &pRenderer->RenderWidth, &pRenderer->RenderHeight);
+    resizeScaledSurface(pSurface, pRenderer->RenderWidth, pRenderer->RenderHeight);
+
+    return true;
+}
+
+static void releaseScaledSurface(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->pScaledSurface != NULL)
+    {
+        pRenderer->pScaledSurface->Vtbl.Release(&pRenderer->pScaledSurface->Vtbl);
+        pRenderer->pScaledSurface = NULL;
+    }
+
+    UpscalerRelease(&pRenderer->Upscaler);
+}
+
+// 백 버퍼는 최대 배율 크기로 만들어 두었으므로 크기만 바꾸고 깊이 버퍼와 타일 워커는 새 크기로 다시 만듦, 내용은 버림
+static void resizeScaledSurface(Renderer* pSurface, const uint_t width, const uint_t height)
+{
+    ASSERT(pSurface != NULL, "pSurface is NULL");
+
+    const uint_t padding = DEFAULT_ALIGN - width % DEFAULT_ALIGN;
+    const uint_t pitch = width + ((padding == DEFAULT_ALIGN) ? 0 : padding);
+
+    pSurface->Pitch = pitch;
+    pSurface->Width = width;
+    pSurface->Height = height;
+    DirtyRectsReset(&pSurface->DirtyRects);
+
+    if (pSurface->DepthBuffer.Format != DEPTH_FORMAT_NONE)
+    {
+        const DEPTH_FORMAT depthFormat = pSurface->DepthBuffer.Format;
+        DepthBufferRelease(&pSurface->DepthBuffer);
+        if (!DepthBufferInit(&pSurface->DepthBuffer, depthFormat, pitch, height))
+        {
+            ASSERT(false, "Failed to malloc");
+        }
+    }
+
+    if (pSurface->bTileBinning)
+    {
+        if (TileBinnerResize(&pSurface->TileBinner, width, height, pitch, 0))
+        {
+            TileBinnerSetDepthBuffer(&pSurface->TileBinner, getDepthBuffer(pSurface));
+        }
+        else
+        {
+            TileBinnerRelease(&pSurface->TileBinner);
+            pSurface->bTileBinning = false;
+        }
+    }
+}
+
+// 이번 프레임에 내부 서피스에 그린 것이 있으면 백 버퍼 전체로 늘림
+static void upscaleScaledSurface(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    Renderer* pSurface = pRenderer->pScaledSurface;
+    flushTileBinner(pSurface);
+
+    if (pSurface->DirtyRects.NumRects == 0)
+    {
+        return;
+    }
+
+    DirtyRectsReset(&pSurface->DirtyRects);
+
+    Upscale(&pRenderer->Upscaler, pRenderer->UpscaleFilter,
+            pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pRenderer->Width, pRenderer->Height,
+            pSurface->pBackBuffers[pSurface->BackBufferIndex], pSurface->Pitch, pSurface->Width, pSurface->Height);
+
+    markAllDirty(pRenderer);
+}
+
+// 이번 프레임 시간으로 다음 프레임 배율을 정하고 바뀌면 내부 서피스 크기를 바꿈
+static void updateDynamicResolution(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    HighPerformanceTimerUpdate(&pRenderer->FrameTimer, 0.0f);
+    if (!DynamicResolutionUpdate(&pRenderer->DynamicResolution, HighPerformanceTimerGetDeltaTime(&pRenderer->FrameTimer)))
+    {
+        return;
+    }
+
+    // 렌더 스레드 모드에서는 호출 스레드가 다음 EndRender에서 크기를 정함
+    if (pRenderer->bRenderThread)
+    {
+        return;
+    }
+
+    getScaledSize(pRenderer, pRenderer->DynamicResolution.Scale, &pRenderer->RenderWidth, &pRenderer->RenderHeight);
+    resizeScaledSurface(pRenderer->pScaledSurface, pRenderer->RenderWidth, pRenderer->RenderHeight);
+}
+
+static void applyRenderSize(Renderer* pRenderer, const uint_t width, const uint_t height)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    Renderer* pSurface = pRenderer->pScaledSurface;
+    if (pSurface->Width != width || pSurface->Height != height)
+    {
+        resizeScaledSurface(pSurface, width, height);
+    }
+}
+
+// 렌더 스레드가 쉬는 동안 호출, 기록을 마친 프레임은 기록하는 동안 알려준 크기로 그리고
+// 다음 프레임 크기는 렌더 스레드가 마지막으로 그린 프레임의 시간으로 정한 배율을 따름
+static void latchRenderSize(Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    if (pRenderer->pScaledSurface == NULL)
+    {
+        return;
+    }
+
+    pRenderer->FrameRenderWidth = pRenderer->RenderWidth;
+    pRenderer->FrameRenderHeight = pRenderer->RenderHeight;
+    getScaledSize(pRenderer, pRenderer->DynamicResolution.Scale, &pRenderer->RenderWidth, &pRenderer->RenderHeight);
+}
+
+// 백 버퍼와 깊이 버퍼의 행 수
+static uint_t getBufferHeight(const Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    return pRenderer->bTiledLayout ? GetTiledHeight(pRenderer->Height) : pRenderer->Height;
+}
+
+// 선형 배치면 0
+static uint_t getTiledHeight(const Renderer* pRenderer)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    return pRenderer->bTiledLayout ? GetTiledHeight(pRenderer->Height) : 0;
+}
+
+// 타일 배치 백 버퍼에서 pRect에 걸친 띠마다 띠를 선형 버퍼로 보고 그림
+static void drawTiled(Renderer* pRenderer, const DRAW_COMMAND* pCommand, const CLIP_RECT* pRect)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pCommand != NULL, "pCommand is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    CLIP_RECT rect;
+    if (!IntersectClipRect(pRect, &screenRect, &rect))
+    {
+        return;
+    }
+
+    uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+    const uint_t tiledHeight = getTiledHeight(pRenderer);
+    DEPTH_BUFFER* pDepthBuffer = getDepthBuffer(pRenderer);
+    for (uint_t strip = (uint_t)rect.MinX / SURFACE_TILE_SIZE; strip <= (uint_t)rect.MaxX / SURFACE_TILE_SIZE; ++strip)
+    {
+        CLIP_RECT scissor;
+        IntersectTiledStrip(&rect, strip, &scissor);
+        if (pCommand->Type == DRAW_COMMAND_TRIANGLE && IsTriangleOutsideRect(&pCommand->Triangle, &scissor))
+        {
+            continue;
+        }
+
+        // 시저를 띠로 좁혔으므로 커널은 띠 밖에 쓰지 않음
+        IntersectTiledStrip(&screenRect, strip, &scissor);
+
+        DEPTH_BUFFER stripDepthBuffer;
+        if (pDepthBuffer != NULL)
+        {
+            GetTiledStripDepthBuffer(pDepthBuffer, tiledHeight, strip, &stripDepthBuffer);
+        }
+
+        RasterizeDrawCommand(GetTiledStrip(pBackBuffer, tiledHeight, strip), SURFACE_TILE_SIZE, &scissor,
+                             (pDepthBuffer != NULL) ? &stripDepthBuffer : NULL, pCommand);
+    }
+}
+
+static void drawTriangleSetup(Renderer* pRenderer, const TRIANGLE_SETUP* pSetup)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+
+    const CLIP_RECT rect = { pSetup->MinX, pSetup->MinY, pSetup->MaxX, pSetup->MaxY };
+    markDirty(pRenderer, &rect);
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerAddTriangle(&pRenderer->TileBinner, pSetup))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
+    }
+
+    resolveFastClear(pRenderer, &rect);
+
+    if (pRenderer->bTiledLayout)
+    {
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_TRIANGLE;
+        command.Argb = 0;
+        command.Triangle = *pSetup;
+        drawTiled(pRenderer, &command, &rect);
+        return;
+    }
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+    RasterizeTriangle(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pSetup, &screenRect, getDepthBuffer(pRenderer));
+}
+
+// 화면 공간 볼록 다각형을 부채꼴로 나눠 그림
+// pTexture가 NULL이면 Attributes는 COLOR_CHANNEL 순서의 색상, 아니면 PERSPECTIVE_ATTRIBUTE 순서의 u/w, v/w, 1/w
+static void drawPolygon(Renderer* pRenderer, const TEXTURE* pTexture, const CLIP_POLYGON_VERTEX* pVertices, const uint_t numVertices)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pVertices != NULL, "pVertices is NULL");
+
+    COLOR_VERTEX colorVertices[MAX_CLIP_POLYGON_VERTICES];
+    TEXTURE_VERTEX textureVertices[MAX_CLIP_POLYGON_VERTICES];
+    for (uint_t i = 0; i < numVertices; ++i)
+    {
+        const CLIP_POLYGON_VERTEX* pVertex = &pVertices[i];
+        if (pTexture != NULL)
+        {
+            const float q = pVertex->Attributes[PERSPECTIVE_Q];
+            const float w = (q != 0.0f) ? 1.0f / q : 0.0f;
+            textureVertices[i].X = pVertex->X;
+            textureVertices[i].Y = pVertex->Y;
+            textureVertices[i].Z = pVertex->Z;
+            textureVertices[i].Rhw = q;
+            textureVertices[i].U = pVertex->Attributes[PERSPECTIVE_U] * w;
+            textureVertices[i].V = pVertex->Attributes[PERSPECTIVE_V] * w;
+            continue;
+        }
+
+        uint32_t argb = 0;
+        for (size_t j = 0; j < NUM_COLOR_CHANNELS; ++j)
+        {
+            const int channel = MIN(MAX(ROUND_INT(pVertex->Attributes[j]), 0), 255);
+            argb |= (uint32_t)channel << (24 - 8 * j);
+        }
+
+        colorVertices[i].X = pVertex->X;
+        colorVertices[i].Y = pVertex->Y;
+        colorVertices[i].Z = pVertex->Z;
+        colorVertices[i].Argb = argb;
+    }
+
+    TRIANGLE_SETUP setup;
+    for (uint_t i = 1; i + 1 < numVertices; ++i)
+    {
+        bool bVisible;
+        if (pTexture != NULL)
+        {
+            bVisible = SetupTexturedTriangle(&setup, 0, 0, pRenderer->Width - 1, pRenderer->Height - 1,
+                                             pTexture, pRenderer->TextureFilter, pRenderer->TextureAddress,
+                                             &textureVertices[0], &textureVertices[i], &textureVertices[i + 1]);
+        }
+        else
+        {
+            bVisible = SetupTriangle(&setup, 0, 0, pRenderer->Width - 1, pRenderer->Height - 1,
+                                     &colorVertices[0], &colorVertices[i], &colorVertices[i + 1]);
+        }
+
+        if (bVisible)
+        {
+            drawTriangleSetup(pRenderer, &setup);
+        }
+    }
+}
+
+// W가 1인 화면 공간 삼각형 중 가드 밴드를 넘는 것만 잘라서 그림, 범위 안이면 이미 다른 이유(면적 0, 화면 밖)로 버려진 것
+static void drawGuardBandClippedTriangle(Renderer* pRenderer, const TEXTURE* pTexture, CLIP_POLYGON_VERTEX vertices[MAX_CLIP_POLYGON_VERTICES])
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+
+    // 화면 공간은 원점 기준으로 대칭인 가드 밴드만 쓰고 화면 평면은 의미가 없음
+    const uint_t planes = (GetClipCode(&vertices[0], GUARD_BAND_COORD, GUARD_BAND_COORD)
+                           | GetClipCode(&vertices[1], GUARD_BAND_COORD, GUARD_BAND_COORD)
+                           | GetClipCode(&vertices[2], GUARD_BAND_COORD, GUARD_BAND_COORD)) & CLIP_PLANES_GUARD_BAND;
+    if (planes == 0)
+    {
+        return;
+    }
+
+    const uint_t numVertices = ClipPolygon(vertices, 3, planes, GUARD_BAND_COORD, GUARD_BAND_COORD);
+    drawPolygon(pRenderer, pTexture, vertices, numVertices);
+}
+
+static void drawBitmap(Renderer* pRenderer, const int x, const int y, const uint_t width, const uint_t height,
+                       const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    const CLIP_RECT bitmapRect =
+    {
+        x,
+        y,
+        (int)MIN((int64_t)x + width - 1, (int64_t)INT_MAX),
+        (int)MIN((int64_t)y + height - 1, (int64_t)INT_MAX)
+    };
+    markDirty(pRenderer, &bitmapRect);
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerAddBitmap(&pRenderer->TileBinner, x, y, width, height, pBitmap, bitmapPitch, blendMode))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
+    }
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+
+    // 백 버퍼와 같은 형식의 비트맵을 그대로 복사
+    if (isPackedFormat(pRenderer))
+    {
+        RasterizePackedBitmap(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, pRenderer->BytesPerPixel, &screenRect,
+                              x, y, width, height, pBitmap, bitmapPitch);
+        return;
+    }
+
+    if (pRenderer->bFastClear)
+    {
+        // 비트맵은 화면 밖(패딩 열)에 그리지 않으므로 화면 안으로 자른 영역만 덮어씀
+        CLIP_RECT rect;
+        if (IntersectClipRect(&bitmapRect, &screenRect, &rect))
+        {
+            uint32_t* pBackBuffer = pRenderer->pBackBuffers[pRenderer->BackBufferIndex];
+            if (blendMode == BLEND_MODE_OPAQUE)
+            {
+                FastClearDiscard(&pRenderer->FastClear, pBackBuffer, &rect);
+            }
+            else
+            {
+                FastClearResolve(&pRenderer->FastClear, pBackBuffer, &rect);
+            }
+        }
+    }
+
+    if (pRenderer->bTiledLayout)
+    {
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_BITMAP;
+        command.Argb = 0;
+        command.Bitmap.X = x;
+        command.Bitmap.Y = y;
+        command.Bitmap.Width = width;
+        command.Bitmap.Height = height;
+        command.Bitmap.pBitmap = pBitmap;
+        command.Bitmap.BitmapPitch = bitmapPitch;
+        command.Bitmap.BlendMode = blendMode;
+        drawTiled(pRenderer, &command, &bitmapRect);
+        return;
+    }
+
+    RasterizeBitmap(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, &screenRect,
+                    x, y, width, height, pBitmap, bitmapPitch, blendMode);
+}
+
+static void drawTransformedBitmap(Renderer* pRenderer, const TRANSFORMED_BITMAP_SETUP* pSetup)
+{
+    ASSERT(pRenderer != NULL, "pRenderer is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+
+    const CLIP_RECT rect = { pSetup->MinX, pSetup->MinY, pSetup->MaxX, pSetup->MaxY };
+    markDirty(pRenderer, &rect);
+
+    if (pRenderer->bTileBinning)
+    {
+        if (TileBinnerAddTransformedBitmap(&pRenderer->TileBinner, pSetup))
+        {
+            return;
+        }
+
+        flushTileBinner(pRenderer);
+    }
+
+    // 불투명해도 바운딩 박스를 다 덮지 않으므로 버리지 않고 풀어냄
+    resolveFastClear(pRenderer, &rect);
+
+    if (pRenderer->bTiledLayout)
+    {
+        DRAW_COMMAND command;
+        command.Type = DRAW_COMMAND_TRANSFORMED_BITMAP;
+        command.Argb = 0;
+        command.TransformedBitmap = *pSetup;
+        drawTiled(pRenderer, &command, &rect);
+        return;
+    }
+
+    CLIP_RECT screenRect;
+    getScreenRect(pRenderer, &screenRect);
+    RasterizeTransformedBitmap(pRenderer->pBackBuffers[pRenderer->BackBufferIndex], pRenderer->Pitch, &screenRect, pSetup);
+}
+
+static ICommandList* getRecordingCommandList(IRenderer* pThis)
+{
+    ASSERT(pThis != NULL, "pThis is NULL");
+
+    Renderer* pRenderer = (Renderer*)pThis;
+    return RenderThreadGetCommandList(&pRenderer->RenderThread);
+}
+
+static void __stdcall recordClear(IRenderer* pThis, const uint32_t argb)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->Clear(pCommandList, argb);
+}
+
+static void __stdcall recordClearDepth(IRenderer* pThis, const float depth)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->ClearDepth(pCommandList, depth);
+}
+
+static void __stdcall recordHorizontalLine(IRenderer* pThis, const int x, const int y, const uint_t width, const uint32_t argb)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawHorizontalLine(pCommandList, x, y, width, argb);
+}
+
+static void __stdcall recordVerticalLine(IRenderer* pThis, const int x, const int y, const uint_t height, const uint32_t argb)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawVerticalLine(pCommandList, x, y, height, argb);
+}
+
+static void __stdcall recordLine(IRenderer* pThis, const int x0, const int y0, const int x1, const int y1, const uint_t argb)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawLine(pCommandList, x0, y0, x1, y1, argb);
+}
+
+static void __stdcall recordLines(IRenderer* pThis, const int* pX0s, const int* pY0s, const int* pX1s, const int* pY1s,
+                                  const uint_t numLines, const uint32_t argb)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawLines(pCommandList, pX0s, pY0s, pX1s, pY1s, numLines, argb);
+}
+
+static void __stdcall recordBitmap(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap)
+{
+    recordBitmapBlended(pThis, x, y, width, height, pBitmap, BLEND_MODE_OPAQUE);
+}
+
+static void __stdcall recordBitmapBlended(IRenderer* pThis, const int x, const int y, const uint_t width, const uint_t height, const void* pBitmap,
+                                          const BLEND_MODE blendMode)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawBitmapBlended(pCommandList, x, y, width, height, pBitmap, blendMode);
+}
+
+static void __stdcall recordBitmapTransformed(IRenderer* pThis, const uint_t width, const uint_t height, const void* pBitmap,
+                                              const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawBitmapTransformed(pCommandList, width, height, pBitmap, pTransform, filter, blendMode);
+}
+
+static void __stdcall recordSprites(IRenderer* pThis, const SPRITE* pSprites, const uint_t numSprites, const bool bSortByTexture)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawSprites(pCommandList, pSprites, numSprites, bSortByTexture);
+}
+
+static void __stdcall recordTriangle(IRenderer* pThis, const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2)
+{
+    ASSERT(pV0 != NULL && pV1 != NULL && pV2 != NULL, "vertex is NULL");
+
+    const COLOR_VERTEX vertices[3] = { *pV0, *pV1, *pV2 };
+
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawTriangles(pCommandList, vertices, NULL, 1);
+}
+
+static void __stdcall recordTriangles(IRenderer* pThis, const COLOR_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawTriangles(pCommandList, pVertices, pIndices, numTriangles);
+}
+
+static void __stdcall recordTexturedTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                              const TEXTURE_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawTexturedTriangles(pCommandList, pTexture, pVertices, pIndices, numTriangles);
+}
+
+static void __stdcall recordClipSpaceTriangles(IRenderer* pThis, const TEXTURE* pTexture,
+                                               const CLIP_VERTEX* pVertices, const uint16_t* pIndices, const uint_t numTriangles)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->DrawClipSpaceTriangles(pCommandList, pTexture, pVertices, pIndices, numTriangles);
+}
+
+static void __stdcall recordCommandList(IRenderer* pThis, const ICommandList* pCommandList)
+{
+    ASSERT(pCommandList != NULL, "pCommandList is NULL");
+
+    AppendCommandList(getRecordingCommandList(pThis), pCommandList);
+}
+
+static void __stdcall recordRenderTarget(IRenderer* pThis, IRenderTarget* pTarget)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->SetRenderTarget(pCommandList, pTarget);
+}
+
+static void __stdcall recordTextureSampler(IRenderer* pThis, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address)
+{
+    ICommandList* pCommandList = getRecordingCommandList(pThis);
+    pCommandList->SetTextureSampler(pCommandList, filter, address);
+}
+
 void __stdcall CreateDllInstance(void** ppOutInstance)
 {
     ASSERT(ppOutInstance != NULL, "ppOutInstance is NULL");
@@ -531,6 +3352,7 @@ void __stdcall CreateDllInstance(void** ppOutInstance)
     Renderer* pRenderer = (Renderer*)malloc(sizeof(Renderer));
     ASSERT(pRenderer != NULL, "Failed to malloc");
 
+    memset(pRenderer, 0, sizeof(Renderer));
     pRenderer->Vtbl = s_vtbl;
     pRenderer->RefCount = 1;
 
@@ -0,0 +1,66 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 명령어 집합별 채우기/복사/블렌드 커널
+// 각 변형은 별도 파일에 있고 Raster.c가 Init에서 CPU에 맞는 테이블을 고름
+
+#ifndef SAFE99_SPAN_KERNELS_H
+#define SAFE99_SPAN_KERNELS_H
+
+typedef void(__stdcall* FillSpanFunc)(uint32_t* pDest, const size_t count, const uint32_t argb);
+typedef void(__stdcall* CopySpanFunc)(uint32_t* pDest, const uint32_t* pSrc, const size_t count);
+typedef void(__stdcall* BlendSpanFunc)(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode);
+
+typedef struct SPAN_KERNELS
+{
+    FillSpanFunc    pfnFillSpan;
+    FillSpanFunc    pfnStreamFillSpan;
+    CopySpanFunc    pfnCopySpan;
+    BlendSpanFunc   pfnBlendSpan;
+} SPAN_KERNELS;
+
+void    __stdcall   GetSpanKernelsSSE(SPAN_KERNELS* pOutKernels);
+void    __stdcall   GetSpanKernelsAVX2(SPAN_KERNELS* pOutKernels);
+void    __stdcall   GetSpanKernelsAVX512(SPAN_KERNELS* pOutKernels);
+
+// x는 [0, 255 * 255], x / 255를 반올림
+static inline uint32_t DivideBy255(const uint32_t x)
+{
+    return ((x + 128) * 257) >> 16;
+}
+
+// 머리/꼬리 픽셀용, SIMD 커널과 같은 결과
+static inline uint32_t BlendPixel(const uint32_t dest, const uint32_t src, const BLEND_MODE blendMode)
+{
+    const uint32_t inverseAlpha = 255 - (src >> 24);
+
+    uint32_t result = 0;
+    for (uint_t shift = 0; shift < 32; shift += 8)
+    {
+        const uint32_t d = (dest >> shift) & 0xff;
+        const uint32_t s = (src >> shift) & 0xff;
+
+        uint32_t value;
+        switch (blendMode)
+        {
+        case BLEND_MODE_ALPHA:
+            value = s + DivideBy255(d * inverseAlpha);
+            break;
+        case BLEND_MODE_ADDITIVE:
+            value = s + d;
+            break;
+        case BLEND_MODE_MULTIPLY:
+            value = DivideBy255(d * MIN(s + inverseAlpha, 255));
+            break;
+        default:
+            value = s;
+            break;
+        }
+
+        result |= MIN(value, 255) << shift;
+    }
+
+    return result;
+}
+
+#endif // SAFE99_SPAN_KERNELS_H
\ No newline at end of file
@@ -0,0 +1,194 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// AVX2 커널, 다른 파일에 AVX2 코드가 섞이지 않도록 include 뒤에서만 대상 명령어 집합을 바꿈
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "SpanKernels.h"
+
+// MSVC는 /arch 옵션 없이도 내장 함수를 쓸 수 있음
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC target("avx2")
+#endif // __clang__
+
+static void __stdcall fillSpanAVX2(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    // 32바이트 경계까지는 하나씩
+    while (pDest < pEnd && ((uintptr_t)pDest & 31) != 0)
+    {
+        *pDest++ = argb;
+    }
+
+    const __m256i color = _mm256_set1_epi32((int)argb);
+    __m256i* pDestAVX = (__m256i*)pDest;
+    __m256i* pEndAVX = (__m256i*)((uintptr_t)pEnd & ~(uintptr_t)31);
+    while (pDestAVX < pEndAVX)
+    {
+        _mm256_store_si256(pDestAVX++, color);
+    }
+
+    pDest = (uint32_t*)pDestAVX;
+    while (pDest < pEnd)
+    {
+        *pDest++ = argb;
+    }
+}
+
+static void __stdcall streamFillSpanAVX2(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 31) != 0)
+    {
+        *pDest++ = argb;
+    }
+
+    const __m256i color = _mm256_set1_epi32((int)argb);
+    __m256i* pDestAVX = (__m256i*)pDest;
+    __m256i* pEndAVX = (__m256i*)((uintptr_t)pEnd & ~(uintptr_t)31);
+    while (pDestAVX < pEndAVX)
+    {
+        _mm256_stream_si256(pDestAVX++, color);
+    }
+
+    pDest = (uint32_t*)pDestAVX;
+    while (pDest < pEnd)
+    {
+        *pDest++ = argb;
+    }
+
+    _mm_sfence();
+}
+
+static void __stdcall copySpanAVX2(uint32_t* pDest, const uint32_t* pSrc, const size_t count)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 31) != 0)
+    {
+        *pDest++ = *pSrc++;
+    }
+
+    __m256i* pDestAVX = (__m256i*)pDest;
+    __m256i* pEndAVX = (__m256i*)((uintptr_t)pEnd & ~(uintptr_t)31);
+    const __m256i* pSrcAVX = (const __m256i*)pSrc;
+    while (pDestAVX < pEndAVX)
+    {
+        _mm256_store_si256(pDestAVX++, _mm256_loadu_si256(pSrcAVX++));
+    }
+
+    pDest = (uint32_t*)pDestAVX;
+    pSrc = (const uint32_t*)pSrcAVX;
+    while (pDest < pEnd)
+    {
+        *pDest++ = *pSrc++;
+    }
+}
+
+static __m256i __vectorcall multiplyChannelsAVX2(const __m256i dest, const __m256i factor)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    const __m256i scale = _mm256_set1_epi16(257);
+
+    const __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(dest, zero), _mm256_unpacklo_epi8(factor, zero));
+    const __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(dest, zero), _mm256_unpackhi_epi8(factor, zero));
+    return _mm256_packus_epi16(_mm256_mulhi_epu16(_mm256_add_epi16(lo, round), scale),
+                               _mm256_mulhi_epu16(_mm256_add_epi16(hi, round), scale));
+}
+
+static __m256i __vectorcall blendPixelsAVX2(const __m256i dest, const __m256i src, const BLEND_MODE blendMode)
+{
+    if (blendMode == BLEND_MODE_ADDITIVE)
+    {
+        return _mm256_adds_epu8(src, dest);
+    }
+
+    const __m256i alphaShuffle = _mm256_set_epi8(15, 15, 15, 15, 11, 11, 11, 11, 7, 7, 7, 7, 3, 3, 3, 3,
+                                                 15, 15, 15, 15, 11, 11, 11, 11, 7, 7, 7, 7, 3, 3, 3, 3);
+    const __m256i inverseAlpha = _mm256_xor_si256(_mm256_shuffle_epi8(src, alphaShuffle), _mm256_set1_epi32(-1));
+    if (blendMode == BLEND_MODE_ALPHA)
+    {
+        return _mm256_adds_epu8(src, multiplyChannelsAVX2(dest, inverseAlpha));
+    }
+
+    return multiplyChannelsAVX2(dest, _mm256_adds_epu8(src, inverseAlpha));
+}
+
+static void __stdcall blendSpanAVX2(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    if (blendMode == BLEND_MODE_OPAQUE)
+    {
+        copySpanAVX2(pDest, pSrc, count);
+        return;
+    }
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 31) != 0)
+    {
+        *pDest = BlendPixel(*pDest, *pSrc++, blendMode);
+        ++pDest;
+    }
+
+    const __m256i alphaMask = _mm256_set1_epi32((int)0xff000000);
+    __m256i* pDestAVX = (__m256i*)pDest;
+    __m256i* pEndAVX = (__m256i*)((uintptr_t)pEnd & ~(uintptr_t)31);
+    const __m256i* pSrcAVX = (const __m256i*)pSrc;
+    while (pDestAVX < pEndAVX)
+    {
+        const __m256i src = _mm256_loadu_si256(pSrcAVX++);
+        if (!_mm256_testz_si256(src, src))
+        {
+            if (blendMode == BLEND_MODE_ALPHA && _mm256_testc_si256(src, alphaMask))
+            {
+                _mm256_store_si256(pDestAVX, src);
+            }
+            else
+            {
+                _mm256_store_si256(pDestAVX, blendPixelsAVX2(_mm256_load_si256(pDestAVX), src, blendMode));
+            }
+        }
+
+        ++pDestAVX;
+    }
+
+    pDest = (uint32_t*)pDestAVX;
+    pSrc = (const uint32_t*)pSrcAVX;
+    while (pDest < pEnd)
+    {
+        *pDest = BlendPixel(*pDest, *pSrc++, blendMode);
+        ++pDest;
+    }
+}
+
+void __stdcall GetSpanKernelsAVX2(SPAN_KERNELS* pOutKernels)
+{
+    ASSERT(pOutKernels != NULL, "pOutKernels is NULL");
+
+    pOutKernels->pfnFillSpan = fillSpanAVX2;
+    pOutKernels->pfnStreamFillSpan = streamFillSpanAVX2;
+    pOutKernels->pfnCopySpan = copySpanAVX2;
+    pOutKernels->pfnBlendSpan = blendSpanAVX2;
+}
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#endif // __clang__
\ No newline at end of file
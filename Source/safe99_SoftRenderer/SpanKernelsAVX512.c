@@ -0,0 +1,192 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// AVX-512(F + BW) 커널, 머리/꼬리도 마스크 저장으로 처리
+// 다른 파일에 AVX-512 코드가 섞이지 않도록 include 뒤에서만 대상 명령어 집합을 바꿈
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "SpanKernels.h"
+
+// MSVC는 /arch 옵션 없이도 내장 함수를 쓸 수 있음
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx512f,avx512bw"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC target("avx512f,avx512bw")
+#endif // __clang__
+
+// 64바이트 경계까지 남은 픽셀 수
+static size_t getNumHeadPixels(const uint32_t* pDest, const size_t count)
+{
+    return MIN((size_t)((64 - ((uintptr_t)pDest & 63)) & 63) / 4, count);
+}
+
+static __mmask16 getPixelMask(const size_t count)
+{
+    return (__mmask16)((1u << count) - 1);
+}
+
+static void __stdcall fillSpanAVX512(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    const __m512i color = _mm512_set1_epi32((int)argb);
+
+    const size_t numHead = getNumHeadPixels(pDest, count);
+    _mm512_mask_storeu_epi32(pDest, getPixelMask(numHead), color);
+
+    uint32_t* pCur = pDest + numHead;
+    size_t remaining = count - numHead;
+    for (; remaining >= 16; remaining -= 16)
+    {
+        _mm512_store_si512(pCur, color);
+        pCur += 16;
+    }
+
+    _mm512_mask_storeu_epi32(pCur, getPixelMask(remaining), color);
+}
+
+static void __stdcall streamFillSpanAVX512(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    const __m512i color = _mm512_set1_epi32((int)argb);
+
+    const size_t numHead = getNumHeadPixels(pDest, count);
+    _mm512_mask_storeu_epi32(pDest, getPixelMask(numHead), color);
+
+    uint32_t* pCur = pDest + numHead;
+    size_t remaining = count - numHead;
+    for (; remaining >= 16; remaining -= 16)
+    {
+        _mm512_stream_si512((__m512i*)pCur, color);
+        pCur += 16;
+    }
+
+    _mm512_mask_storeu_epi32(pCur, getPixelMask(remaining), color);
+    _mm_sfence();
+}
+
+static void __stdcall copySpanAVX512(uint32_t* pDest, const uint32_t* pSrc, const size_t count)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    const size_t numHead = getNumHeadPixels(pDest, count);
+    const __mmask16 headMask = getPixelMask(numHead);
+    _mm512_mask_storeu_epi32(pDest, headMask, _mm512_maskz_loadu_epi32(headMask, pSrc));
+
+    uint32_t* pCur = pDest + numHead;
+    const uint32_t* pSrcCur = pSrc + numHead;
+    size_t remaining = count - numHead;
+    for (; remaining >= 16; remaining -= 16)
+    {
+        _mm512_store_si512(pCur, _mm512_loadu_si512(pSrcCur));
+        pCur += 16;
+        pSrcCur += 16;
+    }
+
+    const __mmask16 tailMask = getPixelMask(remaining);
+    _mm512_mask_storeu_epi32(pCur, tailMask, _mm512_maskz_loadu_epi32(tailMask, pSrcCur));
+}
+
+static __m512i __vectorcall multiplyChannelsAVX512(const __m512i dest, const __m512i factor)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i round = _mm512_set1_epi16(128);
+    const __m512i scale = _mm512_set1_epi16(257);
+
+    const __m512i lo = _mm512_mullo_epi16(_mm512_unpacklo_epi8(dest, zero), _mm512_unpacklo_epi8(factor, zero));
+    const __m512i hi = _mm512_mullo_epi16(_mm512_unpackhi_epi8(dest, zero), _mm512_unpackhi_epi8(factor, zero));
+    return _mm512_packus_epi16(_mm512_mulhi_epu16(_mm512_add_epi16(lo, round), scale),
+                               _mm512_mulhi_epu16(_mm512_add_epi16(hi, round), scale));
+}
+
+static __m512i __vectorcall blendPixelsAVX512(const __m512i dest, const __m512i src, const BLEND_MODE blendMode)
+{
+    if (blendMode == BLEND_MODE_ADDITIVE)
+    {
+        return _mm512_adds_epu8(src, dest);
+    }
+
+    // 각 픽셀의 알파 바이트를 4채널로 복제
+    const __m512i alphaShuffle = _mm512_set4_epi32(0x0f0f0f0f, 0x0b0b0b0b, 0x07070707, 0x03030303);
+    const __m512i inverseAlpha = _mm512_xor_si512(_mm512_shuffle_epi8(src, alphaShuffle), _mm512_set1_epi32(-1));
+    if (blendMode == BLEND_MODE_ALPHA)
+    {
+        return _mm512_adds_epu8(src, multiplyChannelsAVX512(dest, inverseAlpha));
+    }
+
+    return multiplyChannelsAVX512(dest, _mm512_adds_epu8(src, inverseAlpha));
+}
+
+// mask 밖의 픽셀은 건드리지 않음
+static void blendPixelsMaskedAVX512(uint32_t* pDest, const uint32_t* pSrc, const __mmask16 mask, const BLEND_MODE blendMode)
+{
+    const __m512i src = _mm512_maskz_loadu_epi32(mask, pSrc);
+    _mm512_mask_storeu_epi32(pDest, mask, blendPixelsAVX512(_mm512_maskz_loadu_epi32(mask, pDest), src, blendMode));
+}
+
+static void __stdcall blendSpanAVX512(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    if (blendMode == BLEND_MODE_OPAQUE)
+    {
+        copySpanAVX512(pDest, pSrc, count);
+        return;
+    }
+
+    const size_t numHead = getNumHeadPixels(pDest, count);
+    if (numHead > 0)
+    {
+        blendPixelsMaskedAVX512(pDest, pSrc, getPixelMask(numHead), blendMode);
+    }
+
+    uint32_t* pCur = pDest + numHead;
+    const uint32_t* pSrcCur = pSrc + numHead;
+    size_t remaining = count - numHead;
+
+    const __m512i alphaMask = _mm512_set1_epi32((int)0xff000000);
+    for (; remaining >= 16; remaining -= 16)
+    {
+        const __m512i src = _mm512_loadu_si512(pSrcCur);
+        if (_mm512_test_epi32_mask(src, src) != 0)
+        {
+            if (blendMode == BLEND_MODE_ALPHA
+                && _mm512_cmpeq_epi32_mask(_mm512_and_si512(src, alphaMask), alphaMask) == 0xffff)
+            {
+                _mm512_store_si512(pCur, src);
+            }
+            else
+            {
+                _mm512_store_si512(pCur, blendPixelsAVX512(_mm512_load_si512(pCur), src, blendMode));
+            }
+        }
+
+        pCur += 16;
+        pSrcCur += 16;
+    }
+
+    if (remaining > 0)
+    {
+        blendPixelsMaskedAVX512(pCur, pSrcCur, getPixelMask(remaining), blendMode);
+    }
+}
+
+void __stdcall GetSpanKernelsAVX512(SPAN_KERNELS* pOutKernels)
+{
+    ASSERT(pOutKernels != NULL, "pOutKernels is NULL");
+
+    pOutKernels->pfnFillSpan = fillSpanAVX512;
+    pOutKernels->pfnStreamFillSpan = streamFillSpanAVX512;
+    pOutKernels->pfnCopySpan = copySpanAVX512;
+    pOutKernels->pfnBlendSpan = blendSpanAVX512;
+}
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#endif // __clang__
\ No newline at end of file
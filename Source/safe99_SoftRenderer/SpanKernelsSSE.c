@@ -0,0 +1,183 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// SSE4.1 커널, 렌더러의 최소 요구 사항
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "SpanKernels.h"
+
+static void __stdcall fillSpanSSE(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    // 16바이트 경계까지는 하나씩
+    while (pDest < pEnd && ((uintptr_t)pDest & 15) != 0)
+    {
+        *pDest++ = argb;
+    }
+
+    const __m128i color = _mm_set1_epi32((int)argb);
+    __m128i* pDestSSE = (__m128i*)pDest;
+    __m128i* pEndSSE = (__m128i*)((uintptr_t)pEnd & ~(uintptr_t)15);
+    while (pDestSSE < pEndSSE)
+    {
+        _mm_store_si128(pDestSSE++, color);
+    }
+
+    pDest = (uint32_t*)pDestSSE;
+    while (pDest < pEnd)
+    {
+        *pDest++ = argb;
+    }
+}
+
+// 캐시를 거치지 않고 씀, 다시 읽지 않을 큰 영역용
+static void __stdcall streamFillSpanSSE(uint32_t* pDest, const size_t count, const uint32_t argb)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 15) != 0)
+    {
+        *pDest++ = argb;
+    }
+
+    const __m128i color = _mm_set1_epi32((int)argb);
+    __m128i* pDestSSE = (__m128i*)pDest;
+    __m128i* pEndSSE = (__m128i*)((uintptr_t)pEnd & ~(uintptr_t)15);
+    while (pDestSSE < pEndSSE)
+    {
+        _mm_stream_si128(pDestSSE++, color);
+    }
+
+    pDest = (uint32_t*)pDestSSE;
+    while (pDest < pEnd)
+    {
+        *pDest++ = argb;
+    }
+
+    _mm_sfence();
+}
+
+static void __stdcall copySpanSSE(uint32_t* pDest, const uint32_t* pSrc, const size_t count)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 15) != 0)
+    {
+        *pDest++ = *pSrc++;
+    }
+
+    __m128i* pDestSSE = (__m128i*)pDest;
+    __m128i* pEndSSE = (__m128i*)((uintptr_t)pEnd & ~(uintptr_t)15);
+    const __m128i* pSrcSSE = (const __m128i*)pSrc;
+    while (pDestSSE < pEndSSE)
+    {
+        _mm_store_si128(pDestSSE++, _mm_loadu_si128(pSrcSSE++));
+    }
+
+    pDest = (uint32_t*)pDestSSE;
+    pSrc = (const uint32_t*)pSrcSSE;
+    while (pDest < pEnd)
+    {
+        *pDest++ = *pSrc++;
+    }
+}
+
+static __m128i __vectorcall multiplyChannelsSSE(const __m128i dest, const __m128i factor)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i scale = _mm_set1_epi16(257);
+
+    const __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(dest, zero), _mm_unpacklo_epi8(factor, zero));
+    const __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(dest, zero), _mm_unpackhi_epi8(factor, zero));
+    return _mm_packus_epi16(_mm_mulhi_epu16(_mm_add_epi16(lo, round), scale),
+                            _mm_mulhi_epu16(_mm_add_epi16(hi, round), scale));
+}
+
+static __m128i __vectorcall blendPixelsSSE(const __m128i dest, const __m128i src, const BLEND_MODE blendMode)
+{
+    if (blendMode == BLEND_MODE_ADDITIVE)
+    {
+        return _mm_adds_epu8(src, dest);
+    }
+
+    const __m128i alphaShuffle = _mm_set_epi8(15, 15, 15, 15, 11, 11, 11, 11, 7, 7, 7, 7, 3, 3, 3, 3);
+    const __m128i inverseAlpha = _mm_xor_si128(_mm_shuffle_epi8(src, alphaShuffle), _mm_set1_epi32(-1));
+    if (blendMode == BLEND_MODE_ALPHA)
+    {
+        return _mm_adds_epu8(src, multiplyChannelsSSE(dest, inverseAlpha));
+    }
+
+    return multiplyChannelsSSE(dest, _mm_adds_epu8(src, inverseAlpha));
+}
+
+static void __stdcall blendSpanSSE(uint32_t* pDest, const uint32_t* pSrc, const size_t count, const BLEND_MODE blendMode)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+
+    if (blendMode == BLEND_MODE_OPAQUE)
+    {
+        copySpanSSE(pDest, pSrc, count);
+        return;
+    }
+
+    uint32_t* pEnd = pDest + count;
+
+    while (pDest < pEnd && ((uintptr_t)pDest & 15) != 0)
+    {
+        *pDest = BlendPixel(*pDest, *pSrc++, blendMode);
+        ++pDest;
+    }
+
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    __m128i* pDestSSE = (__m128i*)pDest;
+    __m128i* pEndSSE = (__m128i*)((uintptr_t)pEnd & ~(uintptr_t)15);
+    const __m128i* pSrcSSE = (const __m128i*)pSrc;
+    while (pDestSSE < pEndSSE)
+    {
+        const __m128i src = _mm_loadu_si128(pSrcSSE++);
+        if (!_mm_testz_si128(src, src))
+        {
+            if (blendMode == BLEND_MODE_ALPHA && _mm_testc_si128(src, alphaMask))
+            {
+                _mm_store_si128(pDestSSE, src);
+            }
+            else
+            {
+                _mm_store_si128(pDestSSE, blendPixelsSSE(_mm_load_si128(pDestSSE), src, blendMode));
+            }
+        }
+
+        ++pDestSSE;
+    }
+
+    pDest = (uint32_t*)pDestSSE;
+    pSrc = (const uint32_t*)pSrcSSE;
+    while (pDest < pEnd)
+    {
+        *pDest = BlendPixel(*pDest, *pSrc++, blendMode);
+        ++pDest;
+    }
+}
+
+void __stdcall GetSpanKernelsSSE(SPAN_KERNELS* pOutKernels)
+{
+    ASSERT(pOutKernels != NULL, "pOutKernels is NULL");
+
+    pOutKernels->pfnFillSpan = fillSpanSSE;
+    pOutKernels->pfnStreamFillSpan = streamFillSpanSSE;
+    pOutKernels->pfnCopySpan = copySpanSSE;
+    pOutKernels->pfnBlendSpan = blendSpanSSE;
+}
\ No newline at end of file
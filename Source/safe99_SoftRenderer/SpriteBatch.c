@@ -0,0 +1,137 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "SpriteBatch.h"
+
+#define DEFAULT_SPRITE_CAPACITY 256
+
+static int compareSpriteDraws(const void* pA, const void* pB)
+{
+    const SPRITE_DRAW* pDrawA = (const SPRITE_DRAW*)pA;
+    const SPRITE_DRAW* pDrawB = (const SPRITE_DRAW*)pB;
+
+    const uintptr_t textureA = (uintptr_t)pDrawA->pTexture;
+    const uintptr_t textureB = (uintptr_t)pDrawB->pTexture;
+    if (textureA != textureB)
+    {
+        return (textureA < textureB) ? -1 : 1;
+    }
+
+    return (pDrawA->Order < pDrawB->Order) ? -1 : (pDrawA->Order > pDrawB->Order);
+}
+
+static bool isSortedByTexture(const SPRITE_DRAW* pDraws, const uint_t numDraws)
+{
+    for (uint_t i = 1; i < numDraws; ++i)
+    {
+        if ((uintptr_t)pDraws[i - 1].pTexture > (uintptr_t)pDraws[i].pTexture)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void __stdcall SpriteBatchRelease(SPRITE_BATCH* pBatch)
+{
+    ASSERT(pBatch != NULL, "pBatch is NULL");
+
+    SAFE_FREE(pBatch->pDraws);
+    pBatch->NumDraws = 0;
+    pBatch->Capacity = 0;
+}
+
+bool __stdcall SpriteBatchBuild(SPRITE_BATCH* pBatch, const SPRITE* pSprites, const uint_t numSprites,
+                                const CLIP_RECT* pScreenRect, const bool bSortByTexture)
+{
+    ASSERT(pBatch != NULL, "pBatch is NULL");
+    ASSERT(pSprites != NULL || numSprites == 0, "pSprites is NULL");
+    ASSERT(pScreenRect != NULL, "pScreenRect is NULL");
+
+    pBatch->NumDraws = 0;
+    if (numSprites > pBatch->Capacity)
+    {
+        uint_t newCapacity = MAX(pBatch->Capacity, DEFAULT_SPRITE_CAPACITY);
+        while (newCapacity < numSprites)
+        {
+            newCapacity *= 2;
+        }
+
+        SPRITE_DRAW* pNewDraws = (SPRITE_DRAW*)realloc(pBatch->pDraws, sizeof(SPRITE_DRAW) * newCapacity);
+        if (pNewDraws == NULL)
+        {
+            return false;
+        }
+
+        pBatch->pDraws = pNewDraws;
+        pBatch->Capacity = newCapacity;
+    }
+
+    for (uint_t i = 0; i < numSprites; ++i)
+    {
+        SPRITE_DRAW* pDraw = &pBatch->pDraws[pBatch->NumDraws];
+        if (ClipSprite(&pSprites[i], pScreenRect, pDraw))
+        {
+            pDraw->Order = i;
+            ++pBatch->NumDraws;
+        }
+    }
+
+    // UI처럼 아틀라스 하나만 쓰는 경우가 많으므로 이미 정렬되어 있으면 건너뜀
+    if (bSortByTexture && !isSortedByTexture(pBatch->pDraws, pBatch->NumDraws))
+    {
+        qsort(pBatch->pDraws, pBatch->NumDraws, sizeof(SPRITE_DRAW), compareSpriteDraws);
+    }
+
+    return true;
+}
+
+bool __stdcall ClipSprite(const SPRITE* pSprite, const CLIP_RECT* pScreenRect, SPRITE_DRAW* pOutDraw)
+{
+    ASSERT(pSprite != NULL, "pSprite is NULL");
+    ASSERT(pSprite->pTexture != NULL, "pTexture is NULL");
+    ASSERT(pScreenRect != NULL, "pScreenRect is NULL");
+    ASSERT(pOutDraw != NULL, "pOutDraw is NULL");
+
+    const TEXTURE* pTexture = pSprite->pTexture;
+    if (pSprite->Width == 0 || pSprite->Height == 0)
+    {
+        return false;
+    }
+
+    // 텍스처 영역 -> 화면 영역 순서로 자르고 잘린 만큼 반대쪽도 옮김
+    const int64_t srcMaxX = MIN((int64_t)pSprite->SrcX + pSprite->Width, (int64_t)pTexture->Width) - 1;
+    const int64_t srcMaxY = MIN((int64_t)pSprite->SrcY + pSprite->Height, (int64_t)pTexture->Height) - 1;
+    const int64_t srcMinX = MAX((int64_t)pSprite->SrcX, 0);
+    const int64_t srcMinY = MAX((int64_t)pSprite->SrcY, 0);
+
+    const int64_t destOffsetX = (int64_t)pSprite->X - pSprite->SrcX;
+    const int64_t destOffsetY = (int64_t)pSprite->Y - pSprite->SrcY;
+    const int64_t minX = MAX(srcMinX + destOffsetX, (int64_t)pScreenRect->MinX);
+    const int64_t minY = MAX(srcMinY + destOffsetY, (int64_t)pScreenRect->MinY);
+    const int64_t maxX = MIN(srcMaxX + destOffsetX, (int64_t)pScreenRect->MaxX);
+    const int64_t maxY = MIN(srcMaxY + destOffsetY, (int64_t)pScreenRect->MaxY);
+    if (minX > maxX || minY > maxY)
+    {
+        return false;
+    }
+
+    pOutDraw->pSrc = (const uint32_t*)pTexture->pBitmap
+        + (size_t)(minY - destOffsetY) * pTexture->Width + (size_t)(minX - destOffsetX);
+    pOutDraw->SrcPitch = pTexture->Width;
+    pOutDraw->X = (int)minX;
+    pOutDraw->Y = (int)minY;
+    pOutDraw->Width = (uint_t)(maxX - minX + 1);
+    pOutDraw->Height = (uint_t)(maxY - minY + 1);
+    pOutDraw->BlendMode = pSprite->BlendMode;
+    pOutDraw->pTexture = pTexture;
+    pOutDraw->Order = 0;
+
+    return true;
+}
\ No newline at end of file
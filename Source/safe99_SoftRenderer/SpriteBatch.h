@@ -0,0 +1,42 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 스프라이트 배열을 한 번에 클리핑하고 텍스처별로 정렬해서 그릴 목록을 만듦
+
+#ifndef SAFE99_SPRITE_BATCH_H
+#define SAFE99_SPRITE_BATCH_H
+
+// 텍스처와 화면 안으로 클리핑된 스프라이트
+typedef struct SPRITE_DRAW
+{
+    const uint32_t* pSrc;       // 클리핑된 영역의 첫 텍셀
+    uint_t          SrcPitch;   // 픽셀 단위
+    int             X;
+    int             Y;
+    uint_t          Width;
+    uint_t          Height;
+    BLEND_MODE      BlendMode;
+
+    // 정렬 키
+    const TEXTURE*  pTexture;
+    uint_t          Order;
+} SPRITE_DRAW;
+
+typedef struct SPRITE_BATCH
+{
+    SPRITE_DRAW*    pDraws;
+    uint_t          NumDraws;
+    uint_t          Capacity;
+} SPRITE_BATCH;
+
+void    __stdcall   SpriteBatchRelease(SPRITE_BATCH* pBatch);
+
+// 보이지 않는 스프라이트는 제외, 메모리 할당에 실패하면 false
+// bSortByTexture면 같은 텍스처끼리 모으고 같은 텍스처 안에서는 제출 순서를 유지
+bool    __stdcall   SpriteBatchBuild(SPRITE_BATCH* pBatch, const SPRITE* pSprites, const uint_t numSprites,
+                                     const CLIP_RECT* pScreenRect, const bool bSortByTexture);
+
+// 보이는 부분이 있다면 true
+bool    __stdcall   ClipSprite(const SPRITE* pSprite, const CLIP_RECT* pScreenRect, SPRITE_DRAW* pOutDraw);
+
+#endif // SAFE99_SPRITE_BATCH_H
\ No newline at end of file
@@ -0,0 +1,130 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+// 화면을 가로지르는 극단적인 좌표의 선분 검사, assert가 빠진 릴리즈 설정으로 빌드해서 실행
+// 렌더러 소스와 함께 NDEBUG로 빌드, 실패하면 0이 아닌 값을 반환
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+
+void __stdcall CreateDllInstance(void** ppOutInstance);
+
+#define WIDTH   320
+#define HEIGHT  240
+
+typedef struct LINE_CASE
+{
+    int     X0;
+    int     Y0;
+    int     X1;
+    int     Y1;
+    bool    bCrossesScreen;
+} LINE_CASE;
+
+static const LINE_CASE s_cases[] =
+{
+    { -2000000000, 5, 2000000000, 7, true },
+    { 5, -2100000000, 6, 2100000000, true },
+    { -1073741824, 3, 1073741824, 100, true },
+    { INT_MIN, INT_MIN, INT_MAX, INT_MAX, true },
+    { INT_MIN, 120, INT_MAX, 120, true },
+    { 160, INT_MAX, 160, INT_MIN, true },
+    { 100, 100, INT_MAX, INT_MAX - 7, true },
+    { 100, 100, INT_MIN, -1000000, true },
+    { INT_MAX, INT_MIN, INT_MIN, INT_MAX, false },
+    { -2000000000, -2000000000, -1999999000, -1999999000, false },
+};
+
+// 그린 픽셀 수를 반환하고 이상적인 선분에서 1픽셀 넘게 떨어진 픽셀이 있으면 -1
+static int countLinePixels(const uint32_t* pBuffer, const uint_t pitch, const LINE_CASE* pCase)
+{
+    const double dx = (double)pCase->X1 - pCase->X0;
+    const double dy = (double)pCase->Y1 - pCase->Y0;
+    const bool bGradual = fabs(dx) >= fabs(dy);
+
+    int numPixels = 0;
+    for (int y = 0; y < HEIGHT; ++y)
+    {
+        for (int x = 0; x < WIDTH; ++x)
+        {
+            if (pBuffer[y * pitch + x] == 0)
+            {
+                continue;
+            }
+
+            const double error = bGradual ? fabs(pCase->Y0 + dy * (x - (double)pCase->X0) / dx - y)
+                                          : fabs(pCase->X0 + dx * (y - (double)pCase->Y0) / dy - x);
+            if (error > 1.5)
+            {
+                return -1;
+            }
+
+            ++numPixels;
+        }
+    }
+
+    return numPixels;
+}
+
+static int drawLine(const LINE_CASE* pCase, const uint_t numRasterThreads, const bool bBatch)
+{
+    IRenderer* pRenderer;
+    CreateDllInstance((void**)&pRenderer);
+    if (!pRenderer->InitHeadless(pRenderer, WIDTH, HEIGHT))
+    {
+        pRenderer->Release(pRenderer);
+        return -1;
+    }
+
+    if (numRasterThreads > 0)
+    {
+        pRenderer->SetNumRasterThreads(pRenderer, numRasterThreads);
+    }
+
+    pRenderer->BeginRender(pRenderer);
+    pRenderer->Clear(pRenderer, 0);
+    if (bBatch)
+    {
+        pRenderer->DrawLines(pRenderer, &pCase->X0, &pCase->Y0, &pCase->X1, &pCase->Y1, 1, 0xffffffff);
+    }
+    else
+    {
+        pRenderer->DrawLine(pRenderer, pCase->X0, pCase->Y0, pCase->X1, pCase->Y1, 0xffffffff);
+    }
+    pRenderer->EndRender(pRenderer);
+
+    uint_t pitch;
+    const uint32_t* pFrontBuffer = pRenderer->GetFrontBuffer(pRenderer, &pitch);
+    const int numPixels = countLinePixels(pFrontBuffer, pitch, pCase);
+
+    pRenderer->Release(pRenderer);
+    return numPixels;
+}
+
+int main(void)
+{
+    int numFailures = 0;
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); ++i)
+    {
+        const LINE_CASE* pCase = &s_cases[i];
+        for (uint_t numRasterThreads = 0; numRasterThreads <= 2; numRasterThreads += 2)
+        {
+            const int numPixels = drawLine(pCase, numRasterThreads, false);
+            const int numBatchPixels = drawLine(pCase, numRasterThreads, true);
+            const bool bPassed = numPixels >= 0 && numPixels == numBatchPixels && ((numPixels > 0) == pCase->bCrossesScreen);
+            if (!bPassed)
+            {
+                printf("FAIL (%d, %d) - (%d, %d), raster threads %u: DrawLine %d, DrawLines %d\n",
+                       pCase->X0, pCase->Y0, pCase->X1, pCase->Y1, (unsigned)numRasterThreads, numPixels, numBatchPixels);
+                ++numFailures;
+            }
+        }
+    }
+
+    printf("%d failure(s)\n", numFailures);
+    return (numFailures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,617 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Triangle.h"
+#include "TransformedBitmap.h"
+#include "Raster.h"
+#include "TiledSurface.h"
+#include "TileBinner.h"
+
+#define DEFAULT_COMMAND_CAPACITY    256
+#define DEFAULT_BIN_CAPACITY        16
+
+static void getTileRect(const TILE_BINNER* pBinner, const uint_t tileX, const uint_t tileY, CLIP_RECT* pOutRect)
+{
+    pOutRect->MinX = (int)(tileX * TILE_SIZE);
+    pOutRect->MinY = (int)(tileY * TILE_SIZE);
+    pOutRect->MaxX = MIN(pOutRect->MinX + TILE_SIZE - 1, (int)pBinner->Pitch - 1);
+    pOutRect->MaxY = MIN(pOutRect->MinY + TILE_SIZE - 1, (int)pBinner->Height - 1);
+}
+
+static void getScreenRect(const TILE_BINNER* pBinner, CLIP_RECT* pOutRect)
+{
+    pOutRect->MinX = 0;
+    pOutRect->MinY = 0;
+    pOutRect->MaxX = (int)pBinner->Width - 1;
+    pOutRect->MaxY = (int)pBinner->Height - 1;
+}
+
+static void resetBins(TILE_BINNER* pBinner)
+{
+    const uint_t numTiles = pBinner->NumTilesX * pBinner->NumTilesY;
+    for (uint_t i = 0; i < numTiles; ++i)
+    {
+        pBinner->pBins[i].NumCommands = 0;
+    }
+
+    pBinner->NumCommands = 0;
+}
+
+static void releaseBins(TILE_BINNER* pBinner)
+{
+    if (pBinner->pBins == NULL)
+    {
+        return;
+    }
+
+    const uint_t numTiles = pBinner->NumTilesX * pBinner->NumTilesY;
+    for (uint_t i = 0; i < numTiles; ++i)
+    {
+        SAFE_FREE(pBinner->pBins[i].pCommandIndices);
+    }
+
+    SAFE_FREE(pBinner->pBins);
+    pBinner->NumTilesX = 0;
+    pBinner->NumTilesY = 0;
+}
+
+static DRAW_COMMAND* pushCommand(TILE_BINNER* pBinner, const DRAW_COMMAND_TYPE type, const uint32_t argb)
+{
+    if (pBinner->NumCommands == pBinner->CommandCapacity)
+    {
+        const uint_t newCapacity = pBinner->CommandCapacity * 2;
+        DRAW_COMMAND* pNewCommands = (DRAW_COMMAND*)realloc(pBinner->pCommands, sizeof(DRAW_COMMAND) * newCapacity);
+        if (pNewCommands == NULL)
+        {
+            return NULL;
+        }
+
+        pBinner->pCommands = pNewCommands;
+        pBinner->CommandCapacity = newCapacity;
+    }
+
+    DRAW_COMMAND* pCommand = &pBinner->pCommands[pBinner->NumCommands++];
+    pCommand->Type = type;
+    pCommand->Argb = argb;
+
+    return pCommand;
+}
+
+static bool addToBin(TILE_BIN* pBin, const uint32_t commandIndex)
+{
+    if (pBin->NumCommands == pBin->Capacity)
+    {
+        const uint_t newCapacity = (pBin->Capacity == 0) ? DEFAULT_BIN_CAPACITY : pBin->Capacity * 2;
+        uint32_t* pNewIndices = (uint32_t*)realloc(pBin->pCommandIndices, sizeof(uint32_t) * newCapacity);
+        if (pNewIndices == NULL)
+        {
+            return false;
+        }
+
+        pBin->pCommandIndices = pNewIndices;
+        pBin->Capacity = newCapacity;
+    }
+
+    pBin->pCommandIndices[pBin->NumCommands++] = commandIndex;
+    return true;
+}
+
+// 마지막으로 추가된 명령을 pRect(화면 좌표, 포함)와 겹치는 타일에 등록
+static bool binRect(TILE_BINNER* pBinner, const CLIP_RECT* pRect)
+{
+    CLIP_RECT screenRect;
+    getScreenRect(pBinner, &screenRect);
+
+    CLIP_RECT rect;
+    if (!IntersectClipRect(pRect, &screenRect, &rect))
+    {
+        --pBinner->NumCommands;
+        return true;
+    }
+
+    const uint32_t commandIndex = (uint32_t)(pBinner->NumCommands - 1);
+    for (int tileY = rect.MinY / TILE_SIZE; tileY <= rect.MaxY / TILE_SIZE; ++tileY)
+    {
+        TILE_BIN* pBinRow = pBinner->pBins + tileY * pBinner->NumTilesX;
+        for (int tileX = rect.MinX / TILE_SIZE; tileX <= rect.MaxX / TILE_SIZE; ++tileX)
+        {
+            if (!addToBin(&pBinRow[tileX], commandIndex))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool writesDepth(const TILE_BINNER* pBinner, const DRAW_COMMAND* pCommand)
+{
+    return pCommand->Type == DRAW_COMMAND_CLEAR_DEPTH
+        || (pCommand->Type == DRAW_COMMAND_TRIANGLE && pBinner->pDepthBuffer != NULL);
+}
+
+// 타일 전체를 불투명하게 덮는 마지막 명령의 인덱스, 없으면 0
+// 그 이전 명령의 색상은 모두 덮어써지므로 Clear 뒤에 배경을 그리는 프레임은 Clear를 채우지 않음
+static uint_t findLastOpaqueCover(const TILE_BINNER* pBinner, const TILE_BIN* pBin, const CLIP_RECT* pTileRect, const bool bFullTile)
+{
+    for (uint_t i = pBin->NumCommands; i > 1; --i)
+    {
+        const DRAW_COMMAND* pCommand = &pBinner->pCommands[pBin->pCommandIndices[i - 1]];
+        if (pCommand->Type == DRAW_COMMAND_CLEAR)
+        {
+            return i - 1;
+        }
+
+        // 비트맵은 화면 밖(패딩 열)에 그리지 않으므로 화면 안에 있는 타일만
+        if (pCommand->Type == DRAW_COMMAND_BITMAP && bFullTile
+            && pCommand->Bitmap.BlendMode == BLEND_MODE_OPAQUE
+            && pCommand->Bitmap.X <= pTileRect->MinX
+            && pCommand->Bitmap.Y <= pTileRect->MinY
+            && (int64_t)pCommand->Bitmap.X + pCommand->Bitmap.Width - 1 >= pTileRect->MaxX
+            && (int64_t)pCommand->Bitmap.Y + pCommand->Bitmap.Height - 1 >= pTileRect->MaxY)
+        {
+            return i - 1;
+        }
+    }
+
+    return 0;
+}
+
+// pClearRect는 Clear가 채울 영역, pScissor가 NULL이면 색상 명령은 그리지 않음
+static void rasterizeBin(const TILE_BINNER* pBinner, const TILE_BIN* pBin, const uint_t firstColorCommand,
+                         uint32_t* pBuffer, const uint_t pitch, DEPTH_BUFFER* pDepthBuffer,
+                         const CLIP_RECT* pClearRect, const CLIP_RECT* pScissor)
+{
+    for (uint_t i = 0; i < pBin->NumCommands; ++i)
+    {
+        const DRAW_COMMAND* pCommand = &pBinner->pCommands[pBin->pCommandIndices[i]];
+        if (i < firstColorCommand && !writesDepth(pBinner, pCommand))
+        {
+            continue;
+        }
+
+        if (pCommand->Type == DRAW_COMMAND_CLEAR)
+        {
+            FillRect(pBuffer, pitch, pClearRect, pCommand->Argb);
+            continue;
+        }
+
+        if (pCommand->Type == DRAW_COMMAND_CLEAR_DEPTH)
+        {
+            ClearDepthRect(pDepthBuffer, pitch, pClearRect, pCommand->Depth);
+            continue;
+        }
+
+        if (pScissor != NULL)
+        {
+            RasterizeDrawCommand(pBuffer, pitch, pScissor, pDepthBuffer, pCommand);
+        }
+    }
+}
+
+static void __stdcall rasterizeTile(void* pContext, const uint_t jobIndex)
+{
+    const TILE_BINNER* pBinner = (const TILE_BINNER*)pContext;
+    const TILE_BIN* pBin = &pBinner->pBins[jobIndex];
+    if (pBin->NumCommands == 0)
+    {
+        return;
+    }
+
+    CLIP_RECT tileRect;
+    getTileRect(pBinner, jobIndex % pBinner->NumTilesX, jobIndex / pBinner->NumTilesX, &tileRect);
+
+    // 패딩 열에 걸친 타일은 Clear만 그림
+    CLIP_RECT screenRect;
+    CLIP_RECT scissor;
+    getScreenRect(pBinner, &screenRect);
+    const bool bVisible = IntersectClipRect(&tileRect, &screenRect, &scissor);
+
+    const bool bFullTile = bVisible && scissor.MaxX == tileRect.MaxX;
+    const uint_t firstColorCommand = findLastOpaqueCover(pBinner, pBin, &tileRect, bFullTile);
+
+    if (pBinner->TiledHeight == 0)
+    {
+        rasterizeBin(pBinner, pBin, firstColorCommand, pBinner->pBuffer, pBinner->Pitch, pBinner->pDepthBuffer,
+                     &tileRect, bVisible ? &scissor : NULL);
+        return;
+    }
+
+    // 타일 배치에서는 타일 안의 띠를 하나씩 선형 버퍼로 보고 그림
+    for (uint_t strip = (uint_t)tileRect.MinX / SURFACE_TILE_SIZE; strip <= (uint_t)tileRect.MaxX / SURFACE_TILE_SIZE; ++strip)
+    {
+        CLIP_RECT clearRect;
+        CLIP_RECT stripScissor;
+        IntersectTiledStrip(&tileRect, strip, &clearRect);
+        const bool bStripVisible = bVisible && IntersectTiledStrip(&scissor, strip, &stripScissor);
+
+        DEPTH_BUFFER stripDepthBuffer;
+        DEPTH_BUFFER* pDepthBuffer = NULL;
+        if (pBinner->pDepthBuffer != NULL)
+        {
+            GetTiledStripDepthBuffer(pBinner->pDepthBuffer, pBinner->TiledHeight, strip, &stripDepthBuffer);
+            pDepthBuffer = &stripDepthBuffer;
+        }
+
+        rasterizeBin(pBinner, pBin, firstColorCommand, GetTiledStrip(pBinner->pBuffer, pBinner->TiledHeight, strip), SURFACE_TILE_SIZE,
+                     pDepthBuffer, &clearRect, bStripVisible ? &stripScissor : NULL);
+    }
+}
+
+bool __stdcall TileBinnerInit(TILE_BINNER* pBinner, const uint_t numThreads, const uint_t width, const uint_t height, const uint_t pitch,
+                             const uint_t tiledHeight)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(numThreads > 0, "numThreads is 0");
+
+    memset(pBinner, 0, sizeof(TILE_BINNER));
+
+    pBinner->pCommands = (DRAW_COMMAND*)malloc(sizeof(DRAW_COMMAND) * DEFAULT_COMMAND_CAPACITY);
+    if (pBinner->pCommands == NULL)
+    {
+        return false;
+    }
+    pBinner->CommandCapacity = DEFAULT_COMMAND_CAPACITY;
+
+    if (!TileBinnerResize(pBinner, width, height, pitch, tiledHeight)
+        || !WorkerPoolInit(&pBinner->Pool, numThreads))
+    {
+        releaseBins(pBinner);
+        SAFE_FREE(pBinner->pCommands);
+        return false;
+    }
+
+    return true;
+}
+
+void __stdcall TileBinnerRelease(TILE_BINNER* pBinner)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+
+    WorkerPoolRelease(&pBinner->Pool);
+    releaseBins(pBinner);
+    SAFE_FREE(pBinner->pCommands);
+    pBinner->NumCommands = 0;
+    pBinner->CommandCapacity = 0;
+}
+
+bool __stdcall TileBinnerResize(TILE_BINNER* pBinner, const uint_t width, const uint_t height, const uint_t pitch, const uint_t tiledHeight)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(width <= pitch, "width > pitch");
+
+    releaseBins(pBinner);
+
+    const uint_t numTilesX = (pitch + TILE_SIZE - 1) / TILE_SIZE;
+    const uint_t numTilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    pBinner->pBins = (TILE_BIN*)malloc(sizeof(TILE_BIN) * numTilesX * numTilesY);
+    if (pBinner->pBins == NULL)
+    {
+        return false;
+    }
+
+    memset(pBinner->pBins, 0, sizeof(TILE_BIN) * numTilesX * numTilesY);
+    pBinner->NumTilesX = numTilesX;
+    pBinner->NumTilesY = numTilesY;
+    pBinner->NumCommands = 0;
+    pBinner->Width = width;
+    pBinner->Height = height;
+    pBinner->Pitch = pitch;
+    pBinner->TiledHeight = tiledHeight;
+
+    return true;
+}
+
+// 마지막으로 추가된 명령을 모든 타일에 등록
+static bool binAllTiles(TILE_BINNER* pBinner)
+{
+    const uint32_t commandIndex = (uint32_t)(pBinner->NumCommands - 1);
+    const uint_t numTiles = pBinner->NumTilesX * pBinner->NumTilesY;
+    for (uint_t i = 0; i < numTiles; ++i)
+    {
+        if (!addToBin(&pBinner->pBins[i], commandIndex))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void __stdcall TileBinnerSetDepthBuffer(TILE_BINNER* pBinner, DEPTH_BUFFER* pDepthBuffer)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pBinner->NumCommands == 0, "Flush before changing the depth buffer");
+
+    pBinner->pDepthBuffer = pDepthBuffer;
+}
+
+bool __stdcall TileBinnerAddClear(TILE_BINNER* pBinner, const uint32_t argb)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+
+    // 깊이 버퍼가 없으면 이전 명령은 모두 덮어써지므로 버림
+    if (pBinner->pDepthBuffer == NULL)
+    {
+        resetBins(pBinner);
+    }
+
+    if (pushCommand(pBinner, DRAW_COMMAND_CLEAR, argb) == NULL)
+    {
+        return false;
+    }
+
+    return binAllTiles(pBinner);
+}
+
+bool __stdcall TileBinnerAddClearDepth(TILE_BINNER* pBinner, const float depth)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pBinner->pDepthBuffer != NULL, "pDepthBuffer is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_CLEAR_DEPTH, 0);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Depth = depth;
+
+    return binAllTiles(pBinner);
+}
+
+bool __stdcall TileBinnerAddHorizontalLine(TILE_BINNER* pBinner, const int x, const int y, const uint_t width, const uint32_t argb)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_HORIZONTAL_LINE, argb);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Span.X = x;
+    pCommand->Span.Y = y;
+    pCommand->Span.Length = width;
+
+    const CLIP_RECT rect = { x, y, (int)MIN((int64_t)x + width - 1, (int64_t)INT_MAX), y };
+    return binRect(pBinner, &rect);
+}
+
+bool __stdcall TileBinnerAddVerticalLine(TILE_BINNER* pBinner, const int x, const int y, const uint_t height, const uint32_t argb)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_VERTICAL_LINE, argb);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Span.X = x;
+    pCommand->Span.Y = y;
+    pCommand->Span.Length = height;
+
+    const CLIP_RECT rect = { x, y, x, (int)MIN((int64_t)y + height - 1, (int64_t)INT_MAX) };
+    return binRect(pBinner, &rect);
+}
+
+bool __stdcall TileBinnerAddLine(TILE_BINNER* pBinner, const int x0, const int y0, const int x1, const int y1, const uint32_t argb)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+
+    int lineX0 = x0;
+    int lineY0 = y0;
+    int lineX1 = x1;
+    int lineY1 = y1;
+    if (!ClampLineToCoordLimit(&lineX0, &lineY0, &lineX1, &lineY1))
+    {
+        return true;
+    }
+
+    LINE_STEPS line;
+    InitLineSteps(&line, lineX0, lineY0, lineX1, lineY1);
+
+    CLIP_RECT screenRect;
+    getScreenRect(pBinner, &screenRect);
+
+    int firstStep;
+    int lastStep;
+    if (!ClipLine(&screenRect, &line, &firstStep, &lastStep))
+    {
+        return true;
+    }
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_LINE, argb);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Line.X0 = lineX0;
+    pCommand->Line.Y0 = lineY0;
+    pCommand->Line.X1 = lineX1;
+    pCommand->Line.Y1 = lineY1;
+
+    // 주축 방향으로 타일 한 줄씩, 그 구간의 첫 점과 마지막 점 사이 부축 범위의 타일만 등록
+    const uint32_t commandIndex = (uint32_t)(pBinner->NumCommands - 1);
+    int sectionFirst = firstStep;
+    while (sectionFirst <= lastStep)
+    {
+        const int major = line.MajorStart + line.MajorDir * sectionFirst;
+        const int tileMajor = major / TILE_SIZE;
+        const int tileEdge = (line.MajorDir > 0) ? tileMajor * TILE_SIZE + TILE_SIZE - 1 : tileMajor * TILE_SIZE;
+        const int sectionLast = MIN(lastStep, sectionFirst + ABS(tileEdge - major));
+
+        const int minor0 = line.MinorStart + line.MinorDir * GetLineMinorCount(&line, sectionFirst);
+        const int minor1 = line.MinorStart + line.MinorDir * GetLineMinorCount(&line, sectionLast);
+        for (int tileMinor = MIN(minor0, minor1) / TILE_SIZE; tileMinor <= MAX(minor0, minor1) / TILE_SIZE; ++tileMinor)
+        {
+            const uint_t tileX = (uint_t)(line.bGradual ? tileMajor : tileMinor);
+            const uint_t tileY = (uint_t)(line.bGradual ? tileMinor : tileMajor);
+            if (!addToBin(&pBinner->pBins[tileY * pBinner->NumTilesX + tileX], commandIndex))
+            {
+                return false;
+            }
+        }
+
+        sectionFirst = sectionLast + 1;
+    }
+
+    return true;
+}
+
+bool __stdcall TileBinnerAddBitmap(TILE_BINNER* pBinner, const int x, const int y, const uint_t width, const uint_t height,
+                                   const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_BITMAP, 0);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Bitmap.X = x;
+    pCommand->Bitmap.Y = y;
+    pCommand->Bitmap.Width = width;
+    pCommand->Bitmap.Height = height;
+    pCommand->Bitmap.pBitmap = pBitmap;
+    pCommand->Bitmap.BitmapPitch = bitmapPitch;
+    pCommand->Bitmap.BlendMode = blendMode;
+
+    const CLIP_RECT rect =
+    {
+        x,
+        y,
+        (int)MIN((int64_t)x + width - 1, (int64_t)INT_MAX),
+        (int)MIN((int64_t)y + height - 1, (int64_t)INT_MAX)
+    };
+    return binRect(pBinner, &rect);
+}
+
+bool __stdcall TileBinnerAddTriangle(TILE_BINNER* pBinner, const TRIANGLE_SETUP* pSetup)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_TRIANGLE, 0);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->Triangle = *pSetup;
+
+    const uint32_t commandIndex = (uint32_t)(pBinner->NumCommands - 1);
+    for (int tileY = pSetup->MinY / TILE_SIZE; tileY <= pSetup->MaxY / TILE_SIZE; ++tileY)
+    {
+        for (int tileX = pSetup->MinX / TILE_SIZE; tileX <= pSetup->MaxX / TILE_SIZE; ++tileX)
+        {
+            CLIP_RECT rect;
+            getTileRect(pBinner, (uint_t)tileX, (uint_t)tileY, &rect);
+            rect.MinX = MAX(rect.MinX, pSetup->MinX);
+            rect.MinY = MAX(rect.MinY, pSetup->MinY);
+            rect.MaxX = MIN(rect.MaxX, pSetup->MaxX);
+            rect.MaxY = MIN(rect.MaxY, pSetup->MaxY);
+            if (IsTriangleOutsideRect(pSetup, &rect))
+            {
+                continue;
+            }
+
+            if (!addToBin(&pBinner->pBins[tileY * pBinner->NumTilesX + tileX], commandIndex))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool __stdcall TileBinnerAddTransformedBitmap(TILE_BINNER* pBinner, const TRANSFORMED_BITMAP_SETUP* pSetup)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+
+    DRAW_COMMAND* pCommand = pushCommand(pBinner, DRAW_COMMAND_TRANSFORMED_BITMAP, 0);
+    if (pCommand == NULL)
+    {
+        return false;
+    }
+
+    pCommand->TransformedBitmap = *pSetup;
+
+    const CLIP_RECT rect = { pSetup->MinX, pSetup->MinY, pSetup->MaxX, pSetup->MaxY };
+    return binRect(pBinner, &rect);
+}
+
+void __stdcall RasterizeDrawCommand(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor, DEPTH_BUFFER* pDepthBuffer,
+                                    const DRAW_COMMAND* pCommand)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+    ASSERT(pCommand != NULL, "pCommand is NULL");
+
+    switch (pCommand->Type)
+    {
+    case DRAW_COMMAND_HORIZONTAL_LINE:
+        RasterizeHorizontalLine(pBuffer, pitch, pScissor,
+                                pCommand->Span.X, pCommand->Span.Y, pCommand->Span.Length, pCommand->Argb);
+        break;
+    case DRAW_COMMAND_VERTICAL_LINE:
+        RasterizeVerticalLine(pBuffer, pitch, pScissor,
+                              pCommand->Span.X, pCommand->Span.Y, pCommand->Span.Length, pCommand->Argb);
+        break;
+    case DRAW_COMMAND_LINE:
+        RasterizeLine(pBuffer, pitch, pScissor,
+                      pCommand->Line.X0, pCommand->Line.Y0, pCommand->Line.X1, pCommand->Line.Y1, pCommand->Argb);
+        break;
+    case DRAW_COMMAND_BITMAP:
+        RasterizeBitmap(pBuffer, pitch, pScissor,
+                        pCommand->Bitmap.X, pCommand->Bitmap.Y, pCommand->Bitmap.Width, pCommand->Bitmap.Height,
+                        pCommand->Bitmap.pBitmap, pCommand->Bitmap.BitmapPitch, pCommand->Bitmap.BlendMode);
+        break;
+    case DRAW_COMMAND_TRIANGLE:
+        RasterizeTriangle(pBuffer, pitch, &pCommand->Triangle, pScissor, pDepthBuffer);
+        break;
+    case DRAW_COMMAND_TRANSFORMED_BITMAP:
+        RasterizeTransformedBitmap(pBuffer, pitch, pScissor, &pCommand->TransformedBitmap);
+        break;
+    default:
+        ASSERT(false, "Invalid draw command");
+        break;
+    }
+}
+
+void __stdcall TileBinnerFlush(TILE_BINNER* pBinner, uint32_t* pBuffer)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+
+    if (pBinner->NumCommands == 0)
+    {
+        return;
+    }
+
+    pBinner->pBuffer = pBuffer;
+    WorkerPoolDispatch(&pBinner->Pool, rasterizeTile, pBinner, pBinner->NumTilesX * pBinner->NumTilesY);
+    pBinner->pBuffer = NULL;
+
+    resetBins(pBinner);
+}
+
+bool __stdcall TileBinnerIsEmpty(const TILE_BINNER* pBinner)
+{
+    ASSERT(pBinner != NULL, "pBinner is NULL");
+    return pBinner->NumCommands == 0;
+}
\ No newline at end of file
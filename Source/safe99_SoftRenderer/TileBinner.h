@@ -0,0 +1,132 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 그리기 명령을 TILE_SIZE x TILE_SIZE 타일별로 모아뒀다가 워커 풀로 타일 단위 병렬 래스터화
+// 각 타일은 자기 영역만 시저로 그리므로 타일 간 동기화가 필요 없음
+
+#ifndef SAFE99_TILE_BINNER_H
+#define SAFE99_TILE_BINNER_H
+
+#include "safe99_Common/Util/WorkerPool.h"
+
+#define TILE_SIZE 64
+
+typedef enum DRAW_COMMAND_TYPE
+{
+    DRAW_COMMAND_CLEAR,
+    DRAW_COMMAND_CLEAR_DEPTH,
+    DRAW_COMMAND_HORIZONTAL_LINE,
+    DRAW_COMMAND_VERTICAL_LINE,
+    DRAW_COMMAND_LINE,
+    DRAW_COMMAND_BITMAP,
+    DRAW_COMMAND_TRIANGLE,
+    DRAW_COMMAND_TRANSFORMED_BITMAP,
+} DRAW_COMMAND_TYPE;
+
+typedef struct SPAN_COMMAND
+{
+    int     X;
+    int     Y;
+    uint_t  Length;
+} SPAN_COMMAND;
+
+// 끝점은 화면 안으로 클리핑된 상태
+typedef struct LINE_COMMAND
+{
+    int     X0;
+    int     Y0;
+    int     X1;
+    int     Y1;
+} LINE_COMMAND;
+
+// pBitmap은 Flush 전까지 유효해야 함
+typedef struct BITMAP_COMMAND
+{
+    int         X;
+    int         Y;
+    uint_t      Width;
+    uint_t      Height;
+    const void* pBitmap;
+    uint_t      BitmapPitch;
+    BLEND_MODE  BlendMode;
+} BITMAP_COMMAND;
+
+typedef struct DRAW_COMMAND
+{
+    DRAW_COMMAND_TYPE   Type;
+    uint32_t            Argb;
+
+    union
+    {
+        float           Depth;
+        SPAN_COMMAND    Span;
+        LINE_COMMAND    Line;
+        BITMAP_COMMAND  Bitmap;
+        TRIANGLE_SETUP  Triangle;
+        TRANSFORMED_BITMAP_SETUP    TransformedBitmap;
+    };
+} DRAW_COMMAND;
+
+typedef struct TILE_BIN
+{
+    uint32_t*   pCommandIndices;
+    uint_t      NumCommands;
+    uint_t      Capacity;
+} TILE_BIN;
+
+typedef struct TILE_BINNER
+{
+    WORKER_POOL     Pool;
+
+    DRAW_COMMAND*   pCommands;
+    uint_t          NumCommands;
+    uint_t          CommandCapacity;
+
+    TILE_BIN*       pBins;
+    uint_t          NumTilesX;
+    uint_t          NumTilesY;
+
+    uint_t          Width;
+    uint_t          Height;
+    uint_t          Pitch;
+
+    // 0이면 선형 배치
+    uint_t          TiledHeight;
+
+    // NULL이면 깊이 테스트 없음
+    DEPTH_BUFFER*   pDepthBuffer;
+
+    // Flush 중에만 유효
+    uint32_t*       pBuffer;
+} TILE_BINNER;
+
+// tiledHeight가 0이 아니면 버퍼가 타일 배치 (TiledSurface.h)
+bool    __stdcall   TileBinnerInit(TILE_BINNER* pBinner, const uint_t numThreads, const uint_t width, const uint_t height, const uint_t pitch,
+                                   const uint_t tiledHeight);
+void    __stdcall   TileBinnerRelease(TILE_BINNER* pBinner);
+
+// 쌓인 명령은 버려지므로 먼저 Flush 해야 함
+bool    __stdcall   TileBinnerResize(TILE_BINNER* pBinner, const uint_t width, const uint_t height, const uint_t pitch, const uint_t tiledHeight);
+void    __stdcall   TileBinnerSetDepthBuffer(TILE_BINNER* pBinner, DEPTH_BUFFER* pDepthBuffer);
+
+// 메모리 할당에 실패하면 false, 호출자는 Flush 후 직접 그려야 함
+bool    __stdcall   TileBinnerAddClear(TILE_BINNER* pBinner, const uint32_t argb);
+bool    __stdcall   TileBinnerAddClearDepth(TILE_BINNER* pBinner, const float depth);
+bool    __stdcall   TileBinnerAddHorizontalLine(TILE_BINNER* pBinner, const int x, const int y, const uint_t width, const uint32_t argb);
+bool    __stdcall   TileBinnerAddVerticalLine(TILE_BINNER* pBinner, const int x, const int y, const uint_t height, const uint32_t argb);
+bool    __stdcall   TileBinnerAddLine(TILE_BINNER* pBinner, const int x0, const int y0, const int x1, const int y1, const uint32_t argb);
+bool    __stdcall   TileBinnerAddBitmap(TILE_BINNER* pBinner, const int x, const int y, const uint_t width, const uint_t height,
+                                        const void* pBitmap, const uint_t bitmapPitch, const BLEND_MODE blendMode);
+bool    __stdcall   TileBinnerAddTriangle(TILE_BINNER* pBinner, const TRIANGLE_SETUP* pSetup);
+bool    __stdcall   TileBinnerAddTransformedBitmap(TILE_BINNER* pBinner, const TRANSFORMED_BITMAP_SETUP* pSetup);
+
+// 모든 타일을 그린 후 반환, 쌓인 명령은 비워짐
+void    __stdcall   TileBinnerFlush(TILE_BINNER* pBinner, uint32_t* pBuffer);
+
+bool    __stdcall   TileBinnerIsEmpty(const TILE_BINNER* pBinner);
+
+// Clear, ClearDepth를 뺀 명령 하나를 pScissor 안에 그림
+void    __stdcall   RasterizeDrawCommand(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor, DEPTH_BUFFER* pDepthBuffer,
+                                         const DRAW_COMMAND* pCommand);
+
+#endif // SAFE99_TILE_BINNER_H
\ No newline at end of file
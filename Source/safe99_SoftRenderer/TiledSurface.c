@@ -0,0 +1,167 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Raster.h"
+#include "TiledSurface.h"
+
+static bool isFullStripWidth(const CLIP_RECT* pRect, const uint_t strip)
+{
+    return pRect->MinX == (int)(strip * SURFACE_TILE_SIZE) && pRect->MaxX == (int)(strip * SURFACE_TILE_SIZE + SURFACE_TILE_SIZE - 1);
+}
+
+uint_t __stdcall GetTiledHeight(const uint_t height)
+{
+    return (height + SURFACE_TILE_SIZE - 1) / SURFACE_TILE_SIZE * SURFACE_TILE_SIZE;
+}
+
+uint32_t* __stdcall GetTiledStrip(uint32_t* pBuffer, const uint_t tiledHeight, const uint_t strip)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(tiledHeight % SURFACE_TILE_SIZE == 0, "tiledHeight is not aligned");
+
+    // 띠 시작은 strip * SURFACE_TILE_SIZE * tiledHeight, x에 띠 시작 열이 더해지므로 미리 뺌 (tiledHeight >= 1이라 음수가 되지 않음)
+    return pBuffer + (size_t)strip * SURFACE_TILE_SIZE * (tiledHeight - 1);
+}
+
+void __stdcall GetTiledStripDepthBuffer(const DEPTH_BUFFER* pDepthBuffer, const uint_t tiledHeight, const uint_t strip,
+                                        DEPTH_BUFFER* pOutDepthBuffer)
+{
+    ASSERT(pDepthBuffer != NULL, "pDepthBuffer is NULL");
+    ASSERT(pOutDepthBuffer != NULL, "pOutDepthBuffer is NULL");
+
+    *pOutDepthBuffer = *pDepthBuffer;
+    pOutDepthBuffer->pDepths = GetTiledStrip((uint32_t*)pDepthBuffer->pDepths, tiledHeight, strip);
+}
+
+bool __stdcall IntersectTiledStrip(const CLIP_RECT* pRect, const uint_t strip, CLIP_RECT* pOutRect)
+{
+    ASSERT(pRect != NULL, "pRect is NULL");
+    ASSERT(pOutRect != NULL, "pOutRect is NULL");
+
+    const CLIP_RECT stripRect = { (int)(strip * SURFACE_TILE_SIZE), INT_MIN, (int)(strip * SURFACE_TILE_SIZE + SURFACE_TILE_SIZE - 1), INT_MAX };
+    return IntersectClipRect(pRect, &stripRect, pOutRect);
+}
+
+void __stdcall FillSurfaceRect(uint32_t* pBuffer, const uint_t pitch, const uint_t tiledHeight, const CLIP_RECT* pRect, const uint32_t argb)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    if (tiledHeight == 0)
+    {
+        FillRect(pBuffer, pitch, pRect, argb);
+        return;
+    }
+
+    for (uint_t strip = (uint_t)pRect->MinX / SURFACE_TILE_SIZE; strip <= (uint_t)pRect->MaxX / SURFACE_TILE_SIZE; ++strip)
+    {
+        CLIP_RECT rect;
+        IntersectTiledStrip(pRect, strip, &rect);
+
+        uint32_t* pStrip = GetTiledStrip(pBuffer, tiledHeight, strip);
+        if (isFullStripWidth(&rect, strip))
+        {
+            // 띠 너비 전체면 행들이 이어져 있음
+            FillSpan(pStrip + (size_t)rect.MinY * SURFACE_TILE_SIZE + rect.MinX,
+                     (size_t)(rect.MaxY - rect.MinY + 1) * SURFACE_TILE_SIZE, argb);
+        }
+        else
+        {
+            FillRect(pStrip, SURFACE_TILE_SIZE, &rect, argb);
+        }
+    }
+}
+
+void __stdcall CopySurfaceRect(uint32_t* pDest, const uint32_t* pSrc, const uint_t pitch, const uint_t tiledHeight, const CLIP_RECT* pRect)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    if (tiledHeight == 0)
+    {
+        const size_t width = (size_t)(pRect->MaxX - pRect->MinX + 1);
+        for (int y = pRect->MinY; y <= pRect->MaxY; ++y)
+        {
+            const size_t offset = (size_t)y * pitch + pRect->MinX;
+            CopySpan(pDest + offset, pSrc + offset, width);
+        }
+
+        return;
+    }
+
+    for (uint_t strip = (uint_t)pRect->MinX / SURFACE_TILE_SIZE; strip <= (uint_t)pRect->MaxX / SURFACE_TILE_SIZE; ++strip)
+    {
+        CLIP_RECT rect;
+        IntersectTiledStrip(pRect, strip, &rect);
+
+        // 두 버퍼의 배치가 같으므로 띠 안의 위치도 같음
+        const size_t stripOffset = GetTiledStrip(pDest, tiledHeight, strip) - pDest;
+        if (isFullStripWidth(&rect, strip))
+        {
+            const size_t offset = stripOffset + (size_t)rect.MinY * SURFACE_TILE_SIZE + rect.MinX;
+            CopySpan(pDest + offset, pSrc + offset, (size_t)(rect.MaxY - rect.MinY + 1) * SURFACE_TILE_SIZE);
+            continue;
+        }
+
+        const size_t width = (size_t)(rect.MaxX - rect.MinX + 1);
+        for (int y = rect.MinY; y <= rect.MaxY; ++y)
+        {
+            const size_t offset = stripOffset + (size_t)y * SURFACE_TILE_SIZE + rect.MinX;
+            CopySpan(pDest + offset, pSrc + offset, width);
+        }
+    }
+}
+
+void __stdcall DetileRect(uint32_t* pDest, const uint_t destPitch, const uint32_t* pSrc, const uint_t tiledHeight, const CLIP_RECT* pRect)
+{
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    // 띠 단위로 원본을 순서대로 읽고 대상에는 행마다 캐시 라인 하나씩 씀
+    for (uint_t strip = (uint_t)pRect->MinX / SURFACE_TILE_SIZE; strip <= (uint_t)pRect->MaxX / SURFACE_TILE_SIZE; ++strip)
+    {
+        CLIP_RECT rect;
+        IntersectTiledStrip(pRect, strip, &rect);
+
+        const uint32_t* pStrip = GetTiledStrip((uint32_t*)pSrc, tiledHeight, strip);
+        const uint32_t* pSrcRow = pStrip + (size_t)rect.MinY * SURFACE_TILE_SIZE + rect.MinX;
+        uint32_t* pDestRow = pDest + (size_t)rect.MinY * destPitch + rect.MinX;
+
+        if (!isFullStripWidth(&rect, strip))
+        {
+            const size_t width = (size_t)(rect.MaxX - rect.MinX + 1);
+            for (int y = rect.MinY; y <= rect.MaxY; ++y)
+            {
+                memcpy(pDestRow, pSrcRow, sizeof(uint32_t) * width);
+                pSrcRow += SURFACE_TILE_SIZE;
+                pDestRow += destPitch;
+            }
+
+            continue;
+        }
+
+        // 한 행은 SURFACE_TILE_SIZE(16)픽셀 = 128비트 4개
+        for (int y = rect.MinY; y <= rect.MaxY; ++y)
+        {
+            const __m128i p0 = _mm_loadu_si128((const __m128i*)pSrcRow);
+            const __m128i p1 = _mm_loadu_si128((const __m128i*)(pSrcRow + 4));
+            const __m128i p2 = _mm_loadu_si128((const __m128i*)(pSrcRow + 8));
+            const __m128i p3 = _mm_loadu_si128((const __m128i*)(pSrcRow + 12));
+            _mm_storeu_si128((__m128i*)pDestRow, p0);
+            _mm_storeu_si128((__m128i*)(pDestRow + 4), p1);
+            _mm_storeu_si128((__m128i*)(pDestRow + 8), p2);
+            _mm_storeu_si128((__m128i*)(pDestRow + 12), p3);
+
+            pSrcRow += SURFACE_TILE_SIZE;
+            pDestRow += destPitch;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 타일 우선(tile-major) 백 버퍼 배치
+// SURFACE_TILE_SIZE 너비의 세로 띠를 왼쪽부터 차례로 저장하고 띠 안은 피치가 SURFACE_TILE_SIZE인 선형 배치
+// 띠 안의 SURFACE_TILE_SIZE x SURFACE_TILE_SIZE 타일은 연속이므로 세로 방향으로 그려도 가까운 캐시 라인과 페이지에 머묾
+// 띠 하나를 (x, y) 좌표 그대로 쓰는 선형 버퍼로 볼 수 있어 기존 커널에 시저만 띠로 좁혀서 넘김
+
+#ifndef SAFE99_TILED_SURFACE_H
+#define SAFE99_TILED_SURFACE_H
+
+// 32비트 픽셀이면 타일 한 행이 캐시 라인 하나
+#define SURFACE_TILE_SIZE 16
+
+// 타일 배치 버퍼의 행 수 (SURFACE_TILE_SIZE 배수로 올림)
+uint_t      __stdcall   GetTiledHeight(const uint_t height);
+
+// strip번째 띠를 피치 SURFACE_TILE_SIZE인 선형 버퍼로 볼 때의 (0, 0) 위치, 띠 안의 좌표로만 접근해야 함
+uint32_t*   __stdcall   GetTiledStrip(uint32_t* pBuffer, const uint_t tiledHeight, const uint_t strip);
+
+// pDepthBuffer의 strip번째 띠를 같은 방식으로 보는 깊이 버퍼, Hi-Z 블록은 공유
+void        __stdcall   GetTiledStripDepthBuffer(const DEPTH_BUFFER* pDepthBuffer, const uint_t tiledHeight, const uint_t strip,
+                                                 DEPTH_BUFFER* pOutDepthBuffer);
+
+// pRect와 strip번째 띠가 겹치는 영역, 겹치지 않으면 false
+bool        __stdcall   IntersectTiledStrip(const CLIP_RECT* pRect, const uint_t strip, CLIP_RECT* pOutRect);
+
+// tiledHeight가 0이면 pitch를 쓰는 선형 배치
+void        __stdcall   FillSurfaceRect(uint32_t* pBuffer, const uint_t pitch, const uint_t tiledHeight, const CLIP_RECT* pRect, const uint32_t argb);
+void        __stdcall   CopySurfaceRect(uint32_t* pDest, const uint32_t* pSrc, const uint_t pitch, const uint_t tiledHeight, const CLIP_RECT* pRect);
+
+// 타일 배치 pSrc의 pRect 영역을 선형 pDest로 펼침
+void        __stdcall   DetileRect(uint32_t* pDest, const uint_t destPitch, const uint32_t* pSrc, const uint_t tiledHeight, const CLIP_RECT* pRect);
+
+#endif // SAFE99_TILED_SURFACE_H
\ No newline at end of file
@@ -0,0 +1,283 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Raster.h"
+#include "TransformedBitmap.h"
+
+#include <math.h>
+
+// 샘플링한 픽셀을 이만큼 모아서 BlendSpan으로 씀
+#define SPAN_CHUNK_SIZE 64
+
+// 화면 좌표가 이 범위를 넘는 픽셀의 비트맵 좌표도 int64에 들어가도록 한 스텝의 한계 (16.16)
+#define MAX_TRANSFORMED_STEP ((int64_t)1 << 40)
+
+static int64_t floorDivide(const int64_t a, const int64_t b)
+{
+    ASSERT(b > 0, "b <= 0");
+
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+static int64_t ceilDivide(const int64_t a, const int64_t b)
+{
+    return -floorDivide(-a, b);
+}
+
+// start + x * step 이 [0, max]에 드는 x로 [*pMinX, *pMaxX]를 좁힘
+static void clipSpanAxis(const int64_t start, const int64_t step, const int64_t max, int64_t* pMinX, int64_t* pMaxX)
+{
+    if (step == 0)
+    {
+        if (start < 0 || start > max)
+        {
+            *pMaxX = *pMinX - 1;
+        }
+        return;
+    }
+
+    int64_t first;
+    int64_t last;
+    if (step > 0)
+    {
+        first = ceilDivide(-start, step);
+        last = floorDivide(max - start, step);
+    }
+    else
+    {
+        first = ceilDivide(start - max, -step);
+        last = floorDivide(start, -step);
+    }
+
+    *pMinX = MAX(*pMinX, first);
+    *pMaxX = MIN(*pMaxX, last);
+}
+
+static __m128i __vectorcall gatherTexels(const uint32_t* pTexels, const __m128i index)
+{
+    return _mm_set_epi32((int)pTexels[_mm_extract_epi32(index, 3)],
+                         (int)pTexels[_mm_extract_epi32(index, 2)],
+                         (int)pTexels[_mm_extract_epi32(index, 1)],
+                         (int)pTexels[_mm_cvtsi128_si32(index)]);
+}
+
+// weight는 [0, 256], t0 * (256 - weight) + t1 * weight를 채널별로 계산 (텍스처 삼각형과 같은 결과)
+static __m128i __vectorcall lerpTexels(const __m128i t0, const __m128i t1, const __m128i weight)
+{
+    const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i weight1 = _mm_or_si128(weight, _mm_slli_epi32(weight, 16));
+    const __m128i weight0 = _mm_sub_epi16(_mm_set1_epi32(0x01000100), weight1);
+
+    const __m128i rb = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(t0, mask), weight0),
+                                     _mm_mullo_epi16(_mm_and_si128(t1, mask), weight1));
+    const __m128i ag = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(t0, 8), mask), weight0),
+                                     _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(t1, 8), mask), weight1));
+
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi32(rb, 8), mask), _mm_andnot_si128(mask, ag));
+}
+
+static __m128i __vectorcall clampTexels(const __m128i coord, const __m128i maxCoord)
+{
+    return _mm_min_epi32(_mm_max_epi32(coord, _mm_setzero_si128()), maxCoord);
+}
+
+// 4픽셀씩 좌표를 구해서 pOut에 roundUp4(count)개를 씀
+// 구간 밖의 마지막 묶음 레인도 좌표를 비트맵 안으로 자르므로 비트맵 밖을 읽지 않음
+static void sampleSpan(uint32_t* pOut, const uint_t count, const int32_t startU, const int32_t startV,
+                       const int32_t stepU, const int32_t stepV, const TRANSFORMED_BITMAP_SETUP* pSetup)
+{
+    const __m128i laneIndices = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i u = _mm_add_epi32(_mm_set1_epi32(startU), _mm_mullo_epi32(laneIndices, _mm_set1_epi32(stepU)));
+    __m128i v = _mm_add_epi32(_mm_set1_epi32(startV), _mm_mullo_epi32(laneIndices, _mm_set1_epi32(stepV)));
+    const __m128i stepU4 = _mm_set1_epi32((int)((uint32_t)stepU * 4));
+    const __m128i stepV4 = _mm_set1_epi32((int)((uint32_t)stepV * 4));
+
+    const __m128i maxX = _mm_set1_epi32((int)pSetup->Width - 1);
+    const __m128i maxY = _mm_set1_epi32((int)pSetup->Height - 1);
+    const __m128i pitch = _mm_set1_epi32((int)pSetup->Width);
+    const uint32_t* pTexels = pSetup->pBitmap;
+
+    if (!pSetup->bBilinear)
+    {
+        for (uint_t i = 0; i < count; i += 4)
+        {
+            const __m128i x = clampTexels(_mm_srai_epi32(u, TRANSFORMED_BITMAP_FRAC_BITS), maxX);
+            const __m128i y = clampTexels(_mm_srai_epi32(v, TRANSFORMED_BITMAP_FRAC_BITS), maxY);
+            _mm_storeu_si128((__m128i*)(pOut + i), gatherTexels(pTexels, _mm_add_epi32(_mm_mullo_epi32(y, pitch), x)));
+
+            u = _mm_add_epi32(u, stepU4);
+            v = _mm_add_epi32(v, stepV4);
+        }
+        return;
+    }
+
+    // 텍셀 중심 기준으로 주변 4개를 보간, 가장자리 밖은 가장자리 텍셀
+    const __m128i half = _mm_set1_epi32(1 << (TRANSFORMED_BITMAP_FRAC_BITS - 1));
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i weightMask = _mm_set1_epi32(0xff);
+    for (uint_t i = 0; i < count; i += 4)
+    {
+        const __m128i centerU = _mm_sub_epi32(u, half);
+        const __m128i centerV = _mm_sub_epi32(v, half);
+        const __m128i floorU = _mm_srai_epi32(centerU, TRANSFORMED_BITMAP_FRAC_BITS);
+        const __m128i floorV = _mm_srai_epi32(centerV, TRANSFORMED_BITMAP_FRAC_BITS);
+        const __m128i weightU = _mm_and_si128(_mm_srli_epi32(centerU, TRANSFORMED_BITMAP_FRAC_BITS - 8), weightMask);
+        const __m128i weightV = _mm_and_si128(_mm_srli_epi32(centerV, TRANSFORMED_BITMAP_FRAC_BITS - 8), weightMask);
+
+        const __m128i x0 = clampTexels(floorU, maxX);
+        const __m128i x1 = clampTexels(_mm_add_epi32(floorU, one), maxX);
+        const __m128i row0 = _mm_mullo_epi32(clampTexels(floorV, maxY), pitch);
+        const __m128i row1 = _mm_mullo_epi32(clampTexels(_mm_add_epi32(floorV, one), maxY), pitch);
+
+        const __m128i t00 = gatherTexels(pTexels, _mm_add_epi32(row0, x0));
+        const __m128i t10 = gatherTexels(pTexels, _mm_add_epi32(row0, x1));
+        const __m128i t01 = gatherTexels(pTexels, _mm_add_epi32(row1, x0));
+        const __m128i t11 = gatherTexels(pTexels, _mm_add_epi32(row1, x1));
+        _mm_storeu_si128((__m128i*)(pOut + i), lerpTexels(lerpTexels(t00, t10, weightU), lerpTexels(t01, t11, weightU), weightV));
+
+        u = _mm_add_epi32(u, stepU4);
+        v = _mm_add_epi32(v, stepV4);
+    }
+}
+
+bool __stdcall SetupTransformedBitmap(TRANSFORMED_BITMAP_SETUP* pOutSetup, const CLIP_RECT* pScreenRect,
+                                      const uint_t width, const uint_t height, const void* pBitmap,
+                                      const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode)
+{
+    ASSERT(pOutSetup != NULL, "pOutSetup is NULL");
+    ASSERT(pScreenRect != NULL, "pScreenRect is NULL");
+    ASSERT(pBitmap != NULL, "pBitmap is NULL");
+    ASSERT(pTransform != NULL, "pTransform is NULL");
+    ASSERT(width < MAX_TRANSFORMED_BITMAP_SIZE && height < MAX_TRANSFORMED_BITMAP_SIZE, "Bitmap is too large");
+
+    if (width == 0 || height == 0)
+    {
+        return false;
+    }
+
+    const double m00 = pTransform->M00;
+    const double m01 = pTransform->M01;
+    const double m02 = pTransform->M02;
+    const double m10 = pTransform->M10;
+    const double m11 = pTransform->M11;
+    const double m12 = pTransform->M12;
+
+    // 네 모서리의 바운딩 박스에서 중심이 들어가는 픽셀
+    const double cornerXs[4] = { m02, m00 * width + m02, m01 * height + m02, m00 * width + m01 * height + m02 };
+    const double cornerYs[4] = { m12, m10 * width + m12, m11 * height + m12, m10 * width + m11 * height + m12 };
+    double minX = cornerXs[0];
+    double maxX = cornerXs[0];
+    double minY = cornerYs[0];
+    double maxY = cornerYs[0];
+    for (uint_t i = 1; i < 4; ++i)
+    {
+        minX = MIN(minX, cornerXs[i]);
+        maxX = MAX(maxX, cornerXs[i]);
+        minY = MIN(minY, cornerYs[i]);
+        maxY = MAX(maxY, cornerYs[i]);
+    }
+
+    // NaN이면 비교가 모두 거짓이므로 여기서 걸러짐
+    minX = MAX(ceil(minX - 0.5), (double)pScreenRect->MinX);
+    maxX = MIN(floor(maxX - 0.5), (double)pScreenRect->MaxX);
+    minY = MAX(ceil(minY - 0.5), (double)pScreenRect->MinY);
+    maxY = MIN(floor(maxY - 0.5), (double)pScreenRect->MaxY);
+    if (!(minX <= maxX && minY <= maxY))
+    {
+        return false;
+    }
+
+    const double determinant = m00 * m11 - m01 * m10;
+    if (determinant == 0.0)
+    {
+        return false;
+    }
+
+    // 화면 좌표 한 칸에 해당하는 비트맵 좌표 (16.16)
+    const double scale = (double)(1 << TRANSFORMED_BITMAP_FRAC_BITS) / determinant;
+    const double stepXU = m11 * scale;
+    const double stepYU = -m01 * scale;
+    const double stepXV = -m10 * scale;
+    const double stepYV = m00 * scale;
+    if (!(fabs(stepXU) < (double)MAX_TRANSFORMED_STEP && fabs(stepYU) < (double)MAX_TRANSFORMED_STEP
+          && fabs(stepXV) < (double)MAX_TRANSFORMED_STEP && fabs(stepYV) < (double)MAX_TRANSFORMED_STEP))
+    {
+        return false;
+    }
+
+    pOutSetup->MinX = (int)minX;
+    pOutSetup->MinY = (int)minY;
+    pOutSetup->MaxX = (int)maxX;
+    pOutSetup->MaxY = (int)maxY;
+
+    pOutSetup->pBitmap = (const uint32_t*)pBitmap;
+    pOutSetup->Width = width;
+    pOutSetup->Height = height;
+    pOutSetup->bBilinear = (filter != TEXTURE_FILTER_POINT);
+    pOutSetup->BlendMode = blendMode;
+
+    // 픽셀 (0, 0)의 중심
+    pOutSetup->OriginU = llround((0.5 - m02) * stepXU + (0.5 - m12) * stepYU);
+    pOutSetup->OriginV = llround((0.5 - m02) * stepXV + (0.5 - m12) * stepYV);
+    pOutSetup->StepXU = llround(stepXU);
+    pOutSetup->StepXV = llround(stepXV);
+    pOutSetup->StepYU = llround(stepYU);
+    pOutSetup->StepYV = llround(stepYV);
+
+    return true;
+}
+
+void __stdcall RasterizeTransformedBitmap(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                          const TRANSFORMED_BITMAP_SETUP* pSetup)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pScissor != NULL, "pScissor is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+
+    const int minX = MAX(pSetup->MinX, pScissor->MinX);
+    const int maxX = MIN(pSetup->MaxX, pScissor->MaxX);
+    const int minY = MAX(pSetup->MinY, pScissor->MinY);
+    const int maxY = MIN(pSetup->MaxY, pScissor->MaxY);
+
+    const int64_t maxU = ((int64_t)pSetup->Width << TRANSFORMED_BITMAP_FRAC_BITS) - 1;
+    const int64_t maxV = ((int64_t)pSetup->Height << TRANSFORMED_BITMAP_FRAC_BITS) - 1;
+
+    uint32_t texels[SPAN_CHUNK_SIZE];
+    for (int y = minY; y <= maxY; ++y)
+    {
+        const int64_t rowU = pSetup->OriginU + y * pSetup->StepYU;
+        const int64_t rowV = pSetup->OriginV + y * pSetup->StepYV;
+
+        int64_t spanMinX = minX;
+        int64_t spanMaxX = maxX;
+        clipSpanAxis(rowU, pSetup->StepXU, maxU, &spanMinX, &spanMaxX);
+        clipSpanAxis(rowV, pSetup->StepXV, maxV, &spanMinX, &spanMaxX);
+        if (spanMinX > spanMaxX)
+        {
+            continue;
+        }
+
+        // 구간 안의 좌표는 모두 [0, max]이므로 스텝 누적도 int32에 들어감
+        const uint_t count = (uint_t)(spanMaxX - spanMinX + 1);
+        const int32_t stepU = (count > 1) ? (int32_t)pSetup->StepXU : 0;
+        const int32_t stepV = (count > 1) ? (int32_t)pSetup->StepXV : 0;
+        int32_t u = (int32_t)(rowU + spanMinX * pSetup->StepXU);
+        int32_t v = (int32_t)(rowV + spanMinX * pSetup->StepXV);
+
+        uint32_t* pDest = pBuffer + (size_t)y * pitch + spanMinX;
+        for (uint_t i = 0; i < count; i += SPAN_CHUNK_SIZE)
+        {
+            const uint_t chunkSize = MIN(count - i, SPAN_CHUNK_SIZE);
+            sampleSpan(texels, chunkSize, u, v, stepU, stepV, pSetup);
+            BlendSpan(pDest + i, texels, chunkSize, pSetup->BlendMode);
+
+            u += stepU * SPAN_CHUNK_SIZE;
+            v += stepV * SPAN_CHUNK_SIZE;
+        }
+    }
+}
\ No newline at end of file
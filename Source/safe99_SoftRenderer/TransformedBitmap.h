@@ -0,0 +1,47 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 아핀 변환한 비트맵을 화면 픽셀 중심에서 역변환해 샘플링하는 커널
+// 비트맵 좌표는 16.16 고정소수점, 픽셀 (x, y)의 좌표는 정수 연산으로 구하므로 시저로 나눠 그려도 결과가 같음
+// 행마다 좌표가 비트맵 안에 드는 구간을 정확히 구해서 그 픽셀만 방문
+
+#ifndef SAFE99_TRANSFORMED_BITMAP_H
+#define SAFE99_TRANSFORMED_BITMAP_H
+
+#define TRANSFORMED_BITMAP_FRAC_BITS 16
+
+// 비트맵의 너비와 높이는 이 미만 (16.16 좌표가 int32에 들어감)
+#define MAX_TRANSFORMED_BITMAP_SIZE 32768
+
+typedef struct TRANSFORMED_BITMAP_SETUP
+{
+    // 변환한 사각형의 바운딩 박스와 화면의 교집합 (픽셀 단위, 포함)
+    int             MinX;
+    int             MinY;
+    int             MaxX;
+    int             MaxY;
+
+    const uint32_t* pBitmap;
+    uint_t          Width;
+    uint_t          Height;
+    bool            bBilinear;
+    BLEND_MODE      BlendMode;
+
+    // 픽셀 (x, y) 중심의 비트맵 좌표 = Origin + x * StepX + y * StepY
+    int64_t         OriginU;
+    int64_t         OriginV;
+    int64_t         StepXU;
+    int64_t         StepXV;
+    int64_t         StepYU;
+    int64_t         StepYV;
+} TRANSFORMED_BITMAP_SETUP;
+
+// 역변환할 수 없거나 화면에 보이는 픽셀이 없으면 false, TEXTURE_FILTER_TRILINEAR는 바이리니어로 샘플링
+bool    __stdcall   SetupTransformedBitmap(TRANSFORMED_BITMAP_SETUP* pOutSetup, const CLIP_RECT* pScreenRect,
+                                           const uint_t width, const uint_t height, const void* pBitmap,
+                                           const AFFINE_TRANSFORM* pTransform, const TEXTURE_FILTER filter, const BLEND_MODE blendMode);
+
+void    __stdcall   RasterizeTransformedBitmap(uint32_t* pBuffer, const uint_t pitch, const CLIP_RECT* pScissor,
+                                               const TRANSFORMED_BITMAP_SETUP* pSetup);
+
+#endif // SAFE99_TRANSFORMED_BITMAP_H
\ No newline at end of file
@@ -0,0 +1,469 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Common/Util/MipMap.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Raster.h"
+#include "Triangle.h"
+#include "TriangleKernels.h"
+
+// 엣지 함수 계수 = (a.y - b.y, b.x - a.x)
+// 화면 좌표계(y 아래 방향)에서 위쪽 수평 엣지 또는 왼쪽 엣지면 true
+static bool isTopLeftEdge(const int stepX, const int stepY)
+{
+    return (stepX > 0) || (stepX == 0 && stepY > 0);
+}
+
+static bool isInRasterRange(const float value)
+{
+    return value >= -(float)MAX_RASTER_COORD && value < (float)MAX_RASTER_COORD;
+}
+
+// 스냅된 정점 위치 기준으로 속성 평면 방정식을 구하기 위한 값
+typedef struct PLANE_BASIS
+{
+    float   Dx1;
+    float   Dy1;
+    float   Dx2;
+    float   Dy2;
+    float   InverseArea;
+
+    // (MinX, MinY) 픽셀 중심 - 0번 정점
+    float   OriginX;
+    float   OriginY;
+} PLANE_BASIS;
+
+// 엣지 함수와 바운딩 박스를 구함, 삼각형이 시계 방향이 되도록 pOutOrder에 정점 순서를 저장
+static bool setupEdges(TRIANGLE_SETUP* pOutSetup,
+                       const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
+                       const float positions[3][2], int pOutOrder[3], PLANE_BASIS* pOutBasis)
+{
+    int xs[3];
+    int ys[3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        // NaN도 여기서 걸러짐
+        if (!isInRasterRange(positions[i][0]) || !isInRasterRange(positions[i][1]))
+        {
+            return false;
+        }
+
+        xs[i] = ROUND_INT(positions[i][0] * SUBPIXEL_ONE);
+        ys[i] = ROUND_INT(positions[i][1] * SUBPIXEL_ONE);
+        pOutOrder[i] = (int)i;
+    }
+
+    int64_t area2 = (int64_t)(xs[1] - xs[0]) * (ys[2] - ys[0]) - (int64_t)(ys[1] - ys[0]) * (xs[2] - xs[0]);
+    if (area2 == 0)
+    {
+        return false;
+    }
+
+    // 항상 시계 방향(화면 기준)이 되도록 정렬
+    if (area2 < 0)
+    {
+        pOutOrder[1] = 2;
+        pOutOrder[2] = 1;
+
+        int temp = xs[1];
+        xs[1] = xs[2];
+        xs[2] = temp;
+
+        temp = ys[1];
+        ys[1] = ys[2];
+        ys[2] = temp;
+
+        area2 = -area2;
+    }
+
+    // 픽셀 중심이 삼각형 바운딩 박스 안에 있는 픽셀만
+    const int minXFixed = MIN(MIN(xs[0], xs[1]), xs[2]);
+    const int minYFixed = MIN(MIN(ys[0], ys[1]), ys[2]);
+    const int maxXFixed = MAX(MAX(xs[0], xs[1]), xs[2]);
+    const int maxYFixed = MAX(MAX(ys[0], ys[1]), ys[2]);
+
+    pOutSetup->MinX = MAX((minXFixed + SUBPIXEL_ONE / 2 - 1) >> SUBPIXEL_BITS, topLeftX);
+    pOutSetup->MinY = MAX((minYFixed + SUBPIXEL_ONE / 2 - 1) >> SUBPIXEL_BITS, topLeftY);
+    pOutSetup->MaxX = MIN((maxXFixed - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS, bottomRightX);
+    pOutSetup->MaxY = MIN((maxYFixed - SUBPIXEL_ONE / 2) >> SUBPIXEL_BITS, bottomRightY);
+    if (pOutSetup->MinX > pOutSetup->MaxX
+        || pOutSetup->MinY > pOutSetup->MaxY)
+    {
+        return false;
+    }
+
+    // 픽셀 중심 p에서 E(p) = A * (16 * px + 8 - ax) + B * (16 * py + 8 - ay) 이고
+    // E(p) - bias >= 0 <=> A * px + B * py + floor((A * (8 - ax) + B * (8 - ay) - bias) / 16) >= 0
+    // 서브픽셀 비트만큼 줄인 값을 저장해서 int32로 픽셀 단위 증분이 가능하게 함
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const size_t a = (i + 1) % 3;
+        const size_t b = (i + 2) % 3;
+
+        const int stepX = ys[a] - ys[b];
+        const int stepY = xs[b] - xs[a];
+        const int bias = isTopLeftEdge(stepX, stepY) ? 0 : 1;
+
+        const int64_t offset = (int64_t)stepX * (SUBPIXEL_ONE / 2 - xs[a])
+            + (int64_t)stepY * (SUBPIXEL_ONE / 2 - ys[a])
+            - bias;
+        const int64_t edge = (int64_t)stepX * pOutSetup->MinX + (int64_t)stepY * pOutSetup->MinY + (offset >> SUBPIXEL_BITS);
+        ASSERT(edge >= INT_MIN && edge <= INT_MAX, "Edge function overflow");
+
+        pOutSetup->Edges[i] = (int)edge;
+        pOutSetup->EdgeStepsX[i] = stepX;
+        pOutSetup->EdgeStepsY[i] = stepY;
+    }
+
+    const float x0 = (float)xs[0] / SUBPIXEL_ONE;
+    const float y0 = (float)ys[0] / SUBPIXEL_ONE;
+    pOutBasis->Dx1 = (float)(xs[1] - xs[0]) / SUBPIXEL_ONE;
+    pOutBasis->Dy1 = (float)(ys[1] - ys[0]) / SUBPIXEL_ONE;
+    pOutBasis->Dx2 = (float)(xs[2] - xs[0]) / SUBPIXEL_ONE;
+    pOutBasis->Dy2 = (float)(ys[2] - ys[0]) / SUBPIXEL_ONE;
+    pOutBasis->InverseArea = (float)(SUBPIXEL_ONE * SUBPIXEL_ONE) / (float)area2;
+    pOutBasis->OriginX = (float)pOutSetup->MinX + 0.5f - x0;
+    pOutBasis->OriginY = (float)pOutSetup->MinY + 0.5f - y0;
+
+    return true;
+}
+
+// 정점 속성 a0, a1, a2로 (MinX, MinY) 픽셀 중심에서의 값과 기울기를 구함
+static void setupPlane(const PLANE_BASIS* pBasis, const float a0, const float a1, const float a2,
+                       float* pOutValue, float* pOutStepX, float* pOutStepY)
+{
+    const float da1 = a1 - a0;
+    const float da2 = a2 - a0;
+
+    const float stepX = (da1 * pBasis->Dy2 - da2 * pBasis->Dy1) * pBasis->InverseArea;
+    const float stepY = (da2 * pBasis->Dx1 - da1 * pBasis->Dx2) * pBasis->InverseArea;
+
+    *pOutValue = a0 + stepX * pBasis->OriginX + stepY * pBasis->OriginY;
+    *pOutStepX = stepX;
+    *pOutStepY = stepY;
+}
+
+static void setupDepth(TRIANGLE_SETUP* pOutSetup, const PLANE_BASIS* pBasis, const float z0, const float z1, const float z2)
+{
+    setupPlane(pBasis, z0, z1, z2, &pOutSetup->Depth, &pOutSetup->DepthStepX, &pOutSetup->DepthStepY);
+    pOutSetup->MinDepth = MIN(MIN(z0, z1), z2);
+    pOutSetup->MaxDepth = MAX(MAX(z0, z1), z2);
+}
+
+bool __stdcall SetupTriangle(TRIANGLE_SETUP* pOutSetup,
+                             const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
+                             const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2)
+{
+    ASSERT(pOutSetup != NULL, "pOutSetup is NULL");
+    ASSERT(pV0 != NULL, "pV0 is NULL");
+    ASSERT(pV1 != NULL, "pV1 is NULL");
+    ASSERT(pV2 != NULL, "pV2 is NULL");
+
+    const float positions[3][2] = { { pV0->X, pV0->Y }, { pV1->X, pV1->Y }, { pV2->X, pV2->Y } };
+    int order[3];
+    PLANE_BASIS basis;
+    if (!setupEdges(pOutSetup, topLeftX, topLeftY, bottomRightX, bottomRightY, positions, order, &basis))
+    {
+        return false;
+    }
+
+    const COLOR_VERTEX* pInputVertices[3] = { pV0, pV1, pV2 };
+    const COLOR_VERTEX* pVertices[3] = { pInputVertices[order[0]], pInputVertices[order[1]], pInputVertices[order[2]] };
+
+    setupDepth(pOutSetup, &basis, pVertices[0]->Z, pVertices[1]->Z, pVertices[2]->Z);
+
+    pOutSetup->pTexels = NULL;
+    pOutSetup->bFlatColor = (pVertices[0]->Argb == pVertices[1]->Argb && pVertices[0]->Argb == pVertices[2]->Argb);
+    pOutSetup->FlatArgb = pVertices[0]->Argb;
+    if (pOutSetup->bFlatColor)
+    {
+        memset(pOutSetup->Colors, 0, sizeof(pOutSetup->Colors));
+        memset(pOutSetup->ColorStepsX, 0, sizeof(pOutSetup->ColorStepsX));
+        memset(pOutSetup->ColorStepsY, 0, sizeof(pOutSetup->ColorStepsY));
+        return true;
+    }
+
+    for (size_t i = 0; i < NUM_COLOR_CHANNELS; ++i)
+    {
+        const int shift = 24 - 8 * (int)i;
+        setupPlane(&basis,
+                   (float)((pVertices[0]->Argb >> shift) & 0xff),
+                   (float)((pVertices[1]->Argb >> shift) & 0xff),
+                   (float)((pVertices[2]->Argb >> shift) & 0xff),
+                   &pOutSetup->Colors[i], &pOutSetup->ColorStepsX[i], &pOutSetup->ColorStepsY[i]);
+    }
+
+    return true;
+}
+
+bool __stdcall SetupTexturedTriangle(TRIANGLE_SETUP* pOutSetup,
+                                     const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
+                                     const TEXTURE* pTexture, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address,
+                                     const TEXTURE_VERTEX* pV0, const TEXTURE_VERTEX* pV1, const TEXTURE_VERTEX* pV2)
+{
+    ASSERT(pOutSetup != NULL, "pOutSetup is NULL");
+    ASSERT(pTexture != NULL, "pTexture is NULL");
+    ASSERT(pTexture->pBitmap != NULL, "pTexture->pBitmap is NULL");
+    ASSERT(pV0 != NULL, "pV0 is NULL");
+    ASSERT(pV1 != NULL, "pV1 is NULL");
+    ASSERT(pV2 != NULL, "pV2 is NULL");
+
+    if (pTexture->Width == 0 || pTexture->Height == 0)
+    {
+        return false;
+    }
+
+    const float positions[3][2] = { { pV0->X, pV0->Y }, { pV1->X, pV1->Y }, { pV2->X, pV2->Y } };
+    int order[3];
+    PLANE_BASIS basis;
+    if (!setupEdges(pOutSetup, topLeftX, topLeftY, bottomRightX, bottomRightY, positions, order, &basis))
+    {
+        return false;
+    }
+
+    const TEXTURE_VERTEX* pInputVertices[3] = { pV0, pV1, pV2 };
+    const TEXTURE_VERTEX* pVertices[3] = { pInputVertices[order[0]], pInputVertices[order[1]], pInputVertices[order[2]] };
+
+    setupDepth(pOutSetup, &basis, pVertices[0]->Z, pVertices[1]->Z, pVertices[2]->Z);
+
+    pOutSetup->pTexels = (const uint32_t*)pTexture->pBitmap;
+    pOutSetup->TextureWidth = (int)pTexture->Width;
+    pOutSetup->TextureHeight = (int)pTexture->Height;
+    pOutSetup->TextureNumMipLevels = (int)MIN(MAX(pTexture->NumMipLevels, 1), GetNumMipLevels(pTexture->Width, pTexture->Height));
+    pOutSetup->TextureFilter = filter;
+    pOutSetup->TextureAddress = address;
+    pOutSetup->bFlatColor = false;
+
+    // 화면 공간에서 선형인 u/w, v/w, 1/w를 보간
+    setupPlane(&basis,
+               pVertices[0]->U * pVertices[0]->Rhw, pVertices[1]->U * pVertices[1]->Rhw, pVertices[2]->U * pVertices[2]->Rhw,
+               &pOutSetup->Perspective[PERSPECTIVE_U], &pOutSetup->PerspectiveStepsX[PERSPECTIVE_U], &pOutSetup->PerspectiveStepsY[PERSPECTIVE_U]);
+    setupPlane(&basis,
+               pVertices[0]->V * pVertices[0]->Rhw, pVertices[1]->V * pVertices[1]->Rhw, pVertices[2]->V * pVertices[2]->Rhw,
+               &pOutSetup->Perspective[PERSPECTIVE_V], &pOutSetup->PerspectiveStepsX[PERSPECTIVE_V], &pOutSetup->PerspectiveStepsY[PERSPECTIVE_V]);
+    setupPlane(&basis,
+               pVertices[0]->Rhw, pVertices[1]->Rhw, pVertices[2]->Rhw,
+               &pOutSetup->Perspective[PERSPECTIVE_Q], &pOutSetup->PerspectiveStepsX[PERSPECTIVE_Q], &pOutSetup->PerspectiveStepsY[PERSPECTIVE_Q]);
+
+    return true;
+}
+
+bool __stdcall IsTriangleOutsideRect(const TRIANGLE_SETUP* pSetup, const CLIP_RECT* pRect)
+{
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+    ASSERT(pRect != NULL, "pRect is NULL");
+
+    // 각 엣지 함수가 가장 큰 모서리에서도 음수면 영역 전체가 바깥
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const int cornerX = (pSetup->EdgeStepsX[i] > 0) ? pRect->MaxX : pRect->MinX;
+        const int cornerY = (pSetup->EdgeStepsY[i] > 0) ? pRect->MaxY : pRect->MinY;
+        const int64_t edge = (int64_t)pSetup->Edges[i]
+            + (int64_t)pSetup->EdgeStepsX[i] * (cornerX - pSetup->MinX)
+            + (int64_t)pSetup->EdgeStepsY[i] * (cornerY - pSetup->MinY);
+        if (edge < 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// 평면 방정식 계산 오차를 덮기 위한 여유
+#define HIZ_EPSILON 1.0e-5f
+
+// pRect 안에서 삼각형 깊이의 보수적인 범위
+static void getDepthRange(const TRIANGLE_SETUP* pSetup, const CLIP_RECT* pRect, float* pOutMinDepth, float* pOutMaxDepth)
+{
+    const float topDepth = pSetup->Depth + pSetup->DepthStepY * (float)(pRect->MinY - pSetup->MinY);
+    const float bottomDepth = pSetup->Depth + pSetup->DepthStepY * (float)(pRect->MaxY - pSetup->MinY);
+    const float leftStep = pSetup->DepthStepX * (float)(pRect->MinX - pSetup->MinX);
+    const float rightStep = pSetup->DepthStepX * (float)(pRect->MaxX - pSetup->MinX);
+
+    const float minDepth = MIN(topDepth, bottomDepth) + MIN(leftStep, rightStep);
+    const float maxDepth = MAX(topDepth, bottomDepth) + MAX(leftStep, rightStep);
+
+    *pOutMinDepth = MAX(minDepth, pSetup->MinDepth) - HIZ_EPSILON;
+    *pOutMaxDepth = MIN(maxDepth, pSetup->MaxDepth) + HIZ_EPSILON;
+}
+
+// 블록 안의 모든 픽셀이 깊이 테스트를 통과하면 true
+static bool isDepthAlwaysLess(const DEPTH_FORMAT format, const float maxDepth, const float hiZMinDepth)
+{
+    if (format == DEPTH_FORMAT_D24_UNORM)
+    {
+        return EncodeDepth(format, maxDepth) < EncodeDepth(format, hiZMinDepth);
+    }
+
+    return maxDepth < hiZMinDepth;
+}
+
+// 블록에서 보이는 픽셀이 모두 삼각형 안이면 어떤 픽셀도 삼각형의 최대 깊이보다 멀 수 없음
+void __stdcall UpdateHiZBlock(HIZ_BLOCK* pHiZBlock, const int numCovered, const int numVisible,
+                              const float minDepth, const float maxDepth)
+{
+    ASSERT(pHiZBlock != NULL, "pHiZBlock is NULL");
+
+    if (numCovered == 0)
+    {
+        return;
+    }
+
+    pHiZBlock->MinDepth = MIN(pHiZBlock->MinDepth, minDepth);
+    if (numCovered == numVisible)
+    {
+        pHiZBlock->MaxDepth = MIN(pHiZBlock->MaxDepth, maxDepth);
+    }
+}
+
+bool __stdcall TestHiZBlock(const TRIANGLE_SETUP* pSetup, DEPTH_BUFFER* pDepthBuffer, const int blockX, const int blockY,
+                            const CLIP_RECT* pBlockRect, HIZ_BLOCK** ppOutHiZBlock, bool* pOutDepthTest,
+                            float* pOutMinDepth, float* pOutMaxDepth)
+{
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+    ASSERT(pBlockRect != NULL, "pBlockRect is NULL");
+
+    *ppOutHiZBlock = NULL;
+    *pOutDepthTest = false;
+    if (pDepthBuffer == NULL)
+    {
+        return true;
+    }
+
+    HIZ_BLOCK* pHiZBlock = pDepthBuffer->pHiZBlocks
+        + (blockY / HIZ_BLOCK_SIZE) * pDepthBuffer->NumBlocksX + blockX / HIZ_BLOCK_SIZE;
+
+    getDepthRange(pSetup, pBlockRect, pOutMinDepth, pOutMaxDepth);
+    if (*pOutMinDepth >= pHiZBlock->MaxDepth)
+    {
+        return false;
+    }
+
+    *ppOutHiZBlock = pHiZBlock;
+    *pOutDepthTest = !isDepthAlwaysLess(pDepthBuffer->Format, *pOutMaxDepth, pHiZBlock->MinDepth);
+    return true;
+}
+
+int __stdcall GetRectArea(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1)
+{
+    ASSERT(pRect0 != NULL, "pRect0 is NULL");
+    ASSERT(pRect1 != NULL, "pRect1 is NULL");
+
+    CLIP_RECT rect;
+    if (!IntersectClipRect(pRect0, pRect1, &rect))
+    {
+        return 0;
+    }
+
+    return (rect.MaxX - rect.MinX + 1) * (rect.MaxY - rect.MinY + 1);
+}
+
+// 지수 비트와 선형 근사한 가수로 구한 log2(x), 오차는 0.09 미만
+static float approximateLog2(const float x)
+{
+    int32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (float)bits * (1.0f / (float)(1 << 23)) - 127.0f;
+}
+
+static void getTextureLevel(const TRIANGLE_SETUP* pSetup, const int level, TEXTURE_LEVEL* pOutLevel)
+{
+    pOutLevel->pTexels = pSetup->pTexels + GetMipLevelOffset(pSetup->TextureWidth, pSetup->TextureHeight, level);
+    pOutLevel->Width = MAX(pSetup->TextureWidth >> level, 1);
+    pOutLevel->Height = MAX(pSetup->TextureHeight >> level, 1);
+}
+
+// (x, y)에서 원근 보정한 텍스처 좌표
+static void getPerspectiveUV(const TRIANGLE_SETUP* pSetup, const float x, const float y, float* pOutU, float* pOutV)
+{
+    float values[NUM_PERSPECTIVE_ATTRIBUTES];
+    for (size_t i = 0; i < NUM_PERSPECTIVE_ATTRIBUTES; ++i)
+    {
+        values[i] = pSetup->Perspective[i] + pSetup->PerspectiveStepsY[i] * y + pSetup->PerspectiveStepsX[i] * x;
+    }
+
+    const float w = 1.0f / values[PERSPECTIVE_Q];
+    *pOutU = values[PERSPECTIVE_U] * w;
+    *pOutV = values[PERSPECTIVE_V] * w;
+}
+
+// 밉맵이 있으면 시작 픽셀의 x, y 방향 텍셀 변화량으로 LOD를 구함
+void __stdcall GetTextureSpan(const TRIANGLE_SETUP* pSetup, const int offsetX, const int offsetY, TEXTURE_SPAN* pOutSpan)
+{
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+    ASSERT(pOutSpan != NULL, "pOutSpan is NULL");
+
+    float u1;
+    float v1;
+    getPerspectiveUV(pSetup, (float)offsetX, (float)offsetY, &pOutSpan->StartU, &pOutSpan->StartV);
+    getPerspectiveUV(pSetup, (float)(offsetX + HIZ_BLOCK_SIZE), (float)offsetY, &u1, &v1);
+
+    pOutSpan->StepU = (u1 - pOutSpan->StartU) * (1.0f / HIZ_BLOCK_SIZE);
+    pOutSpan->StepV = (v1 - pOutSpan->StartV) * (1.0f / HIZ_BLOCK_SIZE);
+    pOutSpan->LevelWeight = 0;
+
+    if (pSetup->TextureNumMipLevels <= 1)
+    {
+        getTextureLevel(pSetup, 0, &pOutSpan->Levels[0]);
+        return;
+    }
+
+    float nextRowU;
+    float nextRowV;
+    getPerspectiveUV(pSetup, (float)offsetX, (float)(offsetY + 1), &nextRowU, &nextRowV);
+
+    const float width = (float)pSetup->TextureWidth;
+    const float height = (float)pSetup->TextureHeight;
+    const float dudx = pOutSpan->StepU * width;
+    const float dvdx = pOutSpan->StepV * height;
+    const float dudy = (nextRowU - pOutSpan->StartU) * width;
+    const float dvdy = (nextRowV - pOutSpan->StartV) * height;
+    const float lengthSq = MAX(dudx * dudx + dvdx * dvdx, dudy * dudy + dvdy * dvdy);
+
+    const int maxLevel = pSetup->TextureNumMipLevels - 1;
+    const float lod = MIN(MAX(0.5f * approximateLog2(lengthSq), 0.0f), (float)maxLevel);
+    if (pSetup->TextureFilter != TEXTURE_FILTER_TRILINEAR)
+    {
+        getTextureLevel(pSetup, (int)(lod + 0.5f), &pOutSpan->Levels[0]);
+        return;
+    }
+
+    const int level = (int)lod;
+    getTextureLevel(pSetup, level, &pOutSpan->Levels[0]);
+    if (level < maxLevel)
+    {
+        getTextureLevel(pSetup, level + 1, &pOutSpan->Levels[1]);
+        pOutSpan->LevelWeight = (int)((lod - (float)level) * 256.0f);
+    }
+}
+
+void __stdcall RasterizeTriangle(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup, const CLIP_RECT* pClipRect,
+                                 DEPTH_BUFFER* pDepthBuffer)
+{
+    ASSERT(pBuffer != NULL, "pBuffer is NULL");
+    ASSERT(pSetup != NULL, "pSetup is NULL");
+    ASSERT(pClipRect != NULL, "pClipRect is NULL");
+
+    const CLIP_RECT bounds = { pSetup->MinX, pSetup->MinY, pSetup->MaxX, pSetup->MaxY };
+    CLIP_RECT rect;
+    if (!IntersectClipRect(&bounds, pClipRect, &rect))
+    {
+        return;
+    }
+
+    // SelectSpanKernels가 CPU 지원을 확인한 단계를 따름, AVX-512도 AVX2 커널을 씀
+    if (GetSelectedSimdLevel() >= SIMD_LEVEL_AVX2)
+    {
+        RasterizeTriangleAVX2(pBuffer, pitch, pSetup, &rect, pClipRect, pDepthBuffer);
+    }
+    else
+    {
+        RasterizeTriangleSSE(pBuffer, pitch, pSetup, &rect, pClipRect, pDepthBuffer);
+    }
+}
\ No newline at end of file
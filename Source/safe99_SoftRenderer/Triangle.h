@@ -0,0 +1,94 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 엣지 함수(half-space) 기반 삼각형 래스터라이저
+
+#ifndef SAFE99_TRIANGLE_H
+#define SAFE99_TRIANGLE_H
+
+#define SUBPIXEL_BITS       4
+#define SUBPIXEL_ONE        (1 << SUBPIXEL_BITS)
+
+// 엣지 함수가 int32 범위를 넘지 않도록 정점 좌표를 [-MAX_RASTER_COORD, MAX_RASTER_COORD)로 제한
+#define MAX_RASTER_COORD    4096
+
+typedef enum COLOR_CHANNEL
+{
+    COLOR_CHANNEL_A,
+    COLOR_CHANNEL_R,
+    COLOR_CHANNEL_G,
+    COLOR_CHANNEL_B,
+    NUM_COLOR_CHANNELS
+} COLOR_CHANNEL;
+
+// 화면 공간에서 선형인 u/w, v/w, 1/w
+typedef enum PERSPECTIVE_ATTRIBUTE
+{
+    PERSPECTIVE_U,
+    PERSPECTIVE_V,
+    PERSPECTIVE_Q,
+    NUM_PERSPECTIVE_ATTRIBUTES
+} PERSPECTIVE_ATTRIBUTE;
+
+typedef struct TRIANGLE_SETUP
+{
+    // 바운딩 박스와 시저 영역의 교집합 (픽셀 단위, 포함)
+    // 아래 엣지 함수와 색상 값의 기준점이기도 함
+    int     MinX;
+    int     MinY;
+    int     MaxX;
+    int     MaxY;
+
+    // (MinX, MinY) 픽셀에서의 엣지 함수 값, 0 이상이면 내부 (top-left 규칙 포함)
+    int     Edges[3];
+    int     EdgeStepsX[3];
+    int     EdgeStepsY[3];
+
+    // (MinX, MinY) 픽셀 중심에서의 색상 채널 값과 기울기
+    float   Colors[NUM_COLOR_CHANNELS];
+    float   ColorStepsX[NUM_COLOR_CHANNELS];
+    float   ColorStepsY[NUM_COLOR_CHANNELS];
+    bool    bFlatColor;
+    uint32_t FlatArgb;
+
+    // (MinX, MinY) 픽셀 중심에서의 깊이와 기울기, 정점 깊이의 범위
+    float   Depth;
+    float   DepthStepX;
+    float   DepthStepY;
+    float   MinDepth;
+    float   MaxDepth;
+
+    // NULL이 아니면 색상 대신 텍스처를 샘플링, 텍셀은 Flush 전까지 유효해야 함
+    // pTexels는 0번 레벨부터 TextureNumMipLevels개 레벨이 연속된 밉 체인
+    const uint32_t* pTexels;
+    int             TextureWidth;
+    int             TextureHeight;
+    int             TextureNumMipLevels;
+    TEXTURE_FILTER  TextureFilter;
+    TEXTURE_ADDRESS TextureAddress;
+
+    // (MinX, MinY) 픽셀 중심에서의 원근 보간 속성과 기울기
+    float   Perspective[NUM_PERSPECTIVE_ATTRIBUTES];
+    float   PerspectiveStepsX[NUM_PERSPECTIVE_ATTRIBUTES];
+    float   PerspectiveStepsY[NUM_PERSPECTIVE_ATTRIBUTES];
+} TRIANGLE_SETUP;
+
+// 그릴 픽셀이 있다면 true, 아니라면 false
+bool    __stdcall   SetupTriangle(TRIANGLE_SETUP* pOutSetup,
+                                  const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
+                                  const COLOR_VERTEX* pV0, const COLOR_VERTEX* pV1, const COLOR_VERTEX* pV2);
+bool    __stdcall   SetupTexturedTriangle(TRIANGLE_SETUP* pOutSetup,
+                                          const int topLeftX, const int topLeftY, const int bottomRightX, const int bottomRightY,
+                                          const TEXTURE* pTexture, const TEXTURE_FILTER filter, const TEXTURE_ADDRESS address,
+                                          const TEXTURE_VERTEX* pV0, const TEXTURE_VERTEX* pV1, const TEXTURE_VERTEX* pV2);
+
+// pRect 안의 모든 픽셀이 삼각형 바깥이면 true (보수적)
+bool    __stdcall   IsTriangleOutsideRect(const TRIANGLE_SETUP* pSetup, const CLIP_RECT* pRect);
+
+// HIZ_BLOCK_SIZE 블록 단위로 순회, pDepthBuffer가 NULL이 아니면 깊이 테스트
+// 텍스처 좌표는 블록 한 행의 양 끝에서만 원근 보정하고 그 사이는 선형 보간, 밉 레벨도 블록 한 행마다 선택
+// 색상과 깊이는 누적하지 않고 기준점에서 직접 계산하므로 pClipRect와 상관없이 같은 픽셀은 같은 값이 됨
+void    __stdcall   RasterizeTriangle(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup, const CLIP_RECT* pClipRect,
+                                      DEPTH_BUFFER* pDepthBuffer);
+
+#endif // SAFE99_TRIANGLE_H
\ No newline at end of file
@@ -0,0 +1,291 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// AVX2 삼각형 커널, 블록 한 행 8픽셀의 커버리지를 한 번에 구하고 텍셀은 vpgatherdd로 모음
+// 다른 파일에 AVX2 코드가 섞이지 않도록 include 뒤에서만 대상 명령어 집합을 바꿈
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Triangle.h"
+#include "TriangleKernels.h"
+
+// MSVC는 /arch 옵션 없이도 내장 함수를 쓸 수 있음
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC target("avx2")
+#endif // __clang__
+
+// coord는 내림된 텍셀 좌표, 결과는 항상 [0, size)
+static __m256i __vectorcall addressTexelsAVX2(const __m256 coord, const int size, const TEXTURE_ADDRESS address)
+{
+    const __m256i sizeI = _mm256_set1_epi32(size);
+    const __m256i maxI = _mm256_set1_epi32(size - 1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i texel;
+    if (address == TEXTURE_ADDRESS_WRAP)
+    {
+        const __m256 sizeF = _mm256_set1_ps((float)size);
+        const __m256 wrapped = _mm256_sub_ps(coord, _mm256_mul_ps(sizeF, _mm256_floor_ps(_mm256_mul_ps(coord, _mm256_set1_ps(1.0f / (float)size)))));
+        texel = _mm256_cvtps_epi32(wrapped);
+
+        // 나눗셈 대신 역수를 곱해서 생긴 오차 보정
+        texel = _mm256_sub_epi32(texel, _mm256_and_si256(_mm256_cmpgt_epi32(texel, maxI), sizeI));
+        texel = _mm256_add_epi32(texel, _mm256_and_si256(_mm256_cmpgt_epi32(zero, texel), sizeI));
+    }
+    else
+    {
+        texel = _mm256_cvtps_epi32(coord);
+    }
+
+    // 범위를 넘는 좌표나 NaN도 텍스처 밖을 읽지 않도록 자름
+    return _mm256_min_epi32(_mm256_max_epi32(texel, zero), maxI);
+}
+
+// weight는 [0, 256], t0 * (256 - weight) + t1 * weight를 채널별로 계산
+static __m256i __vectorcall lerpTexelsAVX2(const __m256i t0, const __m256i t1, const __m256i weight)
+{
+    const __m256i mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i weight1 = _mm256_or_si256(weight, _mm256_slli_epi32(weight, 16));
+    const __m256i weight0 = _mm256_sub_epi16(_mm256_set1_epi32(0x01000100), weight1);
+
+    const __m256i rb = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(t0, mask), weight0),
+                                        _mm256_mullo_epi16(_mm256_and_si256(t1, mask), weight1));
+    const __m256i ag = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi32(t0, 8), mask), weight0),
+                                        _mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi32(t1, 8), mask), weight1));
+
+    return _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(rb, 8), mask), _mm256_andnot_si256(mask, ag));
+}
+
+static __m256i __vectorcall sampleTextureLevelAVX2(const TEXTURE_LEVEL* pLevel, const bool bBilinear, const TEXTURE_ADDRESS address,
+                                                   const __m256 u, const __m256 v)
+{
+    const int* pTexels = (const int*)pLevel->pTexels;
+    const __m256i width = _mm256_set1_epi32(pLevel->Width);
+    const __m256 texelU = _mm256_mul_ps(u, _mm256_set1_ps((float)pLevel->Width));
+    const __m256 texelV = _mm256_mul_ps(v, _mm256_set1_ps((float)pLevel->Height));
+
+    if (!bBilinear)
+    {
+        const __m256i x = addressTexelsAVX2(_mm256_floor_ps(texelU), pLevel->Width, address);
+        const __m256i y = addressTexelsAVX2(_mm256_floor_ps(texelV), pLevel->Height, address);
+        return _mm256_i32gather_epi32(pTexels, _mm256_add_epi32(_mm256_mullo_epi32(y, width), x), 4);
+    }
+
+    // 텍셀 중심 기준으로 주변 4개를 보간
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(256.0f);
+    const __m256 centerU = _mm256_sub_ps(texelU, half);
+    const __m256 centerV = _mm256_sub_ps(texelV, half);
+    const __m256 floorU = _mm256_floor_ps(centerU);
+    const __m256 floorV = _mm256_floor_ps(centerV);
+    const __m256i weightU = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(centerU, floorU), scale));
+    const __m256i weightV = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(centerV, floorV), scale));
+
+    const __m256i x0 = addressTexelsAVX2(floorU, pLevel->Width, address);
+    const __m256i x1 = addressTexelsAVX2(_mm256_add_ps(floorU, one), pLevel->Width, address);
+    const __m256i row0 = _mm256_mullo_epi32(addressTexelsAVX2(floorV, pLevel->Height, address), width);
+    const __m256i row1 = _mm256_mullo_epi32(addressTexelsAVX2(_mm256_add_ps(floorV, one), pLevel->Height, address), width);
+
+    const __m256i t00 = _mm256_i32gather_epi32(pTexels, _mm256_add_epi32(row0, x0), 4);
+    const __m256i t10 = _mm256_i32gather_epi32(pTexels, _mm256_add_epi32(row0, x1), 4);
+    const __m256i t01 = _mm256_i32gather_epi32(pTexels, _mm256_add_epi32(row1, x0), 4);
+    const __m256i t11 = _mm256_i32gather_epi32(pTexels, _mm256_add_epi32(row1, x1), 4);
+
+    return lerpTexelsAVX2(lerpTexelsAVX2(t00, t10, weightU), lerpTexelsAVX2(t01, t11, weightU), weightV);
+}
+
+static __m256i __vectorcall sampleTextureAVX2(const TRIANGLE_SETUP* pSetup, const TEXTURE_SPAN* pSpan, const __m256 u, const __m256 v)
+{
+    const bool bBilinear = (pSetup->TextureFilter != TEXTURE_FILTER_POINT);
+    const __m256i texels = sampleTextureLevelAVX2(&pSpan->Levels[0], bBilinear, pSetup->TextureAddress, u, v);
+    if (pSpan->LevelWeight == 0)
+    {
+        return texels;
+    }
+
+    return lerpTexelsAVX2(texels, sampleTextureLevelAVX2(&pSpan->Levels[1], bBilinear, pSetup->TextureAddress, u, v),
+                          _mm256_set1_epi32(pSpan->LevelWeight));
+}
+
+static __m256i __vectorcall packColorsAVX2(const __m256 a, const __m256 r, const __m256 g, const __m256 b)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 max = _mm256_set1_ps(255.0f);
+
+    const __m256i ai = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(a, zero), max));
+    const __m256i ri = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(r, zero), max));
+    const __m256i gi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(g, zero), max));
+    const __m256i bi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(b, zero), max));
+
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(ai, 24), _mm256_slli_epi32(ri, 16)),
+                           _mm256_or_si256(_mm256_slli_epi32(gi, 8), bi));
+}
+
+static void __vectorcall storeMaskedAVX2(__m256i* pDest, const __m256i value, const __m256i mask)
+{
+    if (_mm256_movemask_epi8(mask) == -1)
+    {
+        _mm256_store_si256(pDest, value);
+    }
+    else
+    {
+        _mm256_store_si256(pDest, _mm256_blendv_epi8(_mm256_load_si256(pDest), value, mask));
+    }
+}
+
+// 블록의 한 행(8픽셀)을 한 번에 처리, 블록은 8픽셀 경계에 맞으므로 정렬된 저장을 사용
+void __stdcall RasterizeTriangleAVX2(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup,
+                                     const CLIP_RECT* pRect, const CLIP_RECT* pClipRect, DEPTH_BUFFER* pDepthBuffer)
+{
+    const __m256i laneOffsets = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256 laneOffsetsF = _mm256_cvtepi32_ps(laneOffsets);
+
+    __m256i laneEdgeSteps[3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        laneEdgeSteps[i] = _mm256_mullo_epi32(_mm256_set1_epi32(pSetup->EdgeStepsX[i]), laneOffsets);
+    }
+
+    __m256 colorStepsX[NUM_COLOR_CHANNELS];
+    for (size_t i = 0; i < NUM_COLOR_CHANNELS; ++i)
+    {
+        colorStepsX[i] = _mm256_set1_ps(pSetup->ColorStepsX[i]);
+    }
+
+    const __m256i flatColor = _mm256_set1_epi32((int)pSetup->FlatArgb);
+    const __m256 depthStepX = _mm256_set1_ps(pSetup->DepthStepX);
+    const __m256 depthScale = _mm256_set1_ps((float)D24_MAX_VALUE);
+    const bool bD24 = (pDepthBuffer != NULL && pDepthBuffer->Format == DEPTH_FORMAT_D24_UNORM);
+
+    for (int blockY = pRect->MinY & ~(HIZ_BLOCK_SIZE - 1); blockY <= pRect->MaxY; blockY += HIZ_BLOCK_SIZE)
+    {
+        for (int blockX = pRect->MinX & ~(HIZ_BLOCK_SIZE - 1); blockX <= pRect->MaxX; blockX += HIZ_BLOCK_SIZE)
+        {
+            const CLIP_RECT block = { blockX, blockY, blockX + HIZ_BLOCK_SIZE - 1, blockY + HIZ_BLOCK_SIZE - 1 };
+            CLIP_RECT blockRect;
+            IntersectClipRect(&block, pRect, &blockRect);
+            if (IsTriangleOutsideRect(pSetup, &blockRect))
+            {
+                continue;
+            }
+
+            HIZ_BLOCK* pHiZBlock;
+            bool bDepthTest;
+            float minDepth;
+            float maxDepth;
+            if (!TestHiZBlock(pSetup, pDepthBuffer, blockX, blockY, &blockRect, &pHiZBlock, &bDepthTest, &minDepth, &maxDepth))
+            {
+                continue;
+            }
+
+            const __m256i x = _mm256_add_epi32(_mm256_set1_epi32(blockX), laneOffsets);
+            const __m256i inRect = _mm256_and_si256(_mm256_cmpgt_epi32(x, _mm256_set1_epi32(blockRect.MinX - 1)),
+                                                    _mm256_cmpgt_epi32(_mm256_set1_epi32(blockRect.MaxX + 1), x));
+            const __m256 offsetX = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(blockX - pSetup->MinX), laneOffsets));
+
+            int rowEdges[3];
+            for (size_t i = 0; i < 3; ++i)
+            {
+                rowEdges[i] = pSetup->Edges[i]
+                    + pSetup->EdgeStepsX[i] * (blockX - pSetup->MinX)
+                    + pSetup->EdgeStepsY[i] * (blockRect.MinY - pSetup->MinY);
+            }
+
+            // 레인별 덮인 픽셀 수의 음수
+            __m256i numCovered = _mm256_setzero_si256();
+
+            uint32_t* pRow = pBuffer + blockRect.MinY * pitch + blockX;
+            uint32_t* pDepthRow = (pHiZBlock != NULL) ? (uint32_t*)pDepthBuffer->pDepths + blockRect.MinY * pitch + blockX : NULL;
+            for (int y = blockRect.MinY; y <= blockRect.MaxY; ++y)
+            {
+                const __m256i e0 = _mm256_add_epi32(_mm256_set1_epi32(rowEdges[0]), laneEdgeSteps[0]);
+                const __m256i e1 = _mm256_add_epi32(_mm256_set1_epi32(rowEdges[1]), laneEdgeSteps[1]);
+                const __m256i e2 = _mm256_add_epi32(_mm256_set1_epi32(rowEdges[2]), laneEdgeSteps[2]);
+                const __m256i inside = _mm256_srai_epi32(_mm256_or_si256(_mm256_or_si256(e0, e1), e2), 31);
+                __m256i mask = _mm256_andnot_si256(inside, inRect);
+                numCovered = _mm256_add_epi32(numCovered, mask);
+
+                const float offsetY = (float)(y - pSetup->MinY);
+                if (pDepthRow != NULL && !_mm256_testz_si256(mask, mask))
+                {
+                    const __m256 depth = _mm256_add_ps(_mm256_set1_ps(pSetup->Depth + pSetup->DepthStepY * offsetY),
+                                                       _mm256_mul_ps(depthStepX, offsetX));
+                    const __m256i depthBits = bD24
+                        ? _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(depth, _mm256_setzero_ps()), _mm256_set1_ps(1.0f)), depthScale))
+                        : _mm256_castps_si256(depth);
+
+                    __m256i* pDepthDest = (__m256i*)pDepthRow;
+                    if (bDepthTest)
+                    {
+                        const __m256i storedBits = _mm256_load_si256(pDepthDest);
+                        const __m256i pass = bD24
+                            ? _mm256_cmpgt_epi32(storedBits, depthBits)
+                            : _mm256_castps_si256(_mm256_cmp_ps(depth, _mm256_castsi256_ps(storedBits), _CMP_LT_OQ));
+                        mask = _mm256_and_si256(mask, pass);
+                    }
+
+                    if (!_mm256_testz_si256(mask, mask))
+                    {
+                        storeMaskedAVX2(pDepthDest, depthBits, mask);
+                    }
+                }
+
+                if (!_mm256_testz_si256(mask, mask))
+                {
+                    __m256i color = flatColor;
+                    if (pSetup->pTexels != NULL)
+                    {
+                        TEXTURE_SPAN span;
+                        GetTextureSpan(pSetup, blockX - pSetup->MinX, y - pSetup->MinY, &span);
+                        color = sampleTextureAVX2(pSetup, &span,
+                                                  _mm256_add_ps(_mm256_set1_ps(span.StartU), _mm256_mul_ps(_mm256_set1_ps(span.StepU), laneOffsetsF)),
+                                                  _mm256_add_ps(_mm256_set1_ps(span.StartV), _mm256_mul_ps(_mm256_set1_ps(span.StepV), laneOffsetsF)));
+                    }
+                    else if (!pSetup->bFlatColor)
+                    {
+                        color = packColorsAVX2(_mm256_add_ps(_mm256_set1_ps(pSetup->Colors[COLOR_CHANNEL_A] + pSetup->ColorStepsY[COLOR_CHANNEL_A] * offsetY),
+                                                             _mm256_mul_ps(colorStepsX[COLOR_CHANNEL_A], offsetX)),
+                                               _mm256_add_ps(_mm256_set1_ps(pSetup->Colors[COLOR_CHANNEL_R] + pSetup->ColorStepsY[COLOR_CHANNEL_R] * offsetY),
+                                                             _mm256_mul_ps(colorStepsX[COLOR_CHANNEL_R], offsetX)),
+                                               _mm256_add_ps(_mm256_set1_ps(pSetup->Colors[COLOR_CHANNEL_G] + pSetup->ColorStepsY[COLOR_CHANNEL_G] * offsetY),
+                                                             _mm256_mul_ps(colorStepsX[COLOR_CHANNEL_G], offsetX)),
+                                               _mm256_add_ps(_mm256_set1_ps(pSetup->Colors[COLOR_CHANNEL_B] + pSetup->ColorStepsY[COLOR_CHANNEL_B] * offsetY),
+                                                             _mm256_mul_ps(colorStepsX[COLOR_CHANNEL_B], offsetX)));
+                    }
+
+                    storeMaskedAVX2((__m256i*)pRow, color, mask);
+                }
+
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    rowEdges[i] += pSetup->EdgeStepsY[i];
+                }
+
+                pRow += pitch;
+                if (pDepthRow != NULL)
+                {
+                    pDepthRow += pitch;
+                }
+            }
+
+            if (pHiZBlock != NULL)
+            {
+                const __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(numCovered), _mm256_extracti128_si256(numCovered, 1));
+                const __m128i sum2 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(1, 0, 3, 2)));
+                const __m128i sum1 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)));
+                UpdateHiZBlock(pHiZBlock, -_mm_cvtsi128_si32(sum1), GetRectArea(&block, pClipRect), minDepth, maxDepth);
+            }
+        }
+    }
+}
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#endif // __clang__
\ No newline at end of file
@@ -0,0 +1,52 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 명령어 집합별 삼각형 커널과 커널이 함께 쓰는 Triangle.c의 함수
+// 각 변형은 별도 파일에 있고 RasterizeTriangle이 SelectSpanKernels로 고른 단계에 맞는 커널을 호출
+
+#ifndef SAFE99_TRIANGLE_KERNELS_H
+#define SAFE99_TRIANGLE_KERNELS_H
+
+typedef struct TEXTURE_LEVEL
+{
+    const uint32_t* pTexels;
+    int             Width;
+    int             Height;
+} TEXTURE_LEVEL;
+
+// 블록 한 행의 텍스처 좌표와 샘플링할 밉 레벨
+typedef struct TEXTURE_SPAN
+{
+    float           StartU;
+    float           StartV;
+    float           StepU;
+    float           StepV;
+
+    // LevelWeight가 0이 아니면 두 레벨의 결과를 [0, 256] 가중치로 보간
+    TEXTURE_LEVEL   Levels[2];
+    int             LevelWeight;
+} TEXTURE_SPAN;
+
+// 블록 한 행의 양 끝(offsetX, offsetX + HIZ_BLOCK_SIZE)에서만 원근 보정하고 픽셀당 증분을 구함
+void    __stdcall   GetTextureSpan(const TRIANGLE_SETUP* pSetup, const int offsetX, const int offsetY, TEXTURE_SPAN* pOutSpan);
+
+// Hi-Z로 블록 전체가 가려지면 false
+// *ppOutHiZBlock이 NULL이 아니면 그린 후 UpdateHiZBlock을 호출해야 함
+bool    __stdcall   TestHiZBlock(const TRIANGLE_SETUP* pSetup, DEPTH_BUFFER* pDepthBuffer, const int blockX, const int blockY,
+                                 const CLIP_RECT* pBlockRect, HIZ_BLOCK** ppOutHiZBlock, bool* pOutDepthTest,
+                                 float* pOutMinDepth, float* pOutMaxDepth);
+
+// 삼각형을 그린 블록의 Hi-Z 범위를 갱신
+void    __stdcall   UpdateHiZBlock(HIZ_BLOCK* pHiZBlock, const int numCovered, const int numVisible,
+                                   const float minDepth, const float maxDepth);
+
+// 두 영역의 교집합 픽셀 수
+int     __stdcall   GetRectArea(const CLIP_RECT* pRect0, const CLIP_RECT* pRect1);
+
+// pRect는 삼각형 바운딩 박스와 pClipRect의 교집합, 나머지는 RasterizeTriangle과 같음
+void    __stdcall   RasterizeTriangleSSE(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup,
+                                         const CLIP_RECT* pRect, const CLIP_RECT* pClipRect, DEPTH_BUFFER* pDepthBuffer);
+void    __stdcall   RasterizeTriangleAVX2(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup,
+                                          const CLIP_RECT* pRect, const CLIP_RECT* pClipRect, DEPTH_BUFFER* pDepthBuffer);
+
+#endif // SAFE99_TRIANGLE_KERNELS_H
\ No newline at end of file
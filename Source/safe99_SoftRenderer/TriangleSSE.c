@@ -0,0 +1,302 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// SSE4.1 삼각형 커널, 블록 한 행을 4픽셀씩 두 번에 처리하고 텍셀은 레인마다 따로 읽어 모음
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Clipping.h"
+#include "Depth.h"
+#include "Triangle.h"
+#include "TriangleKernels.h"
+
+// coord는 내림된 텍셀 좌표, 결과는 항상 [0, size)
+static __m128i __vectorcall addressTexelsSSE(const __m128 coord, const int size, const TEXTURE_ADDRESS address)
+{
+    const __m128i sizeI = _mm_set1_epi32(size);
+    const __m128i maxI = _mm_set1_epi32(size - 1);
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i texel;
+    if (address == TEXTURE_ADDRESS_WRAP)
+    {
+        const __m128 sizeF = _mm_set1_ps((float)size);
+        const __m128 wrapped = _mm_sub_ps(coord, _mm_mul_ps(sizeF, _mm_floor_ps(_mm_mul_ps(coord, _mm_set1_ps(1.0f / (float)size)))));
+        texel = _mm_cvtps_epi32(wrapped);
+
+        // 나눗셈 대신 역수를 곱해서 생긴 오차 보정
+        texel = _mm_sub_epi32(texel, _mm_and_si128(_mm_cmpgt_epi32(texel, maxI), sizeI));
+        texel = _mm_add_epi32(texel, _mm_and_si128(_mm_cmplt_epi32(texel, zero), sizeI));
+    }
+    else
+    {
+        texel = _mm_cvtps_epi32(coord);
+    }
+
+    // 범위를 넘는 좌표나 NaN도 텍스처 밖을 읽지 않도록 자름
+    return _mm_min_epi32(_mm_max_epi32(texel, zero), maxI);
+}
+
+static __m128i __vectorcall gatherTexelsSSE(const uint32_t* pTexels, const __m128i index)
+{
+    return _mm_set_epi32((int)pTexels[_mm_extract_epi32(index, 3)],
+                         (int)pTexels[_mm_extract_epi32(index, 2)],
+                         (int)pTexels[_mm_extract_epi32(index, 1)],
+                         (int)pTexels[_mm_cvtsi128_si32(index)]);
+}
+
+// weight는 [0, 256], t0 * (256 - weight) + t1 * weight를 채널별로 계산
+static __m128i __vectorcall lerpTexelsSSE(const __m128i t0, const __m128i t1, const __m128i weight)
+{
+    const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i weight1 = _mm_or_si128(weight, _mm_slli_epi32(weight, 16));
+    const __m128i weight0 = _mm_sub_epi16(_mm_set1_epi32(0x01000100), weight1);
+
+    const __m128i rb = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(t0, mask), weight0),
+                                     _mm_mullo_epi16(_mm_and_si128(t1, mask), weight1));
+    const __m128i ag = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(t0, 8), mask), weight0),
+                                     _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(t1, 8), mask), weight1));
+
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi32(rb, 8), mask), _mm_andnot_si128(mask, ag));
+}
+
+static __m128i __vectorcall sampleTextureLevelSSE(const TEXTURE_LEVEL* pLevel, const bool bBilinear, const TEXTURE_ADDRESS address,
+                                                  const __m128 u, const __m128 v)
+{
+    const __m128i width = _mm_set1_epi32(pLevel->Width);
+    const __m128 texelU = _mm_mul_ps(u, _mm_set1_ps((float)pLevel->Width));
+    const __m128 texelV = _mm_mul_ps(v, _mm_set1_ps((float)pLevel->Height));
+
+    if (!bBilinear)
+    {
+        const __m128i x = addressTexelsSSE(_mm_floor_ps(texelU), pLevel->Width, address);
+        const __m128i y = addressTexelsSSE(_mm_floor_ps(texelV), pLevel->Height, address);
+        return gatherTexelsSSE(pLevel->pTexels, _mm_add_epi32(_mm_mullo_epi32(y, width), x));
+    }
+
+    // 텍셀 중심 기준으로 주변 4개를 보간
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(256.0f);
+    const __m128 centerU = _mm_sub_ps(texelU, half);
+    const __m128 centerV = _mm_sub_ps(texelV, half);
+    const __m128 floorU = _mm_floor_ps(centerU);
+    const __m128 floorV = _mm_floor_ps(centerV);
+    const __m128i weightU = _mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(centerU, floorU), scale));
+    const __m128i weightV = _mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(centerV, floorV), scale));
+
+    const __m128i x0 = addressTexelsSSE(floorU, pLevel->Width, address);
+    const __m128i x1 = addressTexelsSSE(_mm_add_ps(floorU, one), pLevel->Width, address);
+    const __m128i row0 = _mm_mullo_epi32(addressTexelsSSE(floorV, pLevel->Height, address), width);
+    const __m128i row1 = _mm_mullo_epi32(addressTexelsSSE(_mm_add_ps(floorV, one), pLevel->Height, address), width);
+
+    const __m128i t00 = gatherTexelsSSE(pLevel->pTexels, _mm_add_epi32(row0, x0));
+    const __m128i t10 = gatherTexelsSSE(pLevel->pTexels, _mm_add_epi32(row0, x1));
+    const __m128i t01 = gatherTexelsSSE(pLevel->pTexels, _mm_add_epi32(row1, x0));
+    const __m128i t11 = gatherTexelsSSE(pLevel->pTexels, _mm_add_epi32(row1, x1));
+
+    return lerpTexelsSSE(lerpTexelsSSE(t00, t10, weightU), lerpTexelsSSE(t01, t11, weightU), weightV);
+}
+
+static __m128i __vectorcall sampleTextureSSE(const TRIANGLE_SETUP* pSetup, const TEXTURE_SPAN* pSpan, const __m128 u, const __m128 v)
+{
+    const bool bBilinear = (pSetup->TextureFilter != TEXTURE_FILTER_POINT);
+    const __m128i texels = sampleTextureLevelSSE(&pSpan->Levels[0], bBilinear, pSetup->TextureAddress, u, v);
+    if (pSpan->LevelWeight == 0)
+    {
+        return texels;
+    }
+
+    return lerpTexelsSSE(texels, sampleTextureLevelSSE(&pSpan->Levels[1], bBilinear, pSetup->TextureAddress, u, v),
+                         _mm_set1_epi32(pSpan->LevelWeight));
+}
+
+static __m128i __vectorcall packColorsSSE(const __m128 a, const __m128 r, const __m128 g, const __m128 b)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 max = _mm_set1_ps(255.0f);
+
+    const __m128i ai = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(a, zero), max));
+    const __m128i ri = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(r, zero), max));
+    const __m128i gi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(g, zero), max));
+    const __m128i bi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(b, zero), max));
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(ai, 24), _mm_slli_epi32(ri, 16)),
+                        _mm_or_si128(_mm_slli_epi32(gi, 8), bi));
+}
+
+static void __vectorcall storeMaskedSSE(__m128i* pDest, const __m128i value, const __m128i mask)
+{
+    if (_mm_movemask_epi8(mask) == 0xffff)
+    {
+        _mm_store_si128(pDest, value);
+    }
+    else
+    {
+        _mm_store_si128(pDest, _mm_blendv_epi8(_mm_load_si128(pDest), value, mask));
+    }
+}
+
+// 블록의 한 행(8픽셀)을 4픽셀씩 두 번에 처리, 블록은 8픽셀 경계에 맞으므로 정렬된 저장을 사용
+void __stdcall RasterizeTriangleSSE(uint32_t* pBuffer, const uint_t pitch, const TRIANGLE_SETUP* pSetup,
+                                    const CLIP_RECT* pRect, const CLIP_RECT* pClipRect, DEPTH_BUFFER* pDepthBuffer)
+{
+    const __m128i laneOffsets[2] = { _mm_set_epi32(3, 2, 1, 0), _mm_set_epi32(7, 6, 5, 4) };
+
+    __m128i laneEdgeSteps[2][3];
+    for (size_t half = 0; half < 2; ++half)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            laneEdgeSteps[half][i] = _mm_mullo_epi32(_mm_set1_epi32(pSetup->EdgeStepsX[i]), laneOffsets[half]);
+        }
+    }
+
+    __m128 colorStepsX[NUM_COLOR_CHANNELS];
+    for (size_t i = 0; i < NUM_COLOR_CHANNELS; ++i)
+    {
+        colorStepsX[i] = _mm_set1_ps(pSetup->ColorStepsX[i]);
+    }
+
+    const __m128i flatColor = _mm_set1_epi32((int)pSetup->FlatArgb);
+    const __m128 depthStepX = _mm_set1_ps(pSetup->DepthStepX);
+    const __m128 depthScale = _mm_set1_ps((float)D24_MAX_VALUE);
+    const bool bD24 = (pDepthBuffer != NULL && pDepthBuffer->Format == DEPTH_FORMAT_D24_UNORM);
+
+    for (int blockY = pRect->MinY & ~(HIZ_BLOCK_SIZE - 1); blockY <= pRect->MaxY; blockY += HIZ_BLOCK_SIZE)
+    {
+        for (int blockX = pRect->MinX & ~(HIZ_BLOCK_SIZE - 1); blockX <= pRect->MaxX; blockX += HIZ_BLOCK_SIZE)
+        {
+            const CLIP_RECT block = { blockX, blockY, blockX + HIZ_BLOCK_SIZE - 1, blockY + HIZ_BLOCK_SIZE - 1 };
+            CLIP_RECT blockRect;
+            IntersectClipRect(&block, pRect, &blockRect);
+            if (IsTriangleOutsideRect(pSetup, &blockRect))
+            {
+                continue;
+            }
+
+            HIZ_BLOCK* pHiZBlock;
+            bool bDepthTest;
+            float minDepth;
+            float maxDepth;
+            if (!TestHiZBlock(pSetup, pDepthBuffer, blockX, blockY, &blockRect, &pHiZBlock, &bDepthTest, &minDepth, &maxDepth))
+            {
+                continue;
+            }
+
+            const __m128i rectMinX = _mm_set1_epi32(blockRect.MinX - 1);
+            const __m128i rectMaxX = _mm_set1_epi32(blockRect.MaxX + 1);
+            __m128i inRect[2];
+            __m128 offsetX[2];
+            for (size_t half = 0; half < 2; ++half)
+            {
+                const __m128i x = _mm_add_epi32(_mm_set1_epi32(blockX), laneOffsets[half]);
+                inRect[half] = _mm_and_si128(_mm_cmpgt_epi32(x, rectMinX), _mm_cmplt_epi32(x, rectMaxX));
+                offsetX[half] = _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(blockX - pSetup->MinX), laneOffsets[half]));
+            }
+
+            int rowEdges[3];
+            for (size_t i = 0; i < 3; ++i)
+            {
+                rowEdges[i] = pSetup->Edges[i]
+                    + pSetup->EdgeStepsX[i] * (blockX - pSetup->MinX)
+                    + pSetup->EdgeStepsY[i] * (blockRect.MinY - pSetup->MinY);
+            }
+
+            // 레인별 덮인 픽셀 수의 음수
+            __m128i numCovered = _mm_setzero_si128();
+
+            uint32_t* pRow = pBuffer + blockRect.MinY * pitch + blockX;
+            uint32_t* pDepthRow = (pHiZBlock != NULL) ? (uint32_t*)pDepthBuffer->pDepths + blockRect.MinY * pitch + blockX : NULL;
+            for (int y = blockRect.MinY; y <= blockRect.MaxY; ++y)
+            {
+                const float offsetY = (float)(y - pSetup->MinY);
+                const __m128 rowDepth = _mm_set1_ps(pSetup->Depth + pSetup->DepthStepY * offsetY);
+
+                TEXTURE_SPAN span = { 0 };
+                if (pSetup->pTexels != NULL)
+                {
+                    GetTextureSpan(pSetup, blockX - pSetup->MinX, y - pSetup->MinY, &span);
+                }
+
+                for (size_t half = 0; half < 2; ++half)
+                {
+                    const __m128i e0 = _mm_add_epi32(_mm_set1_epi32(rowEdges[0]), laneEdgeSteps[half][0]);
+                    const __m128i e1 = _mm_add_epi32(_mm_set1_epi32(rowEdges[1]), laneEdgeSteps[half][1]);
+                    const __m128i e2 = _mm_add_epi32(_mm_set1_epi32(rowEdges[2]), laneEdgeSteps[half][2]);
+                    const __m128i inside = _mm_srai_epi32(_mm_or_si128(_mm_or_si128(e0, e1), e2), 31);
+                    __m128i mask = _mm_andnot_si128(inside, inRect[half]);
+                    numCovered = _mm_add_epi32(numCovered, mask);
+
+                    if (pDepthRow != NULL && !_mm_testz_si128(mask, mask))
+                    {
+                        const __m128 depth = _mm_add_ps(rowDepth, _mm_mul_ps(depthStepX, offsetX[half]));
+                        const __m128i depthBits = bD24
+                            ? _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(depth, _mm_setzero_ps()), _mm_set1_ps(1.0f)), depthScale))
+                            : _mm_castps_si128(depth);
+
+                        __m128i* pDepthDest = (__m128i*)(pDepthRow + 4 * half);
+                        if (bDepthTest)
+                        {
+                            const __m128i storedBits = _mm_load_si128(pDepthDest);
+                            const __m128i pass = bD24
+                                ? _mm_cmpgt_epi32(storedBits, depthBits)
+                                : _mm_castps_si128(_mm_cmplt_ps(depth, _mm_castsi128_ps(storedBits)));
+                            mask = _mm_and_si128(mask, pass);
+                        }
+
+                        if (!_mm_testz_si128(mask, mask))
+                        {
+                            storeMaskedSSE(pDepthDest, depthBits, mask);
+                        }
+                    }
+
+                    if (!_mm_testz_si128(mask, mask))
+                    {
+                        __m128i color = flatColor;
+                        if (pSetup->pTexels != NULL)
+                        {
+                            const __m128 laneOffsetsF = _mm_cvtepi32_ps(laneOffsets[half]);
+                            color = sampleTextureSSE(pSetup, &span,
+                                                     _mm_add_ps(_mm_set1_ps(span.StartU), _mm_mul_ps(_mm_set1_ps(span.StepU), laneOffsetsF)),
+                                                     _mm_add_ps(_mm_set1_ps(span.StartV), _mm_mul_ps(_mm_set1_ps(span.StepV), laneOffsetsF)));
+                        }
+                        else if (!pSetup->bFlatColor)
+                        {
+                            color = packColorsSSE(_mm_add_ps(_mm_set1_ps(pSetup->Colors[COLOR_CHANNEL_A] + pSetup->ColorStepsY[COLOR_CHANNEL_A] * offsetY),
+                                                             _mm_mul_ps(colorStepsX[COLOR_CHANNEL_A], offsetX[half])),
+                                                  _mm_add_ps(_mm_set1_ps(pSetup->Colors[COLOR_CHANNEL_R] + pSetup->ColorStepsY[COLOR_CHANNEL_R] * offsetY),
+                                                             _mm_mul_ps(colorStepsX[COLOR_CHANNEL_R], offsetX[half])),
+                                                  _mm_add_ps(_mm_set1_ps(pSetup->Colors[COLOR_CHANNEL_G] + pSetup->ColorStepsY[COLOR_CHANNEL_G] * offsetY),
+                                                             _mm_mul_ps(colorStepsX[COLOR_CHANNEL_G], offsetX[half])),
+                                                  _mm_add_ps(_mm_set1_ps(pSetup->Colors[COLOR_CHANNEL_B] + pSetup->ColorStepsY[COLOR_CHANNEL_B] * offsetY),
+                                                             _mm_mul_ps(colorStepsX[COLOR_CHANNEL_B], offsetX[half])));
+                        }
+
+                        storeMaskedSSE((__m128i*)(pRow + 4 * half), color, mask);
+                    }
+                }
+
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    rowEdges[i] += pSetup->EdgeStepsY[i];
+                }
+
+                pRow += pitch;
+                if (pDepthRow != NULL)
+                {
+                    pDepthRow += pitch;
+                }
+            }
+
+            if (pHiZBlock != NULL)
+            {
+                const __m128i sum2 = _mm_add_epi32(numCovered, _mm_shuffle_epi32(numCovered, _MM_SHUFFLE(1, 0, 3, 2)));
+                const __m128i sum1 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)));
+                UpdateHiZBlock(pHiZBlock, -_mm_cvtsi128_si32(sum1), GetRectArea(&block, pClipRect), minDepth, maxDepth);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,315 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+
+#include "Precompiled.h"
+#include "safe99_Common/Common.h"
+#include "safe99_Common/Interface/IRenderer.h"
+#include "safe99_Math/safe99_Math.inl"
+#include "Upscale.h"
+
+// 목적지 d번째 픽셀 중심에 해당하는 원본 위치 (d + 0.5) * srcSize / destSize 를 내림
+static uint_t getNearestIndex(const uint_t d, const uint_t srcSize, const uint_t destSize)
+{
+    const uint_t index = (uint_t)(((uint64_t)(2 * d + 1) * srcSize) / (2 * (uint64_t)destSize));
+    return MIN(index, srcSize - 1);
+}
+
+// 목적지 d번째 픽셀 중심의 원본 좌표에서 원본 픽셀 중심까지 (16.16), 두 번째 원본 픽셀이 있어야 함
+static void getBilinearIndex(const uint_t d, const uint_t srcSize, const uint_t destSize, uint_t* pOutIndex, uint_t* pOutWeight)
+{
+    const int64_t pos = (int64_t)((((uint64_t)(2 * d + 1) * srcSize) << 16) / (2 * (uint64_t)destSize)) - 0x8000;
+    if (pos <= 0)
+    {
+        *pOutIndex = 0;
+        *pOutWeight = 0;
+        return;
+    }
+
+    const uint_t index = (uint_t)(pos >> 16);
+    if (index >= srcSize - 1)
+    {
+        // 마지막 픽셀은 오른쪽(아래쪽) 픽셀만 쓰도록 한 칸 앞에서 시작
+        *pOutIndex = srcSize - 2;
+        *pOutWeight = 256;
+        return;
+    }
+
+    *pOutIndex = index;
+    *pOutWeight = (uint_t)(pos >> 8) & 0xff;
+}
+
+static uint32_t lerpPixel(const uint32_t a, const uint32_t b, const uint_t weight)
+{
+    uint32_t result = 0;
+    for (uint_t shift = 0; shift < 32; shift += 8)
+    {
+        const uint_t channel = (((a >> shift) & 0xff) * (256 - weight) + ((b >> shift) & 0xff) * weight + 128) >> 8;
+        result |= (uint32_t)channel << shift;
+    }
+
+    return result;
+}
+
+// 원본 한 행을 열 표에 따라 가로로 늘림
+static void scaleRowBilinear(uint32_t* pDest, const uint32_t* pSrc, const uint32_t* pColumns, const uint32_t* pColumnWeights, const uint_t width)
+{
+    // 픽셀 두 개(왼쪽, 오른쪽)를 채널마다 (왼쪽, 오른쪽) 쌍으로 섞음
+    const __m128i interleave = _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(128);
+
+    uint_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i pair01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(pSrc + pColumns[x])),
+                                                  _mm_loadl_epi64((const __m128i*)(pSrc + pColumns[x + 1])));
+        const __m128i pair23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(pSrc + pColumns[x + 2])),
+                                                  _mm_loadl_epi64((const __m128i*)(pSrc + pColumns[x + 3])));
+        const __m128i channels01 = _mm_shuffle_epi8(pair01, interleave);
+        const __m128i channels23 = _mm_shuffle_epi8(pair23, interleave);
+        const __m128i weights = _mm_loadu_si128((const __m128i*)(pColumnWeights + x));
+
+        // 왼쪽 * (256 - f) + 오른쪽 * f 를 채널마다 32비트로
+        __m128i c0 = _mm_madd_epi16(_mm_unpacklo_epi8(channels01, zero), _mm_shuffle_epi32(weights, 0x00));
+        __m128i c1 = _mm_madd_epi16(_mm_unpackhi_epi8(channels01, zero), _mm_shuffle_epi32(weights, 0x55));
+        __m128i c2 = _mm_madd_epi16(_mm_unpacklo_epi8(channels23, zero), _mm_shuffle_epi32(weights, 0xaa));
+        __m128i c3 = _mm_madd_epi16(_mm_unpackhi_epi8(channels23, zero), _mm_shuffle_epi32(weights, 0xff));
+        c0 = _mm_srli_epi32(_mm_add_epi32(c0, round), 8);
+        c1 = _mm_srli_epi32(_mm_add_epi32(c1, round), 8);
+        c2 = _mm_srli_epi32(_mm_add_epi32(c2, round), 8);
+        c3 = _mm_srli_epi32(_mm_add_epi32(c3, round), 8);
+
+        const __m128i result = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+        _mm_storeu_si128((__m128i*)(pDest + x), result);
+    }
+
+    for (; x < width; ++x)
+    {
+        const uint32_t* pPair = pSrc + pColumns[x];
+        pDest[x] = lerpPixel(pPair[0], pPair[1], pColumnWeights[x] >> 16);
+    }
+}
+
+// 가로로 늘린 두 행을 weight로 섞음
+static void blendRows(uint32_t* pDest, const uint32_t* pTop, const uint32_t* pBottom, const uint_t weight, const uint_t width)
+{
+    if (weight == 0 || weight == 256)
+    {
+        memcpy(pDest, (weight == 0) ? pTop : pBottom, sizeof(uint32_t) * width);
+        return;
+    }
+
+    // 두 가중치의 합이 256이므로 16비트 부호 없는 합이 넘치지 않음
+    const __m128i topWeight = _mm_set1_epi16((short)(256 - weight));
+    const __m128i bottomWeight = _mm_set1_epi16((short)weight);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+
+    uint_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i top = _mm_loadu_si128((const __m128i*)(pTop + x));
+        const __m128i bottom = _mm_loadu_si128((const __m128i*)(pBottom + x));
+
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(top, zero), topWeight),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(bottom, zero), bottomWeight));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(top, zero), topWeight),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(bottom, zero), bottomWeight));
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+
+        _mm_storeu_si128((__m128i*)(pDest + x), _mm_packus_epi16(lo, hi));
+    }
+
+    for (; x < width; ++x)
+    {
+        pDest[x] = lerpPixel(pTop[x], pBottom[x], weight);
+    }
+}
+
+// 너비가 정수 배면 원본 픽셀 하나를 scale개로 늘림
+static void scaleRowInteger(uint32_t* pDest, const uint32_t* pSrc, const uint_t srcWidth, const uint_t scale)
+{
+    if (scale == 2)
+    {
+        uint_t x = 0;
+        for (; x + 4 <= srcWidth; x += 4)
+        {
+            const __m128i pixels = _mm_loadu_si128((const __m128i*)(pSrc + x));
+            _mm_storeu_si128((__m128i*)(pDest + 2 * x), _mm_unpacklo_epi32(pixels, pixels));
+            _mm_storeu_si128((__m128i*)(pDest + 2 * x + 4), _mm_unpackhi_epi32(pixels, pixels));
+        }
+
+        for (; x < srcWidth; ++x)
+        {
+            pDest[2 * x] = pSrc[x];
+            pDest[2 * x + 1] = pSrc[x];
+        }
+
+        return;
+    }
+
+    for (uint_t x = 0; x < srcWidth; ++x)
+    {
+        const __m128i pixel = _mm_set1_epi32((int)pSrc[x]);
+        uint32_t* pSpan = pDest + (size_t)x * scale;
+
+        uint_t i = 0;
+        for (; i + 4 <= scale; i += 4)
+        {
+            _mm_storeu_si128((__m128i*)(pSpan + i), pixel);
+        }
+
+        for (; i < scale; ++i)
+        {
+            pSpan[i] = pSrc[x];
+        }
+    }
+}
+
+static void upscaleNearest(UPSCALER* pUpscaler, uint32_t* pDest, const uint_t destPitch, const uint_t destWidth, const uint_t destHeight,
+                           const uint32_t* pSrc, const uint_t srcPitch, const uint_t srcWidth, const uint_t srcHeight)
+{
+    const bool bIntegerScale = (destWidth % srcWidth == 0);
+    if (!bIntegerScale)
+    {
+        for (uint_t x = 0; x < destWidth; ++x)
+        {
+            pUpscaler->pColumns[x] = (uint32_t)getNearestIndex(x, srcWidth, destWidth);
+        }
+    }
+
+    const uint32_t* pColumns = pUpscaler->pColumns;
+    uint_t prevRow = UINT_MAX;
+    uint32_t* pDestRow = pDest;
+    for (uint_t y = 0; y < destHeight; ++y, pDestRow += destPitch)
+    {
+        // 같은 원본 행이면 바로 위 행을 복사
+        const uint_t row = getNearestIndex(y, srcHeight, destHeight);
+        if (row == prevRow)
+        {
+            memcpy(pDestRow, pDestRow - destPitch, sizeof(uint32_t) * destWidth);
+            continue;
+        }
+
+        prevRow = row;
+
+        const uint32_t* pSrcRow = pSrc + (size_t)row * srcPitch;
+        if (bIntegerScale)
+        {
+            scaleRowInteger(pDestRow, pSrcRow, srcWidth, destWidth / srcWidth);
+            continue;
+        }
+
+        uint_t x = 0;
+        for (; x + 4 <= destWidth; x += 4)
+        {
+            const __m128i pixels = _mm_setr_epi32((int)pSrcRow[pColumns[x]], (int)pSrcRow[pColumns[x + 1]],
+                                                  (int)pSrcRow[pColumns[x + 2]], (int)pSrcRow[pColumns[x + 3]]);
+            _mm_storeu_si128((__m128i*)(pDestRow + x), pixels);
+        }
+
+        for (; x < destWidth; ++x)
+        {
+            pDestRow[x] = pSrcRow[pColumns[x]];
+        }
+    }
+}
+
+static void upscaleBilinear(UPSCALER* pUpscaler, uint32_t* pDest, const uint_t destPitch, const uint_t destWidth, const uint_t destHeight,
+                            const uint32_t* pSrc, const uint_t srcPitch, const uint_t srcWidth, const uint_t srcHeight)
+{
+    for (uint_t x = 0; x < destWidth; ++x)
+    {
+        uint_t column;
+        uint_t weight;
+        getBilinearIndex(x, srcWidth, destWidth, &column, &weight);
+
+        pUpscaler->pColumns[x] = (uint32_t)column;
+        pUpscaler->pColumnWeights[x] = (uint32_t)((256 - weight) | (weight << 16));
+    }
+
+    // pRows[0]이 가로로 늘린 원본 행, pRows[1]은 그 다음 행
+    uint32_t* pRows[2] = { pUpscaler->pRows[0], pUpscaler->pRows[1] };
+    uint_t cachedRow = UINT_MAX;
+    for (uint_t y = 0; y < destHeight; ++y)
+    {
+        uint_t row;
+        uint_t weight;
+        getBilinearIndex(y, srcHeight, destHeight, &row, &weight);
+
+        // 늘릴 때는 원본 행이 한 칸씩 내려가므로 아래 행을 재사용
+        if (row != cachedRow)
+        {
+            if (cachedRow != UINT_MAX && row == cachedRow + 1)
+            {
+                uint32_t* pTemp = pRows[0];
+                pRows[0] = pRows[1];
+                pRows[1] = pTemp;
+            }
+            else
+            {
+                scaleRowBilinear(pRows[0], pSrc + (size_t)row * srcPitch, pUpscaler->pColumns, pUpscaler->pColumnWeights, destWidth);
+            }
+
+            scaleRowBilinear(pRows[1], pSrc + (size_t)(row + 1) * srcPitch, pUpscaler->pColumns, pUpscaler->pColumnWeights, destWidth);
+            cachedRow = row;
+        }
+
+        blendRows(pDest + (size_t)y * destPitch, pRows[0], pRows[1], weight, destWidth);
+    }
+}
+
+bool __stdcall UpscalerInit(UPSCALER* pUpscaler, const uint_t maxDestWidth)
+{
+    ASSERT(pUpscaler != NULL, "pUpscaler is NULL");
+    ASSERT(maxDestWidth > 0, "maxDestWidth is 0");
+
+    memset(pUpscaler, 0, sizeof(UPSCALER));
+
+    pUpscaler->pColumns = (uint32_t*)malloc(sizeof(uint32_t) * maxDestWidth);
+    pUpscaler->pColumnWeights = (uint32_t*)malloc(sizeof(uint32_t) * maxDestWidth);
+    pUpscaler->pRows[0] = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * maxDestWidth, DEFAULT_ALIGN);
+    pUpscaler->pRows[1] = (uint32_t*)ALIGNED_MALLOC(sizeof(uint32_t) * maxDestWidth, DEFAULT_ALIGN);
+    if (pUpscaler->pColumns == NULL || pUpscaler->pColumnWeights == NULL || pUpscaler->pRows[0] == NULL || pUpscaler->pRows[1] == NULL)
+    {
+        UpscalerRelease(pUpscaler);
+        return false;
+    }
+
+    pUpscaler->MaxDestWidth = maxDestWidth;
+
+    return true;
+}
+
+void __stdcall UpscalerRelease(UPSCALER* pUpscaler)
+{
+    ASSERT(pUpscaler != NULL, "pUpscaler is NULL");
+
+    SAFE_FREE(pUpscaler->pColumns);
+    SAFE_FREE(pUpscaler->pColumnWeights);
+    SAFE_ALIGNED_FREE(pUpscaler->pRows[0]);
+    SAFE_ALIGNED_FREE(pUpscaler->pRows[1]);
+    pUpscaler->MaxDestWidth = 0;
+}
+
+void __stdcall Upscale(UPSCALER* pUpscaler, const UPSCALE_FILTER filter,
+                       uint32_t* pDest, const uint_t destPitch, const uint_t destWidth, const uint_t destHeight,
+                       const uint32_t* pSrc, const uint_t srcPitch, const uint_t srcWidth, const uint_t srcHeight)
+{
+    ASSERT(pUpscaler != NULL, "pUpscaler is NULL");
+    ASSERT(pDest != NULL, "pDest is NULL");
+    ASSERT(pSrc != NULL, "pSrc is NULL");
+    ASSERT(destWidth <= pUpscaler->MaxDestWidth, "destWidth > MaxDestWidth");
+    ASSERT(srcWidth > 0 && srcHeight > 0, "Empty source");
+
+    // 바이리니어는 가로세로 모두 이웃 픽셀이 있어야 함
+    if (filter == UPSCALE_FILTER_BILINEAR && srcWidth >= 2 && srcHeight >= 2)
+    {
+        upscaleBilinear(pUpscaler, pDest, destPitch, destWidth, destHeight, pSrc, srcPitch, srcWidth, srcHeight);
+    }
+    else
+    {
+        upscaleNearest(pUpscaler, pDest, destPitch, destWidth, destHeight, pSrc, srcPitch, srcWidth, srcHeight);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+﻿// 작성자: bumpsgoodman
+// 작성일: 2026-10-17
+//
+// 작은 A8R8G8B8 서피스를 큰 서피스 전체로 늘리는 커널, 두 서피스의 픽셀 중심을 맞춤
+// 원본 좌표는 16.16 고정소수점, 바이리니어 가중치는 8비트 (합 256)
+
+#ifndef SAFE99_UPSCALE_H
+#define SAFE99_UPSCALE_H
+
+typedef struct UPSCALER
+{
+    uint_t      MaxDestWidth;
+
+    // 목적지 열마다 원본 열, 바이리니어는 왼쪽 열
+    uint32_t*   pColumns;
+
+    // 목적지 열마다 왼쪽 가중치 | 오른쪽 가중치 << 16
+    uint32_t*   pColumnWeights;
+
+    // 바이리니어에서 가로로 늘린 원본 행 두 개 (위, 아래)
+    uint32_t*   pRows[2];
+} UPSCALER;
+
+bool    __stdcall   UpscalerInit(UPSCALER* pUpscaler, const uint_t maxDestWidth);
+void    __stdcall   UpscalerRelease(UPSCALER* pUpscaler);
+
+// pSrc의 srcWidth x srcHeight를 pDest의 destWidth x destHeight로 늘림, 줄여도 동작하지만 건너뛴 픽셀은 섞지 않음
+// UPSCALE_FILTER_NEAREST에서 너비가 정수 배면 원본 픽셀을 그대로 반복해서 씀
+void    __stdcall   Upscale(UPSCALER* pUpscaler, const UPSCALE_FILTER filter,
+                            uint32_t* pDest, const uint_t destPitch, const uint_t destWidth, const uint_t destHeight,
+                            const uint32_t* pSrc, const uint_t srcPitch, const uint_t srcWidth, const uint_t srcHeight);
+
+#endif // SAFE99_UPSCALE_H
\ No newline at end of file